@@ -0,0 +1,143 @@
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP
+
+#include "general_definitions.hpp"
+
+namespace Benchmark {
+struct Options {
+    // untimed runs before the timed repetitions, to warm up caches and page in memory
+    uint warmup      = 3;
+    uint repetitions = 20;
+};
+
+/**
+ * Statistics of the wall time of the repetitions of one kernel sweep over n_items items (elements, interfaces, ...).
+ * A p of -1 marks kernels that do not depend on the polynomial order.
+ */
+struct Result {
+    std::string kernel;
+    int p;
+    uint n_items;
+
+    double min;
+    double median;
+    double mean;
+    double stddev;
+    double max;
+
+    double GetNanosecondsPerItem() const { return 1.0e9 * this->median / std::max(this->n_items, 1u); }
+};
+
+/**
+ * Time a kernel sweep. The setup function is called untimed before each run, for kernels that consume their input.
+ *
+ * @param kernel name of the kernel
+ * @param p polynomial order, -1 if the kernel does not depend on it
+ * @param n_items number of items a sweep processes
+ * @param options number of warmup runs and timed repetitions
+ * @param setup function called before each run
+ * @param sweep function running the kernel over all items
+ */
+template <typename SetupType, typename SweepType>
+Result run(const std::string& kernel,
+           const int p,
+           const uint n_items,
+           const Options& options,
+           const SetupType& setup,
+           const SweepType& sweep) {
+    using clock_t = std::chrono::steady_clock;
+
+    for (uint run = 0; run < options.warmup; ++run) {
+        setup();
+        sweep();
+    }
+
+    std::vector<double> seconds(std::max(options.repetitions, 1u));
+
+    for (double& time : seconds) {
+        setup();
+
+        const clock_t::time_point begin = clock_t::now();
+        sweep();
+        const clock_t::time_point end = clock_t::now();
+
+        time = std::chrono::duration<double>(end - begin).count();
+    }
+
+    std::sort(seconds.begin(), seconds.end());
+
+    Result result;
+    result.kernel  = kernel;
+    result.p       = p;
+    result.n_items = n_items;
+
+    const std::size_t n = seconds.size();
+
+    result.min    = seconds.front();
+    result.max    = seconds.back();
+    result.median = n % 2 ? seconds[n / 2] : 0.5 * (seconds[n / 2 - 1] + seconds[n / 2]);
+    result.mean   = std::accumulate(seconds.begin(), seconds.end(), 0.0) / n;
+
+    double variance = 0.0;
+    for (const double time : seconds) {
+        variance += (time - result.mean) * (time - result.mean);
+    }
+
+    result.stddev = n > 1 ? std::sqrt(variance / (n - 1)) : 0.0;
+
+    return result;
+}
+
+template <typename SweepType>
+Result run(const std::string& kernel, const int p, const uint n_items, const Options& options, const SweepType& sweep) {
+    return run(kernel, p, n_items, options, []() {}, sweep);
+}
+
+inline void write_summary(std::ostream& out, const Result& result) {
+    out << std::left << std::setw(36) << result.kernel << std::right << std::setw(4) << result.p << std::setw(10)
+        << result.n_items << std::scientific << std::setprecision(3) << std::setw(13) << result.median
+        << std::setw(13) << result.min << std::setw(13) << result.stddev << std::fixed << std::setprecision(1)
+        << std::setw(14) << result.GetNanosecondsPerItem() << std::defaultfloat << std::endl;
+}
+
+/**
+ * Write the results of a benchmark run as JSON.
+ * Layout: {"backend": name, "compiler": version, "warmup": n, "repetitions": n, "results": [{"kernel": name, "p": p,
+ * "items": n, "min": s, "median": s, "mean": s, "stddev": s, "max": s, "ns_per_item": ns}]}, with times in seconds
+ * per sweep. scripts/benchmarks/compare_benchmarks.py compares two such files.
+ *
+ * @param file_name name of the JSON file
+ * @param options options the benchmarks ran with
+ * @param results results of all benchmarks
+ */
+inline void write_json(const std::string& file_name, const Options& options, const std::vector<Result>& results) {
+    std::ofstream file(file_name);
+
+    if (!file) {
+        throw std::logic_error("Fatal Error: unable to open benchmark file " + file_name + "\n");
+    }
+
+#ifdef USE_BLAZE
+    const std::string backend = "blaze";
+#else
+    const std::string backend = "eigen";
+#endif
+
+    file << std::setprecision(9) << "{\n  \"backend\": \"" << backend << "\",\n  \"compiler\": \"" << __VERSION__
+         << "\",\n  \"warmup\": " << options.warmup << ",\n  \"repetitions\": " << options.repetitions
+         << ",\n  \"results\": [";
+
+    for (uint id = 0; id < results.size(); ++id) {
+        const Result& result = results[id];
+
+        file << (id ? ",\n" : "\n") << "    {\"kernel\": \"" << result.kernel << "\", \"p\": " << result.p
+             << ", \"items\": " << result.n_items << ", \"min\": " << result.min << ", \"median\": " << result.median
+             << ", \"mean\": " << result.mean << ", \"stddev\": " << result.stddev << ", \"max\": " << result.max
+             << ", \"ns_per_item\": " << result.GetNanosecondsPerItem() << '}';
+    }
+
+    file << "\n  ]\n}\n";
+}
+}
+
+#endif
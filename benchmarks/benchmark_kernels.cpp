@@ -0,0 +1,396 @@
+#include "general_definitions.hpp"
+#include "preprocessor/input_parameters.hpp"
+
+#include "problem/definitions.hpp"
+#include "problem/serial_functions.hpp"
+
+#include "benchmark.hpp"
+
+#if !defined(SWE_SUPPORT) || !defined(RKDG_SUPPORT)
+#error "Kernel benchmarks require the SWE and RKDG targets"
+#endif
+
+/**
+ * Mesh meta data of a rectangle of n_x by n_y squares of side dx, each split into two triangles, surrounded by land
+ * boundaries. The bathymetry slopes from 10 to 20 m along x.
+ */
+MeshMetaData make_rectangle_mesh(const uint n_x, const uint n_y, const double dx) {
+    MeshMetaData mesh_data;
+    mesh_data.mesh_name = "benchmark_rectangle";
+
+    for (uint j = 0; j <= n_y; ++j) {
+        for (uint i = 0; i <= n_x; ++i) {
+            NodeMetaData node;
+            node.coordinates = Point<3>{i * dx, j * dx, 10.0 + 10.0 * i / n_x};
+
+            mesh_data.nodes.insert({j * (n_x + 1) + i, node});
+        }
+    }
+
+    for (uint j = 0; j < n_y; ++j) {
+        for (uint i = 0; i < n_x; ++i) {
+            const uint node_00 = j * (n_x + 1) + i;
+            const uint node_10 = node_00 + 1;
+            const uint node_01 = node_00 + n_x + 1;
+            const uint node_11 = node_01 + 1;
+
+            ElementMetaData lower(3);
+            lower.node_ID = {node_00, node_10, node_11};
+
+            ElementMetaData upper(3);
+            upper.node_ID = {node_00, node_11, node_01};
+
+            mesh_data.elements.insert({2 * (j * n_x + i), std::move(lower)});
+            mesh_data.elements.insert({2 * (j * n_x + i) + 1, std::move(upper)});
+        }
+    }
+
+    // face k lies opposite of node k, as in MeshMetaData(const AdcircFormat&)
+    std::map<std::pair<uint, uint>, std::pair<uint, uint>> edges;
+
+    for (auto& element_meta : mesh_data.elements) {
+        ElementMetaData& element = element_meta.second;
+
+        for (uint face = 0; face < 3; ++face) {
+            const uint node_a = element.node_ID[(face + 1) % 3];
+            const uint node_b = element.node_ID[(face + 2) % 3];
+
+            const std::pair<uint, uint> key{std::min(node_a, node_b), std::max(node_a, node_b)};
+
+            auto edge = edges.find(key);
+
+            if (edge == edges.end()) {
+                element.neighbor_ID[face]   = DEFAULT_ID;
+                element.boundary_type[face] = SWE::BoundaryTypes::land;
+
+                edges.insert({key, {element_meta.first, face}});
+            } else {
+                ElementMetaData& neighbor = mesh_data.elements.at(edge->second.first);
+
+                element.neighbor_ID[face]   = edge->second.first;
+                element.boundary_type[face] = SWE::BoundaryTypes::internal;
+
+                neighbor.neighbor_ID[edge->second.second]   = element_meta.first;
+                neighbor.boundary_type[edge->second.second] = SWE::BoundaryTypes::internal;
+            }
+        }
+    }
+
+    return mesh_data;
+}
+
+InputParameters<SWE::Inputs> make_input(const uint p, const uint n_subdivisions, const uint nstages) {
+    InputParameters<SWE::Inputs> input;
+
+    input.polynomial_order = p;
+
+    input.mesh_input.mesh_format         = "Benchmark";
+    input.mesh_input.mesh_coordinate_sys = CoordinateSystem::cartesian;
+    input.mesh_input.mesh_data           = make_rectangle_mesh(n_subdivisions, n_subdivisions, 100.0);
+
+    input.stepper_input.nstages       = nstages;
+    input.stepper_input.order         = nstages;
+    input.stepper_input.dt            = 1.0;
+    input.stepper_input.run_time      = 1.0;
+    input.stepper_input.ramp_duration = 0.0;
+
+    input.problem_input.wet_dry.type     = SWE::WettingDryingType::Enable;
+    input.problem_input.slope_limit.type = SWE::SlopeLimitingType::CockburnShu;
+
+    return input;
+}
+
+// perturbed free surface and discharge, so that fluxes and the slope limiter have work to do
+template <typename MeshType>
+void perturb_state(MeshType& mesh) {
+    mesh.CallForEachElement([](auto& elt) {
+        elt.data.state[0].q = elt.L2ProjectionF([](const Point<2>& pt) {
+            StatVector<double, SWE::n_variables> q;
+
+            q[SWE::Variables::ze] = 0.5 * std::sin(pt[GlobalCoord::x] / 300.0) * std::cos(pt[GlobalCoord::y] / 200.0);
+            q[SWE::Variables::qx] = std::cos(pt[GlobalCoord::y] / 400.0);
+            q[SWE::Variables::qy] = 0.5 * std::sin(pt[GlobalCoord::x] / 500.0);
+
+            return q;
+        });
+    });
+}
+
+void benchmark_LLF_flux(const Benchmark::Options& options, std::vector<Benchmark::Result>& results) {
+    constexpr uint n_points = 4096;
+
+    HybMatrix<double, SWE::n_variables> q_in(SWE::n_variables, n_points);
+    HybMatrix<double, SWE::n_variables> q_ex(SWE::n_variables, n_points);
+    HybMatrix<double, SWE::n_auxiliaries> aux_in(SWE::n_auxiliaries, n_points);
+    HybMatrix<double, SWE::n_dimensions> normal(SWE::n_dimensions, n_points);
+    HybMatrix<double, SWE::n_variables> F_hat(SWE::n_variables, n_points);
+
+    for (uint point = 0; point < n_points; ++point) {
+        const double angle = 2.0 * PI * point / n_points;
+
+        q_in(SWE::Variables::ze, point) = 0.1 * std::sin(angle);
+        q_in(SWE::Variables::qx, point) = std::cos(angle);
+        q_in(SWE::Variables::qy, point) = 0.5;
+        q_ex(SWE::Variables::ze, point) = 0.1 * std::cos(angle);
+        q_ex(SWE::Variables::qx, point) = 0.8;
+        q_ex(SWE::Variables::qy, point) = std::sin(angle);
+
+        aux_in(SWE::Auxiliaries::bath, point) = 10.0;
+        aux_in(SWE::Auxiliaries::h, point)    = 10.0 + q_in(SWE::Variables::ze, point);
+        aux_in(SWE::Auxiliaries::sp, point)   = 1.0;
+
+        normal(GlobalCoord::x, point) = std::cos(angle);
+        normal(GlobalCoord::y, point) = std::sin(angle);
+    }
+
+    results.push_back(Benchmark::run("LLF_flux", -1, n_points, options, [&]() {
+        for (uint point = 0; point < n_points; ++point) {
+            SWE::RKDG::LLF_flux(SWE::Global::g,
+                                column(q_in, point),
+                                column(q_ex, point),
+                                column(aux_in, point),
+                                column(normal, point),
+                                column(F_hat, point));
+        }
+    }));
+}
+
+void benchmark_rkdg(const uint p,
+                    const uint n_subdivisions,
+                    const Benchmark::Options& options,
+                    std::vector<Benchmark::Result>& results) {
+    using ProblemType = SWE::RKDG::Problem;
+
+    InputParameters<SWE::Inputs> input = make_input(p, n_subdivisions, 2);
+
+    ProblemType::initialize_problem_parameters(input.problem_input);
+
+    typename ProblemType::ProblemDiscretizationType discretization;
+    typename ProblemType::ProblemGlobalDataType global_data;
+
+    typename ProblemType::ProblemStepperType stepper(input.stepper_input);
+    typename ProblemType::ProblemWriterType writer(input.writer_input);
+
+    discretization.mesh = typename ProblemType::ProblemMeshType(p);
+    discretization.initialize(input, writer);
+
+    ProblemType::preprocessor_serial(discretization, global_data, stepper, input.problem_input);
+
+    perturb_state(discretization.mesh);
+
+    // one step sizes all work arrays and prepares the slope limiter data
+    for (uint stage = 0; stage < stepper.GetNumStages(); ++stage) {
+        ProblemType::stage_serial(discretization, global_data, stepper);
+    }
+
+    auto& mesh = discretization.mesh;
+
+    const uint n_elements   = mesh.GetNumberElements();
+    const uint n_interfaces = mesh.GetNumberInterfaces();
+    const uint n_boundaries = mesh.GetNumberBoundaries();
+
+    results.push_back(Benchmark::run("Element::ComputeUgp", p, n_elements, options, [&]() {
+        mesh.CallForEachElement([&stepper](auto& elt) {
+            elt.data.internal.q_at_gp = elt.ComputeUgp(elt.data.state[stepper.GetStage()].q);
+        });
+    }));
+
+    results.push_back(Benchmark::run("Element::IntegrationDPhi", p, n_elements, options, [&]() {
+        mesh.CallForEachElement([&stepper](auto& elt) {
+            auto& internal = elt.data.internal;
+
+            elt.data.state[stepper.GetStage()].rhs = elt.IntegrationDPhi(GlobalCoord::x, internal.Fx_at_gp) +
+                                                     elt.IntegrationDPhi(GlobalCoord::y, internal.Fy_at_gp);
+        });
+    }));
+
+    results.push_back(Benchmark::run("Element::ApplyMinv", p, n_elements, options, [&]() {
+        mesh.CallForEachElement([&stepper](auto& elt) {
+            auto& state = elt.data.state[stepper.GetStage()];
+
+            state.solution = elt.ApplyMinv(state.rhs);
+        });
+    }));
+
+    results.push_back(Benchmark::run("volume_kernel", p, n_elements, options, [&]() {
+        mesh.CallForEachElement([&stepper](auto& elt) { ProblemType::volume_kernel(stepper, elt); });
+    }));
+
+    results.push_back(Benchmark::run("source_kernel", p, n_elements, options, [&]() {
+        mesh.CallForEachElement([&stepper](auto& elt) { ProblemType::source_kernel(stepper, elt); });
+    }));
+
+    results.push_back(Benchmark::run("interface_kernel", p, n_interfaces, options, [&]() {
+        mesh.CallForEachInterface([&stepper](auto& intface) { ProblemType::interface_kernel(stepper, intface); });
+    }));
+
+    results.push_back(Benchmark::run("boundary_kernel", p, n_boundaries, options, [&]() {
+        mesh.CallForEachBoundary([&stepper](auto& bound) { ProblemType::boundary_kernel(stepper, bound); });
+    }));
+
+    results.push_back(Benchmark::run("wetting_drying_kernel", p, n_elements, options, [&]() {
+        mesh.CallForEachElement([&stepper](auto& elt) { SWE::wetting_drying_kernel(stepper, elt); });
+    }));
+
+    results.push_back(Benchmark::run("slope_limiting_kernel", p, n_elements, options, [&]() {
+        mesh.CallForEachElement([&stepper](auto& elt) { SWE::slope_limiting_kernel(stepper, elt); });
+    }));
+}
+
+#ifdef IHDG_SUPPORT
+void benchmark_ihdg(const uint p,
+                    const uint n_subdivisions,
+                    const Benchmark::Options& options,
+                    std::vector<Benchmark::Result>& results) {
+    using ProblemType = SWE::IHDG::Problem;
+
+    InputParameters<SWE::Inputs> input = make_input(p, n_subdivisions, 1);
+
+    // the slope limiter and wetting and drying are not part of the implicit solve
+    input.problem_input.wet_dry.type     = SWE::WettingDryingType::None;
+    input.problem_input.slope_limit.type = SWE::SlopeLimitingType::None;
+
+    ProblemType::initialize_problem_parameters(input.problem_input);
+
+    // initialize_problem_parameters only sets the flags, which the explicit benchmarks have set
+    SWE::PostProcessing::wetting_drying = false;
+    SWE::PostProcessing::slope_limiting = false;
+
+    HDGDiscretization<ProblemType> discretization;
+    typename ProblemType::ProblemGlobalDataType global_data;
+
+    typename ProblemType::ProblemStepperType stepper(input.stepper_input);
+    typename ProblemType::ProblemWriterType writer(input.writer_input);
+
+    discretization.mesh = typename ProblemType::ProblemMeshType(p);
+    discretization.initialize(input, writer);
+
+    ProblemType::preprocessor_serial(discretization, global_data, stepper, input.problem_input);
+
+    perturb_state(discretization.mesh);
+
+    auto& mesh          = discretization.mesh;
+    auto& mesh_skeleton = discretization.mesh_skeleton;
+
+    const auto init_iteration = [&]() { ProblemType::init_iteration(stepper, discretization); };
+
+    const auto local_assembly = [&]() {
+        mesh.CallForEachElement([&stepper](auto& elt) {
+            ProblemType::local_volume_kernel(stepper, elt);
+            ProblemType::local_source_kernel(stepper, elt);
+        });
+
+        mesh.CallForEachInterface(
+            [&stepper](auto& intface) { ProblemType::local_interface_kernel(stepper, intface); });
+
+        mesh.CallForEachBoundary([&stepper](auto& bound) { ProblemType::local_boundary_kernel(stepper, bound); });
+
+        mesh_skeleton.CallForEachEdgeInterface(
+            [&stepper](auto& edge_int) { ProblemType::local_edge_interface_kernel(stepper, edge_int); });
+
+        mesh_skeleton.CallForEachEdgeBoundary(
+            [&stepper](auto& edge_bound) { ProblemType::local_edge_boundary_kernel(stepper, edge_bound); });
+    };
+
+    const auto global_assembly = [&]() {
+        mesh_skeleton.CallForEachEdgeInterface(
+            [&stepper](auto& edge_int) { ProblemType::global_edge_interface_kernel(stepper, edge_int); });
+
+        mesh_skeleton.CallForEachEdgeBoundary(
+            [&stepper](auto& edge_bound) { ProblemType::global_edge_boundary_kernel(stepper, edge_bound); });
+    };
+
+    const uint n_elements = mesh.GetNumberElements();
+    const uint n_edges    = mesh_skeleton.GetNumberEdgeInterfaces() + mesh_skeleton.GetNumberEdgeBoundaries();
+
+    results.push_back(Benchmark::run("ihdg_local_assembly", p, n_elements, options, init_iteration, local_assembly));
+
+    results.push_back(Benchmark::run("ihdg_edge_assembly",
+                                     p,
+                                     n_edges,
+                                     options,
+                                     [&]() {
+                                         init_iteration();
+                                         local_assembly();
+                                     },
+                                     global_assembly));
+
+    // condensation into the sparse global matrix, solve_sle and back substitution of one Newton iteration
+    results.push_back(Benchmark::run("ihdg_global_assembly_solve",
+                                     p,
+                                     n_edges,
+                                     options,
+                                     [&]() {
+                                         init_iteration();
+                                         local_assembly();
+                                         global_assembly();
+                                     },
+                                     [&]() {
+                                         ProblemType::serial_solve_global_problem(discretization, global_data, stepper);
+                                     }));
+
+    // the global matrix assembled by the last Newton iteration
+    SparseMatrix<double>& delta_hat_global = global_data.delta_hat_global;
+    DynVector<double> rhs_global;
+
+    results.push_back(Benchmark::run("solve_sle",
+                                     p,
+                                     rows(delta_hat_global),
+                                     options,
+                                     [&]() {
+                                         rhs_global.resize(rows(delta_hat_global));
+                                         set_constant(rhs_global, 1.0);
+                                     },
+                                     [&]() { solve_sle(delta_hat_global, rhs_global); }));
+}
+#endif
+
+int main(int argc, char* argv[]) {
+    if (argc > 5) {
+        std::cerr << "Usage\n"
+                  << "    /path/to/benchmark_kernels [output_file] [n_subdivisions] [p_max] [repetitions]\n"
+                  << "    defaults: benchmark_kernels.json 32 5 20\n";
+        return 1;
+    }
+
+    const std::string output_file = argc > 1 ? std::string(argv[1]) : "benchmark_kernels.json";
+    const uint n_subdivisions     = argc > 2 ? std::stoi(argv[2]) : 32;
+    const uint p_max              = argc > 3 ? std::stoi(argv[3]) : 5;
+
+    Benchmark::Options options;
+
+    if (argc > 4) {
+        options.repetitions = std::stoi(argv[4]);
+    }
+
+    std::vector<Benchmark::Result> results;
+
+    std::cout << "Benchmarking kernels on a " << n_subdivisions << " x " << n_subdivisions << " rectangle of "
+              << 2 * n_subdivisions * n_subdivisions << " elements" << std::endl
+              << std::left << std::setw(36) << "kernel" << std::right << std::setw(4) << "p" << std::setw(10)
+              << "items" << std::setw(13) << "median (s)" << std::setw(13) << "min (s)" << std::setw(13)
+              << "stddev (s)" << std::setw(14) << "ns per item" << std::endl;
+
+    benchmark_LLF_flux(options, results);
+    Benchmark::write_summary(std::cout, results.back());
+
+    // the linear projections of the triangle master, used by wetting and drying and the slope limiter, need p >= 1
+    for (uint p = 1; p <= p_max; ++p) {
+        const std::size_t first = results.size();
+
+        benchmark_rkdg(p, n_subdivisions, options, results);
+
+#ifdef IHDG_SUPPORT
+        // the sparse direct solve grows fastest, the implicit benchmarks run on a quarter of the elements
+        benchmark_ihdg(p, std::max(n_subdivisions / 2, 1u), options, results);
+#endif
+
+        for (std::size_t id = first; id < results.size(); ++id) {
+            Benchmark::write_summary(std::cout, results[id]);
+        }
+    }
+
+    Benchmark::write_json(output_file, options, results);
+
+    return 0;
+}
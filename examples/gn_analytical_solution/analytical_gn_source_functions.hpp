@@ -1,6 +1,8 @@
 #ifndef GN_SOURCE_FUNCTIONS_HPP
 #define GN_SOURCE_FUNCTIONS_HPP
 
+#include "utilities/function_table.hpp"
+
 namespace SWE {
 inline StatVector<double, SWE::n_variables> source_q(const double t, const Point<2>& pt) {
     double source_ze = 0.0;
@@ -11,6 +13,20 @@ inline StatVector<double, SWE::n_variables> source_q(const double t, const Point
 
     return source_q;
 }
+
+// Batched source_q at the gauss points of an element, see Utilities::TimeDependence
+struct SourceFunction {
+    static constexpr Utilities::TimeDependence time_dependence = Utilities::TimeDependence::independent;
+
+    static double time_factor(const double t) { return 1.0; }
+
+    template <typename ValuesType>
+    static void evaluate(const double t, const AlignedVector<Point<2>>& points, ValuesType& values) {
+        for (uint pt = 0; pt < points.size(); ++pt) {
+            column(values, pt) = SWE::source_q(t, points[pt]);
+        }
+    }
+};
 }
 
 #endif
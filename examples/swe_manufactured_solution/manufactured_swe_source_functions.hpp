@@ -1,6 +1,8 @@
 #ifndef SWE_SOURCE_FUNCTIONS_HPP
 #define SWE_SOURCE_FUNCTIONS_HPP
 
+#include "utilities/function_table.hpp"
+
 namespace SWE {
 inline StatVector<double, SWE::n_variables> source_q(const double t, const Point<2>& pt) {
     const double x = pt[GlobalCoord::x];
@@ -102,6 +104,20 @@ inline StatVector<double, SWE::n_variables> source_q(const double t, const Point
 
     return source_q;
 }
+
+// Batched source_q at the gauss points of an element, see Utilities::TimeDependence
+struct SourceFunction {
+    static constexpr Utilities::TimeDependence time_dependence = Utilities::TimeDependence::general;
+
+    static double time_factor(const double t) { return 1.0; }
+
+    template <typename ValuesType>
+    static void evaluate(const double t, const AlignedVector<Point<2>>& points, ValuesType& values) {
+        for (uint pt = 0; pt < points.size(); ++pt) {
+            column(values, pt) = SWE::source_q(t, points[pt]);
+        }
+    }
+};
 }
 
 #endif
@@ -17,10 +17,15 @@ std::vector<std::vector<MeshMetaData>> partition(const MeshMetaData& mesh_meta,
                                                  const int ranks_per_locality,
                                                  const bool rank_balanced);
 
-void write_distributed_edge_metadata(const std::string& file_name,
-                                     const InputParameters<>& input,
-                                     const MeshMetaData& mesh_meta,
-                                     const std::vector<std::vector<MeshMetaData>>& submeshes);
+std::vector<std::vector<DistributedBoundaryMetaData>> make_distributed_edge_metadata(
+    const InputParameters<>& input,
+    const MeshMetaData& mesh_meta,
+    const std::vector<std::vector<MeshMetaData>>& submeshes);
+
+void write_ghost_layer_metadata(const std::string& file_name,
+                                const MeshMetaData& mesh_meta,
+                                std::vector<std::vector<MeshMetaData>>& submeshes,
+                                const uint n_ghost_layers);
 
 int main(int argc, char** argv) {
     std::cout << "?????????????????????????????????????????????????????????????"
@@ -41,6 +46,11 @@ int main(int argc, char** argv) {
 
     std::cout << "Mesh Partitioner Configuration\n";
     InputParameters<> input(argv[1]);
+
+    if (input.mesh_input.mesh_format == "Binary") {
+        throw std::logic_error("Fatal Error: the partitioner reads Adcirc or Meta meshes, " +
+                               input.mesh_input.mesh_file_name + " is already partitioned\n");
+    }
     std::cout << "  Input File: " << argv[1] << '\n';
     std::string input_mesh_str(input.mesh_input.mesh_file_name);
     std::cout << "  Mesh Path: " << input_mesh_str << '\n';
@@ -56,11 +66,15 @@ int main(int argc, char** argv) {
     };
 
     bool rank_balanced{false};
-    if (argc == 6) {
+    if (argc >= 6) {
         std::stringstream ss(argv[5]);
         ss >> std::boolalpha >> rank_balanced;
     }
-    std::cout << std::boolalpha << "  Rank balanced: " << rank_balanced << "\n\n";
+    std::cout << std::boolalpha << "  Rank balanced: " << rank_balanced << '\n';
+
+    // every stage invalidates the outermost layer whose states are still correct
+    const uint n_ghost_layers = input.communicator_input.ghost_layers ? input.stepper_input.nstages : 0;
+    std::cout << "  Number of ghost layers: " << n_ghost_layers << "\n\n";
 
     auto t1 = std::chrono::high_resolution_clock::now();
 
@@ -83,20 +97,31 @@ int main(int argc, char** argv) {
     std::vector<std::vector<MeshMetaData>> submeshes = partition(
         mesh_meta, problem_inputs->GetWeights(), num_partitions, num_nodes, ranks_per_locality, rank_balanced);
 
+    std::vector<std::vector<DistributedBoundaryMetaData>> dbmd_data;
+
+    if (n_ghost_layers > 0) {
+        // submeshes overlapping by the ghost layers share no distributed boundaries
+        write_ghost_layer_metadata(input_mesh_str, mesh_meta, submeshes, n_ghost_layers);
+
+        for (auto& loc_submeshes : submeshes) {
+            dbmd_data.emplace_back(loc_submeshes.size());
+        }
+    } else {
+        dbmd_data = make_distributed_edge_metadata(input, mesh_meta, submeshes);
+    }
+
     for (uint n = 0; n < submeshes.size(); ++n) {
         for (uint m = 0; m < submeshes[n].size(); ++m) {
             std::string outname = input_mesh_str;
             outname             = outname.substr(0, outname.find_last_of("."));
 
             outname += "_" + std::to_string(static_cast<long long>(n)) + "_" +
-                       std::to_string(static_cast<long long>(m)) + ".meta";
+                       std::to_string(static_cast<long long>(m)) + ".dgm";
 
-            submeshes[n][m].write_to(outname);
+            BinaryMeshData::write_to(outname, submeshes[n][m], dbmd_data[n][m]);
         }
     }
 
-    write_distributed_edge_metadata(input_mesh_str, input, mesh_meta, submeshes);
-
     problem_inputs->PartitionAuxiliaryFiles();
 
     // finish out by writing updated output file
@@ -104,8 +129,8 @@ int main(int argc, char** argv) {
     updated_input_filename.erase(updated_input_filename.size() - 3);
     updated_input_filename += "_parallelized.15";
     input.mesh_input.mesh_file_name =
-        input.mesh_input.mesh_file_name.substr(0, input.mesh_input.mesh_file_name.find_last_of(".")) + ".meta";
-    input.mesh_input.mesh_format = "Meta";
+        input.mesh_input.mesh_file_name.substr(0, input.mesh_input.mesh_file_name.find_last_of(".")) + ".dgm";
+    input.mesh_input.mesh_format = "Binary";
     input.write_to(updated_input_filename);
 
     auto t2 = std::chrono::high_resolution_clock::now();
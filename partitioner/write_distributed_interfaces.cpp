@@ -5,11 +5,11 @@
 #include <deque>
 #include <unordered_set>
 
-void write_distributed_edge_metadata(const std::string& file_name,
-                                     const InputParameters<>& input,
-                                     const MeshMetaData& mesh_meta,
-                                     const std::vector<std::vector<MeshMetaData>>& submeshes) {
-    std::size_t num_loc = submeshes.size();
+std::vector<std::vector<DistributedBoundaryMetaData>> make_distributed_edge_metadata(
+    const InputParameters<>& input,
+    const MeshMetaData& mesh_meta,
+    const std::vector<std::vector<MeshMetaData>>& submeshes) {
+    const uint num_loc = submeshes.size();
 
     std::unordered_set<std::pair<uint, uint>> faces;
     // assemble faces shared across elements
@@ -80,26 +80,38 @@ void write_distributed_edge_metadata(const std::string& file_name,
         shared_faces[rnk_pair].push_back(std::move(dist_int));
     }
 
+    std::vector<std::vector<DistributedBoundaryMetaData>> dbmd_data(submeshes.size());
     for (uint loc_id = 0; loc_id < submeshes.size(); ++loc_id) {
-        for (uint sbmsh_id = 0; sbmsh_id < submeshes[loc_id].size(); ++sbmsh_id) {
-            std::string distributed_meta_filename = file_name;
-            distributed_meta_filename =
-                distributed_meta_filename.substr(0, distributed_meta_filename.find_last_of("."));
-            std::ofstream file(distributed_meta_filename + '_' + std::to_string(loc_id) + '_' +
-                               std::to_string(sbmsh_id) + ".dbmd");
-            for (auto& sf : shared_faces) {
-                uint locA   = sf.first.first % num_loc;
-                uint sbmshA = sf.first.first / num_loc;
-
-                uint locB   = sf.first.second % num_loc;
-                uint sbmshB = sf.first.second / num_loc;
-                if ((locA == loc_id && sbmshA == sbmsh_id) || (locB == loc_id && sbmshB == sbmsh_id)) {
-                    file << locA << " " << sbmshA << " " << locB << " " << sbmshB << " " << sf.second.size() << '\n';
-                    for (auto& dist_int : sf.second) {
-                        file << dist_int << '\n';
-                    }
-                }
+        dbmd_data[loc_id].resize(submeshes[loc_id].size());
+    }
+
+    // every rank boundary is stored on both sides, oriented so that the in side is the submesh holding it
+    for (auto& sf : shared_faces) {
+        std::array<uint, 2> loc{sf.first.first % num_loc, sf.first.second % num_loc};
+        std::array<uint, 2> sbmsh{sf.first.first / num_loc, sf.first.second / num_loc};
+
+        for (uint side = 0; side < 2; ++side) {
+            RankBoundaryMetaData rank_boundary;
+
+            rank_boundary.locality_in = loc[side];
+            rank_boundary.locality_ex = loc[1 - side];
+
+            rank_boundary.submesh_in = sbmsh[side];
+            rank_boundary.submesh_ex = sbmsh[1 - side];
+
+            for (auto& dist_int : sf.second) {
+                rank_boundary.elements_in.push_back(side == 0 ? dist_int.elements.first : dist_int.elements.second);
+                rank_boundary.elements_ex.push_back(side == 0 ? dist_int.elements.second : dist_int.elements.first);
+
+                rank_boundary.bound_ids_in.push_back(side == 0 ? dist_int.bound_ids.first : dist_int.bound_ids.second);
+                rank_boundary.bound_ids_ex.push_back(side == 0 ? dist_int.bound_ids.second : dist_int.bound_ids.first);
+
+                rank_boundary.p.push_back(dist_int.p);
             }
+
+            dbmd_data[loc[side]][sbmsh[side]].rank_boundary_data.push_back(std::move(rank_boundary));
         }
     }
+
+    return dbmd_data;
 }
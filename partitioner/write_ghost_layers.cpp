@@ -0,0 +1,137 @@
+#include "preprocessor/mesh_metadata.hpp"
+#include "problem/SWE/swe_definitions.hpp"
+#include "util.hpp"
+
+#include <unordered_set>
+
+// Adds the ghost layers to every submesh and writes the ghost elements exchanged with each neighboring submesh.
+// Edges between owned elements and ghosts become regular internal edges, the outer edges of the last layer are closed
+// as land boundaries. The states behind these edges are wrong, but they only reach one more layer per stage.
+void write_ghost_layer_metadata(const std::string& file_name,
+                                const MeshMetaData& mesh_meta,
+                                std::vector<std::vector<MeshMetaData>>& submeshes,
+                                const uint n_ghost_layers) {
+    std::size_t num_loc = submeshes.size();
+
+    std::unordered_map<uint, uint> elt2partition;
+    for (uint loc_id = 0; loc_id < submeshes.size(); ++loc_id) {
+        for (uint sbmsh_id = 0; sbmsh_id < submeshes[loc_id].size(); ++sbmsh_id) {
+            for (auto& elt : submeshes[loc_id][sbmsh_id].elements) {
+                elt2partition.insert(std::make_pair(elt.first, loc_id + num_loc * sbmsh_id));
+            }
+        }
+    }
+
+    // ghost_layers[partition] maps ghost element ID to layer it belongs to (layer 1 touches the submesh)
+    std::unordered_map<uint, std::unordered_map<uint, uint>> ghost_layers;
+    for (uint loc_id = 0; loc_id < submeshes.size(); ++loc_id) {
+        for (uint sbmsh_id = 0; sbmsh_id < submeshes[loc_id].size(); ++sbmsh_id) {
+            const MeshMetaData& submesh = submeshes[loc_id][sbmsh_id];
+            const uint partition        = loc_id + num_loc * sbmsh_id;
+
+            std::unordered_map<uint, uint>& ghosts = ghost_layers[partition];
+
+            std::unordered_set<uint> front;
+            for (auto& elt : submesh.elements) {
+                front.insert(elt.first);
+            }
+
+            for (uint layer = 1; layer <= n_ghost_layers; ++layer) {
+                std::unordered_set<uint> next_front;
+                for (uint elt_id : front) {
+                    const ElementMetaData& elt_meta = mesh_meta.elements.at(elt_id);
+                    for (uint k = 0; k < elt_meta.neighbor_ID.size(); ++k) {
+                        const uint neigh = elt_meta.neighbor_ID[k];
+                        if (neigh != DEFAULT_ID && !submesh.elements.count(neigh) && !ghosts.count(neigh)) {
+                            ghosts.insert(std::make_pair(neigh, layer));
+                            next_front.insert(neigh);
+                        }
+                    }
+                }
+                front = std::move(next_front);
+            }
+        }
+    }
+
+    for (uint loc_id = 0; loc_id < submeshes.size(); ++loc_id) {
+        for (uint sbmsh_id = 0; sbmsh_id < submeshes[loc_id].size(); ++sbmsh_id) {
+            const uint partition = loc_id + num_loc * sbmsh_id;
+
+            std::string ghost_meta_filename = file_name;
+            ghost_meta_filename = ghost_meta_filename.substr(0, ghost_meta_filename.find_last_of(".")) + '_' +
+                                  std::to_string(loc_id) + '_' + std::to_string(sbmsh_id);
+
+            // ghost elements received from and sent to each neighboring partition
+            std::map<uint, std::vector<std::pair<uint, uint>>> receive_ghosts;
+            std::map<uint, std::vector<std::pair<uint, uint>>> send_ghosts;
+
+            for (auto& ghost : ghost_layers.at(partition)) {
+                receive_ghosts[elt2partition.at(ghost.first)].push_back(ghost);
+            }
+
+            for (auto& neigh_ghosts : ghost_layers) {
+                if (neigh_ghosts.first == partition) {
+                    continue;
+                }
+                for (auto& ghost : neigh_ghosts.second) {
+                    if (elt2partition.at(ghost.first) == partition) {
+                        send_ghosts[neigh_ghosts.first].push_back(ghost);
+                    }
+                }
+            }
+
+            std::set<uint> neighbors;
+            for (auto& rg : receive_ghosts) {
+                neighbors.insert(rg.first);
+            }
+            for (auto& sg : send_ghosts) {
+                neighbors.insert(sg.first);
+            }
+
+            std::ofstream file(ghost_meta_filename + ".ghmd");
+            for (uint neigh : neighbors) {
+                // sort by element ID so that both sides agree on the message layout
+                std::vector<std::pair<uint, uint>>& receive = receive_ghosts[neigh];
+                std::vector<std::pair<uint, uint>>& send    = send_ghosts[neigh];
+                std::sort(receive.begin(), receive.end());
+                std::sort(send.begin(), send.end());
+
+                file << loc_id << " " << sbmsh_id << " " << neigh % num_loc << " " << neigh / num_loc << " "
+                     << receive.size() << " " << send.size() << '\n';
+                for (auto& ghost : receive) {
+                    file << ghost.first << " " << ghost.second << '\n';
+                }
+                for (auto& ghost : send) {
+                    file << ghost.first << " " << ghost.second << '\n';
+                }
+            }
+        }
+    }
+
+    for (uint loc_id = 0; loc_id < submeshes.size(); ++loc_id) {
+        for (uint sbmsh_id = 0; sbmsh_id < submeshes[loc_id].size(); ++sbmsh_id) {
+            MeshMetaData& submesh = submeshes[loc_id][sbmsh_id];
+
+            // restore the edges cut by the partition, they are all covered by the first layer
+            for (auto& elt : submesh.elements) {
+                elt.second.boundary_type = mesh_meta.elements.at(elt.first).boundary_type;
+            }
+
+            for (auto& ghost : ghost_layers.at(loc_id + num_loc * sbmsh_id)) {
+                submesh.elements.insert(std::make_pair(ghost.first, mesh_meta.elements.at(ghost.first)));
+                for (uint id : mesh_meta.elements.at(ghost.first).node_ID) {
+                    submesh.nodes[id] = mesh_meta.nodes.at(id);
+                }
+            }
+
+            for (auto& elt : submesh.elements) {
+                for (uint k = 0; k < elt.second.neighbor_ID.size(); ++k) {
+                    if (elt.second.neighbor_ID[k] != DEFAULT_ID && !submesh.elements.count(elt.second.neighbor_ID[k])) {
+                        elt.second.neighbor_ID[k]   = DEFAULT_ID;
+                        elt.second.boundary_type[k] = SWE::BoundaryTypes::land;
+                    }
+                }
+            }
+        }
+    }
+}
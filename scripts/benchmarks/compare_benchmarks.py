@@ -0,0 +1,47 @@
+import json
+import sys
+
+# Compares two kernel benchmark files written by benchmark_kernels and reports the change of the median time of every
+# kernel and polynomial order found in both. Exits with 1 if any kernel got slower by more than the threshold.
+#
+# usage: python compare_benchmarks.py baseline_file new_file [threshold]
+#   threshold: relative slowdown reported as a regression, 0.1 by default
+
+def read_results(file_name):
+    with open(file_name) as f:
+        benchmark = json.load(f)
+    return benchmark, {(result['kernel'], result['p']): result for result in benchmark['results']}
+
+if __name__ == '__main__':
+    if len(sys.argv) not in (3, 4):
+        print('usage: python compare_benchmarks.py baseline_file new_file [threshold]')
+        sys.exit(1)
+
+    threshold = float(sys.argv[3]) if len(sys.argv) == 4 else 0.1
+
+    baseline, baseline_results = read_results(sys.argv[1])
+    new, new_results = read_results(sys.argv[2])
+
+    if baseline['backend'] != new['backend']:
+        print('warning: comparing the ' + baseline['backend'] + ' backend to the ' + new['backend'] + ' backend')
+
+    print('{:<36}{:>4}{:>16}{:>16}{:>10}'.format('kernel', 'p', 'baseline (ns)', 'new (ns)', 'change'))
+
+    regressions = []
+    for key in sorted(new_results, key=lambda key: (key[1], key[0])):
+        if key not in baseline_results:
+            continue
+
+        baseline_ns = baseline_results[key]['ns_per_item']
+        new_ns = new_results[key]['ns_per_item']
+        change = new_ns / baseline_ns - 1.0 if baseline_ns > 0.0 else 0.0
+
+        print('{:<36}{:>4}{:>16.1f}{:>16.1f}{:>9.1f}%'.format(key[0], key[1], baseline_ns, new_ns, 100.0 * change))
+
+        if change > threshold:
+            regressions.append(key)
+
+    for kernel, p in regressions:
+        print('regression: ' + kernel + ' at p = ' + str(p))
+
+    sys.exit(1 if regressions else 0)
@@ -0,0 +1,299 @@
+import argparse
+import datetime
+import json
+import math
+import os
+import re
+import subprocess
+import sys
+
+# Strong and weak scaling benchmark of the serial, OMPI and HPX executables on a single node.
+# For every worker count (ranks x threads) a rectangular mesh is generated with quad_mesh_generator, partitioned into
+# one submesh per worker (times --submeshes-per-worker) and run with a constant state, tide forcing on one side and
+# land boundaries elsewhere. Reports the throughput in element stages per second, elements x stages x steps / wall
+# time, and the parallel efficiency, throughput / (workers x throughput per worker of the reference run). The
+# reference run is the serial run, or else the run with the fewest workers. The per-phase breakdown is read from
+# kernel_timers.json, which the executables only write when built with the cmake option KERNEL_TIMERS.
+#
+# strong scaling: every run uses the same num_subdivisions x num_subdivisions mesh
+# weak scaling: the mesh of a run with n workers has num_subdivisions x sqrt(n) subdivisions along each side
+#
+# usage: python scaling_benchmark.py build_dir [options], see python scaling_benchmark.py --help
+#   build_dir: cmake build directory holding mesh_generators/, partitioner/ and source/
+#
+# e.g. python scaling_benchmark.py ~/dgswemv2/build --mode weak --ranks 1 2 4 8 --threads 1 --executables serial ompi
+
+TIME_ELAPSED = re.compile(r'Time Elapsed \(in us\): (\d+)')
+
+def parse_arguments():
+    parser = argparse.ArgumentParser(description='Strong and weak scaling benchmark of dgswemv2')
+    parser.add_argument('build_dir', help='cmake build directory')
+    parser.add_argument('--work-dir', default='scaling_benchmark', help='directory the runs are set up in')
+    parser.add_argument('--output', default='scaling_benchmark.json', help='JSON report')
+    parser.add_argument('--mode', choices=['strong', 'weak'], default='strong')
+    parser.add_argument('--executables', nargs='+', choices=['serial', 'ompi', 'hpx'],
+                        default=['serial', 'ompi', 'hpx'])
+    parser.add_argument('--ranks', nargs='+', type=int, default=[1, 2, 4], help='MPI rank counts of the OMPI runs')
+    parser.add_argument('--threads', nargs='+', type=int, default=[1],
+                        help='OpenMP threads per rank of the OMPI runs, and HPX threads of the HPX runs')
+    parser.add_argument('--submeshes-per-worker', type=int, default=1)
+    parser.add_argument('--num-subdivisions', type=int, default=64,
+                        help='subdivisions along each side of the mesh, of a single worker for weak scaling')
+    parser.add_argument('--element-size', type=float, default=1000.0, help='length of the element sides in m')
+    parser.add_argument('--polynomial-order', type=int, default=2)
+    parser.add_argument('--nstages', type=int, default=3)
+    parser.add_argument('--steps', type=int, default=100)
+    parser.add_argument('--problem', default='rkdg_swe')
+    parser.add_argument('--repetitions', type=int, default=3, help='runs per configuration, the fastest is reported')
+    parser.add_argument('--mpirun', default='mpirun', help='MPI launcher, with its options')
+    parser.add_argument('--hpx-args', default='', help='additional options of the HPX runs')
+    return parser.parse_args()
+
+def run(command, cwd, env=None):
+    result = subprocess.run(command, cwd=cwd, env=env, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                            universal_newlines=True)
+    if result.returncode != 0:
+        print(result.stdout)
+        raise RuntimeError('command failed: ' + ' '.join(command))
+    return result.stdout
+
+def write_mesh_generator_input(file_name, n_subdivisions, element_size):
+    length = n_subdivisions * element_size
+    with open(file_name, 'w') as f:
+        f.write('x1: 0\ny1: 0\n\n'
+                'x2: {0}\ny2: 0\n\n'
+                'x3: {0}\ny3: {0}\n\n'
+                'x4: 0\ny4: {0}\n\n'
+                'num_x_subdivisions: {1}\n'
+                'num_y_subdivisions: {1}\n\n'
+                'pattern: 0\n\n'
+                'boundary:\n'
+                '  - type: land\n'
+                '  - type: tide\n'
+                '    frequency: 0.00014051891708\n'
+                '    forcing_factor: 0.1\n'
+                '    equilibrium_argument: 0\n'
+                '  - type: land\n'
+                '  - type: land\n\n'
+                'mesh_name: quad_mesh\n'.format(length, n_subdivisions))
+
+def write_input(file_name, args):
+    dt, run_seconds = time_step(args)
+    start = datetime.datetime(2000, 1, 1)
+    end = start + datetime.timedelta(seconds=run_seconds)
+    time_format = '%d-%m-%Y %H:%M:%S'
+    with open(file_name, 'w') as f:
+        f.write('mesh:\n'
+                '  format: Adcirc\n'
+                '  file_name: quad_mesh.14\n'
+                '  coordinate_system: cartesian\n\n'
+                'timestepping:\n'
+                '  start_time: ' + start.strftime(time_format) + '\n'
+                '  end_time: ' + end.strftime(time_format) + '\n'
+                '  dt: ' + repr(dt) + '\n'
+                '  order: ' + str(min(args.nstages, 3)) + '\n'
+                '  nstages: ' + str(args.nstages) + '\n\n'
+                'polynomial_order: ' + str(args.polynomial_order) + '\n\n'
+                'problem:\n'
+                '  name: ' + args.problem + '\n'
+                '  gravity: 9.81\n'
+                '  initial_conditions:\n'
+                '    type: Constant\n'
+                '    initial_surface_height: 0\n'
+                '    initial_momentum_x: 0\n'
+                '    initial_momentum_y: 0\n\n'
+                'output:\n'
+                '  path: output\n')
+
+def time_step(args):
+    # CFL limit of an explicit DG scheme for the wave speed over the 1.5 m deep bathymetry of quad_mesh_generator
+    dt = 0.25 * args.element_size / (math.sqrt(9.81 * 1.5) * (2 * args.polynomial_order + 1))
+
+    # the run time is read in whole seconds, so shorten the time step until the steps span whole seconds
+    run_seconds = math.floor(args.steps * dt)
+    if run_seconds < 1:
+        raise RuntimeError('time step too small for whole second run times, increase --element-size or --steps')
+
+    dt = run_seconds / args.steps
+    while math.ceil(run_seconds / dt) > args.steps:
+        dt = dt * (1.0 + 1.0e-12)
+
+    return dt, run_seconds
+
+def count_elements(mesh_file):
+    with open(mesh_file) as f:
+        f.readline()
+        return int(f.readline().split()[0])
+
+def read_phases(output_dir):
+    file_name = os.path.join(output_dir, 'kernel_timers.json')
+    if not os.path.isfile(file_name):
+        return None
+
+    with open(file_name) as f:
+        timers = json.load(f)
+
+    phases = {phase: timers['total'][phase]['seconds'] for phase in timers['phases']}
+
+    # imbalance max / mean over ranks of the time not spent waiting for communication
+    busy = [sum(seconds['seconds'] for phase, seconds in rank['timers'].items()
+                if phase not in ('halo_wait', 'comm_complete')) for rank in timers['ranks']]
+    mean = sum(busy) / len(busy) if busy else 0.0
+
+    return {'seconds': phases, 'imbalance': max(busy) / mean if mean > 0.0 else 1.0}
+
+def configurations(args):
+    if 'serial' in args.executables:
+        yield 'serial', 1, 1
+    if 'ompi' in args.executables:
+        for ranks in args.ranks:
+            for threads in args.threads:
+                yield 'ompi', ranks, threads
+    if 'hpx' in args.executables:
+        for threads in args.threads:
+            yield 'hpx', 1, threads
+
+def set_up_mesh(args, workers):
+    n_subdivisions = args.num_subdivisions
+    if args.mode == 'weak':
+        n_subdivisions = int(round(args.num_subdivisions * math.sqrt(workers)))
+
+    case_dir = os.path.abspath(os.path.join(args.work_dir, 'mesh_' + str(n_subdivisions)))
+    os.makedirs(os.path.join(case_dir, 'output'), exist_ok=True)
+
+    if not os.path.isfile(os.path.join(case_dir, 'quad_mesh.14')):
+        write_mesh_generator_input(os.path.join(case_dir, 'mesh_generator_input.yml'), n_subdivisions,
+                                   args.element_size)
+        run([os.path.join(args.build_dir, 'mesh_generators', 'quad_mesh_generator'), 'mesh_generator_input.yml'],
+            case_dir)
+
+    write_input(os.path.join(case_dir, 'dgswemv2_input.15'), args)
+
+    return case_dir
+
+def run_configuration(args, executable, ranks, threads):
+    workers = ranks * threads
+    case_dir = set_up_mesh(args, workers)
+
+    binary = os.path.join(args.build_dir, 'source', 'dgswemv2-' + executable)
+    env = dict(os.environ)
+
+    if executable == 'serial':
+        command = [binary, 'dgswemv2_input.15']
+    else:
+        # the partitioner overwrites the submeshes of the previous configuration
+        n_partitions = workers * args.submeshes_per_worker
+        run([os.path.join(args.build_dir, 'partitioner', 'partitioner'), 'dgswemv2_input.15', str(n_partitions), '1',
+             str(ranks)], case_dir)
+
+        if executable == 'ompi':
+            env['OMP_NUM_THREADS'] = str(threads)
+            command = args.mpirun.split() + ['-np', str(ranks), binary, 'dgswemv2_input_parallelized.15']
+        else:
+            command = [binary, 'dgswemv2_input_parallelized.15', '--hpx:threads=' + str(threads)]
+            command += args.hpx_args.split()
+
+    timers_file = os.path.join(case_dir, 'output', 'kernel_timers.json')
+
+    best = None
+    for repetition in range(args.repetitions):
+        if os.path.isfile(timers_file):
+            os.remove(timers_file)
+
+        print('  ' + ' '.join(command))
+        stdout = run(command, case_dir, env)
+
+        elapsed = [int(us) for us in TIME_ELAPSED.findall(stdout)]
+        if not elapsed:
+            raise RuntimeError('no elapsed time reported by ' + binary)
+
+        seconds = 1.0e-6 * max(elapsed)
+        if best is None or seconds < best['seconds']:
+            best = {'seconds': seconds, 'phases': read_phases(os.path.join(case_dir, 'output'))}
+
+    n_elements = count_elements(os.path.join(case_dir, 'quad_mesh.14'))
+
+    return {
+        'executable': executable,
+        'ranks': ranks,
+        'threads': threads,
+        'workers': workers,
+        'elements': n_elements,
+        'seconds': best['seconds'],
+        'throughput': n_elements * args.nstages * args.steps / best['seconds'],
+        'phases': best['phases']
+    }
+
+def compute_efficiencies(results):
+    reference = next((result for result in results if result['executable'] == 'serial'), None)
+    if reference is None:
+        reference = min(results, key=lambda result: result['workers'])
+
+    throughput_per_worker = reference['throughput'] / reference['workers']
+
+    for result in results:
+        result['efficiency'] = result['throughput'] / (result['workers'] * throughput_per_worker)
+
+def print_report(args, results):
+    print('')
+    print(args.mode + ' scaling, p = ' + str(args.polynomial_order) + ', ' + str(args.nstages) + ' stages, ' +
+          str(args.steps) + ' steps')
+    print('{:<8}{:>7}{:>9}{:>9}{:>11}{:>12}{:>18}{:>12}'.format('', 'ranks', 'threads', 'workers', 'elements',
+                                                             'time (s)', 'elem stages/s', 'efficiency'))
+
+    for result in results:
+        print('{:<8}{:>7}{:>9}{:>9}{:>11}{:>12.3f}{:>18.4e}{:>11.1f}%'.format(
+            result['executable'], result['ranks'], result['threads'], result['workers'], result['elements'],
+            result['seconds'], result['throughput'], 100.0 * result['efficiency']))
+
+    timed = [result for result in results if result['phases'] is not None]
+    if not timed:
+        print('\nno kernel timers written, build with the cmake option KERNEL_TIMERS for the per-phase breakdown')
+        return
+
+    phases = list(timed[0]['phases']['seconds'])
+    print('\nshare of the time summed over all simulation units')
+    print('{:<24}'.format('phase') + ''.join('{:>12}'.format(result['executable'] + ' ' + str(result['workers']))
+                                             for result in timed))
+
+    for phase in phases:
+        shares = []
+        for result in timed:
+            total = sum(result['phases']['seconds'].values())
+            shares.append(100.0 * result['phases']['seconds'][phase] / total if total > 0.0 else 0.0)
+        print('{:<24}'.format(phase) + ''.join('{:>11.1f}%'.format(share) for share in shares))
+
+    print('{:<24}'.format('imbalance') + ''.join('{:>12.2f}'.format(result['phases']['imbalance'])
+                                                 for result in timed))
+
+if __name__ == '__main__':
+    args = parse_arguments()
+    args.build_dir = os.path.abspath(os.path.expanduser(args.build_dir))
+
+    results = []
+    for executable, ranks, threads in configurations(args):
+        print('Running ' + executable + ' with ' + str(ranks) + ' ranks and ' + str(threads) + ' threads...')
+        try:
+            results.append(run_configuration(args, executable, ranks, threads))
+        except RuntimeError as error:
+            print('error: ' + str(error))
+            sys.exit(1)
+
+    if not results:
+        print('no configurations to run')
+        sys.exit(1)
+
+    compute_efficiencies(results)
+    print_report(args, results)
+
+    with open(args.output, 'w') as f:
+        json.dump({
+            'mode': args.mode,
+            'polynomial_order': args.polynomial_order,
+            'nstages': args.nstages,
+            'steps': args.steps,
+            'submeshes_per_worker': args.submeshes_per_worker,
+            'results': results
+        }, f, indent=2)
+
+    print('\nReport written to ' + args.output)
@@ -0,0 +1,68 @@
+import numpy as np
+import struct
+import sys
+
+#layout of Writer::WriteCheckpoint for the SWE problems with an explicit SSP RK stepper
+def read_checkpoint(file_name):
+    with open(file_name, 'rb') as f:
+        data = f.read()
+
+    if data[:8] != b'DGSWECHK':
+        print('ERROR!!! '+file_name+' is not a checkpoint')
+        exit(1)
+
+    order, nstages, dt, step, stage, timestamp, t, ramp = struct.unpack_from('<IIdIIIdd', data, 8)
+    offset = 8 + struct.calcsize('<IIdIIIdd')
+
+    n_elements, = struct.unpack_from('<Q', data, offset)
+    offset += 8
+
+    elements = []
+    for _ in range(n_elements):
+        ID, ndof = struct.unpack_from('<QI', data, offset)
+        offset += 12
+
+        q = np.frombuffer(data, dtype='<f8', count=3*ndof, offset=offset)
+        offset += 8*3*ndof
+
+        wet, went_completely_dry = struct.unpack_from('<BB', data, offset)
+        offset += 2
+
+        elements.append((ID, ndof, q, wet, went_completely_dry))
+
+    return (step, stage, timestamp, t, ramp), elements
+
+if __name__=='__main__':
+    if len(sys.argv) != 3:
+        print('usage: compare_checkpoints.py <checkpoint> <checkpoint of the restarted run>')
+        exit(1)
+
+    stepper, elements = read_checkpoint(sys.argv[1])
+    restarted_stepper, restarted_elements = read_checkpoint(sys.argv[2])
+
+    if stepper != restarted_stepper:
+        print('ERROR!!! Stepper states do not match: '+str(stepper)+' != '+str(restarted_stepper))
+        exit(1)
+
+    if len(elements) != len(restarted_elements):
+        print('ERROR!!! Numbers of elements do not match')
+        exit(1)
+
+    max_q = max([ np.max(np.abs(elt[2])) for elt in elements ])
+    tol = np.finfo(np.float64).eps*max_q*100 #~10^-14
+
+    max_diff = 0.0
+    for elt, restarted_elt in zip(elements, restarted_elements):
+        if elt[0] != restarted_elt[0] or elt[1] != restarted_elt[1] or elt[3:] != restarted_elt[3:]:
+            print('ERROR!!! Element '+str(elt[0])+' does not match in ID, number of dofs or wet/dry state')
+            exit(1)
+
+        max_diff = max(max_diff, np.max(np.abs(elt[2] - restarted_elt[2])))
+
+    print('Max difference of the restarted solution: '+str(max_diff))
+
+    if max_diff < tol:
+        exit(0)
+    else:
+        print('ERROR!!! Restarted solution does not match to machine precision')
+        exit(1)
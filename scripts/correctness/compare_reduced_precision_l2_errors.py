@@ -0,0 +1,41 @@
+import numpy as np
+import re
+
+if __name__=='__main__':
+    build_types=['ompi','ompi_reduced']
+    error = {}
+
+    #floating point regular expression taken from https://stackoverflow.com/a/4703508
+    error_pattern = re.compile('L2 error: [+-]?(\d+(\.\d*)?|\.\d+)([eE][+-]?\d+)?')
+
+    print 'L2 Errors for full and reduced precision communication:'
+    for bt in build_types:
+        with open(bt+'.out') as f:
+
+            any_match=False
+
+            for line in f:
+                match = re.search(error_pattern,line)
+                if match:
+                    any_match=True
+                    print 'L2 error for '+bt+': '+match.group(1)
+                    error[bt] = np.float64(match.group(1))
+
+            if not any_match:
+                print 'ERROR!!! No L2 error found for '+bt+' run.'
+                #print out cout from run with no L2 error
+                with open(bt+'.out') as ff:
+                    for ll in ff:
+                        print ll
+
+                exit(1)
+
+    #float32 traces carry a relative rounding error of ~6e-8 per exchange,
+    # which accumulates over the run; allow a few orders of magnitude on top of that
+    max_error = max([ error['ompi'], error['ompi_reduced'] ])
+    tol = np.finfo(np.float32).eps*max_error*1000 #~10^-4
+    if abs( error['ompi'] - error['ompi_reduced'] ) < tol:
+       exit(0)
+    else:
+        print 'ERROR!!! Reduced precision L2 error deviates from full precision'
+        exit(1)
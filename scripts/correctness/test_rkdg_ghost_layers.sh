@@ -0,0 +1,87 @@
+#!/bin/bash
+
+if [ -z ${DGSWEMV2_ROOT+x} ]; then
+    DGSWEMV2_ROOT_="${HOME}/dgswemv2"
+else
+    DGSWEMV2_ROOT_=$DGSWEMV2_ROOT
+fi
+DGSWEMV2_TEST="${HOME}/dgswemv2_ghost_layers_test"
+
+if [ $# -gt 1 ]; then
+    echo "rkdg_ghost_layers only accepts one optional parameter"
+    echo "  location of the build directory relative to $DGSWEMV2_ROOT"
+    echo "  the default is build"
+    return 1
+fi
+
+if [ $# -eq 1 ]; then
+    ABS_BUILD_DIR=$DGSWEMV2_ROOT_/${1}
+else
+    ABS_BUILD_DIR=$DGSWEMV2_ROOT_/build
+fi
+
+
+#exit the script if any command returns with non-zero status
+set -e
+
+echo "Running test to check that ghost layers match the per stage exchange"
+echo "Compiling code (if necessary)..."
+cd $ABS_BUILD_DIR
+make partitioner
+num_build_cores=$(( $(nproc) - 1))
+
+echo ""
+echo "Setting up runtime files..."
+mkdir -p ${DGSWEMV2_TEST}/exchange ${DGSWEMV2_TEST}/ghost_layers
+cp -r $DGSWEMV2_ROOT_/test/files_for_testing/weir/* ${DGSWEMV2_TEST}/exchange
+cp -r $DGSWEMV2_ROOT_/test/files_for_testing/weir/* ${DGSWEMV2_TEST}/ghost_layers
+
+echo ""
+echo "Building MPI Test case..."
+MAIN_DIR="${DGSWEMV2_ROOT_}/source/"
+sed -i.tmp '/        MPI_Finalize();/i\
+        simulation->ComputeL2Residual();\
+' ${MAIN_DIR}/dgswemv2-ompi.cpp
+cd $ABS_BUILD_DIR
+make -j ${num_build_cores} dgswemv2-ompi
+cd $MAIN_DIR
+mv dgswemv2-ompi.cpp.tmp dgswemv2-ompi.cpp
+
+# ghost layers do not support slope limiting, which closes the weir input file; both runs drop it
+cd ${DGSWEMV2_TEST}/exchange
+sed -i '/^  slope_limiting:/,$d' dgswemv2_input.15
+$ABS_BUILD_DIR/partitioner/partitioner dgswemv2_input.15 4 1 2
+
+cd ${DGSWEMV2_TEST}/ghost_layers
+sed -i '/^  slope_limiting:/,$d' dgswemv2_input.15
+{ echo "communication:"; echo "  ghost_layers: true"; } >> dgswemv2_input.15
+$ABS_BUILD_DIR/partitioner/partitioner dgswemv2_input.15 4 1 2
+
+# See test_rkdg_parallel_weirs.sh for OMP_NUM_THREADS and CI_MPI_CLI
+echo ""
+echo "Running OMPI Test case with per stage exchange..."
+cd ${DGSWEMV2_TEST}/exchange
+OMP_NUM_THREADS=1 mpirun -np 2 ${CI_MPI_CLI} $ABS_BUILD_DIR/source/dgswemv2-ompi dgswemv2_input_parallelized.15 \
+    &> ompi.out
+
+echo ""
+echo "Running OMPI Test case with ghost layers..."
+cd ${DGSWEMV2_TEST}/ghost_layers
+OMP_NUM_THREADS=1 mpirun -np 2 ${CI_MPI_CLI} $ABS_BUILD_DIR/source/dgswemv2-ompi dgswemv2_input_parallelized.15 \
+    &> ompi.out
+
+# the ghost elements see their edges in a different order than the owner does, so the sums only agree to rounding
+exchange_error=$(grep "L2 error:" ${DGSWEMV2_TEST}/exchange/ompi.out)
+ghost_layers_error=$(grep "L2 error:" ${DGSWEMV2_TEST}/ghost_layers/ompi.out)
+exchange_error=${exchange_error#L2 error: }
+ghost_layers_error=${ghost_layers_error#L2 error: }
+
+echo ""
+echo "L2 error with per stage exchange: ${exchange_error}"
+echo "L2 error with ghost layers: ${ghost_layers_error}"
+
+if ! awk -v a="$exchange_error" -v b="$ghost_layers_error" \
+    'BEGIN { d = a - b; if (d < 0) d = -d; exit !(a != "" && d <= 1.0e-10 * a) }'; then
+    echo "ERROR!!! Ghost layer L2 error deviates from per stage exchange"
+    exit 1
+fi
@@ -0,0 +1,82 @@
+#!/bin/bash
+
+if [ -z ${DGSWEMV2_ROOT+x} ]; then
+    DGSWEMV2_ROOT_="${HOME}/dgswemv2"
+else
+    DGSWEMV2_ROOT_=$DGSWEMV2_ROOT
+fi
+DGSWEMV2_TEST="${HOME}/dgswemv2_one_sided_test"
+
+if [ $# -gt 1 ]; then
+    echo "rkdg_one_sided only accepts one optional parameter"
+    echo "  location of the build directory relative to $DGSWEMV2_ROOT"
+    echo "  the default is build"
+    return 1
+fi
+
+if [ $# -eq 1 ]; then
+    ABS_BUILD_DIR=$DGSWEMV2_ROOT_/${1}
+else
+    ABS_BUILD_DIR=$DGSWEMV2_ROOT_/build
+fi
+
+
+#exit the script if any command returns with non-zero status
+set -e
+
+echo "Running test to check that one-sided communication matches two-sided communication"
+echo "Compiling code (if necessary)..."
+cd $ABS_BUILD_DIR
+make partitioner
+num_build_cores=$(( $(nproc) - 1))
+
+echo ""
+echo "Setting up runtime files..."
+mkdir -p ${DGSWEMV2_TEST}
+cp -r $DGSWEMV2_ROOT_/test/files_for_testing/weir/* ${DGSWEMV2_TEST}
+
+echo ""
+echo "Building MPI Test case..."
+MAIN_DIR="${DGSWEMV2_ROOT_}/source/"
+sed -i.tmp '/        MPI_Finalize();/i\
+        simulation->ComputeL2Residual();\
+' ${MAIN_DIR}/dgswemv2-ompi.cpp
+cd $ABS_BUILD_DIR
+make -j ${num_build_cores} dgswemv2-ompi
+cd $MAIN_DIR
+mv dgswemv2-ompi.cpp.tmp dgswemv2-ompi.cpp
+
+cd $DGSWEMV2_TEST
+rm -f weir_*
+# four submeshes on two ranks, each driven by a single thread below, so that every thread steps through several
+# submeshes whose rank boundaries may cross connect to the submeshes of the other rank
+$ABS_BUILD_DIR/partitioner/partitioner dgswemv2_input.15 4 1 2
+
+# the input file does not end with a newline; the partitioner writes a clean copy of the one-sided input
+{ cat dgswemv2_input.15; echo ""; echo "communication:"; echo "  backend: one_sided"; } > dgswemv2_input_one_sided.15
+$ABS_BUILD_DIR/partitioner/partitioner dgswemv2_input_one_sided.15 4 1 2
+
+# See test_rkdg_parallel_weirs.sh for OMP_NUM_THREADS and CI_MPI_CLI
+echo ""
+echo "Running two-sided OMPI Test case..."
+rm -f ompi.out
+OMP_NUM_THREADS=1 mpirun -np 2 ${CI_MPI_CLI} $ABS_BUILD_DIR/source/dgswemv2-ompi dgswemv2_input_parallelized.15 &> ompi.out
+
+echo ""
+echo "Running one-sided OMPI Test case..."
+rm -f ompi_one_sided.out
+OMP_NUM_THREADS=1 timeout 600 mpirun -np 2 ${CI_MPI_CLI} $ABS_BUILD_DIR/source/dgswemv2-ompi \
+    dgswemv2_input_one_sided_parallelized.15 &> ompi_one_sided.out
+
+# both backends deliver the same values, so the L2 errors have to agree to the last digit
+two_sided_error=$(grep "L2 error:" ompi.out)
+one_sided_error=$(grep "L2 error:" ompi_one_sided.out)
+
+echo ""
+echo "L2 error for two-sided communication: ${two_sided_error#L2 error: }"
+echo "L2 error for one-sided communication: ${one_sided_error#L2 error: }"
+
+if [ "$two_sided_error" != "$one_sided_error" ]; then
+    echo "ERROR!!! One-sided L2 error deviates from two-sided"
+    exit 1
+fi
@@ -0,0 +1,72 @@
+#!/bin/bash
+
+if [ -z ${DGSWEMV2_ROOT+x} ]; then
+    DGSWEMV2_ROOT_="${HOME}/dgswemv2"
+else
+    DGSWEMV2_ROOT_=$DGSWEMV2_ROOT
+fi
+DGSWEMV2_TEST="${HOME}/dgswemv2_reduced_precision_test"
+
+if [ $# -gt 1 ]; then
+    echo "rkdg_reduced_precision only accepts one optional parameter"
+    echo "  location of the build directory relative to $DGSWEMV2_ROOT"
+    echo "  the default is build"
+    return 1
+fi
+
+if [ $# -eq 1 ]; then
+    ABS_BUILD_DIR=$DGSWEMV2_ROOT_/${1}
+else
+    ABS_BUILD_DIR=$DGSWEMV2_ROOT_/build
+fi
+
+
+#exit the script if any command returns with non-zero status
+set -e
+
+echo "Running test to check that reduced precision communication matches full precision communication"
+echo "Compiling code (if necessary)..."
+cd $ABS_BUILD_DIR
+make partitioner
+num_build_cores=$(( $(nproc) - 1))
+
+echo ""
+echo "Setting up runtime files..."
+mkdir -p ${DGSWEMV2_TEST}
+cp -r $DGSWEMV2_ROOT_/test/files_for_testing/weir/* ${DGSWEMV2_TEST}
+
+echo ""
+echo "Building MPI Test case..."
+MAIN_DIR="${DGSWEMV2_ROOT_}/source/"
+sed -i.tmp '/        MPI_Finalize();/i\
+        simulation->ComputeL2Residual();\
+' ${MAIN_DIR}/dgswemv2-ompi.cpp
+cd $ABS_BUILD_DIR
+make -j ${num_build_cores} dgswemv2-ompi
+cd $MAIN_DIR
+mv dgswemv2-ompi.cpp.tmp dgswemv2-ompi.cpp
+
+cd $DGSWEMV2_TEST
+rm -f weir_*
+$ABS_BUILD_DIR/partitioner/partitioner dgswemv2_input.15 2 1 2
+
+# the input file does not end with a newline; the partitioner writes a clean copy of the reduced precision input
+{ cat dgswemv2_input.15; echo ""; cat <<'EOT'; } > dgswemv2_input_reduced_precision.15
+communication:
+  reduced_precision: [bound_state, baryctr_state]
+EOT
+$ABS_BUILD_DIR/partitioner/partitioner dgswemv2_input_reduced_precision.15 2 1 2
+
+# See test_rkdg_parallel_weirs.sh for OMP_NUM_THREADS and CI_MPI_CLI
+echo ""
+echo "Running full precision OMPI Test case..."
+rm -f ompi.out
+OMP_NUM_THREADS=1 mpirun -np 2 ${CI_MPI_CLI} $ABS_BUILD_DIR/source/dgswemv2-ompi dgswemv2_input_parallelized.15 &> ompi.out
+
+echo ""
+echo "Running reduced precision OMPI Test case..."
+rm -f ompi_reduced.out
+OMP_NUM_THREADS=1 mpirun -np 2 ${CI_MPI_CLI} $ABS_BUILD_DIR/source/dgswemv2-ompi dgswemv2_input_reduced_precision_parallelized.15 &> ompi_reduced.out
+
+python $DGSWEMV2_ROOT_/scripts/correctness/compare_reduced_precision_l2_errors.py
+exit $?
@@ -0,0 +1,99 @@
+#!/bin/bash
+
+if [ -z ${DGSWEMV2_ROOT+x} ]; then
+    DGSWEMV2_ROOT_="${HOME}/dgswemv2"
+else
+    DGSWEMV2_ROOT_=$DGSWEMV2_ROOT
+fi
+DGSWEMV2_TEST="${HOME}/dgswemv2_restart_test"
+
+if [ $# -gt 1 ]; then
+    echo "rkdg_restart only accepts one optional parameter"
+    echo "  location of the build directory relative to $DGSWEMV2_ROOT"
+    echo "  the default is build"
+    return 1
+fi
+
+if [ $# -eq 1 ]; then
+    ABS_BUILD_DIR=$DGSWEMV2_ROOT_/${1}
+else
+    ABS_BUILD_DIR=$DGSWEMV2_ROOT_/build
+fi
+
+
+#exit the script if any command returns with non-zero status
+set -e
+
+echo "Running test to check that a restarted simulation continues the checkpointed one"
+echo "Compiling code (if necessary)..."
+cd $ABS_BUILD_DIR
+make partitioner
+num_build_cores=$(( $(nproc) - 1))
+make -j ${num_build_cores} dgswemv2-serial
+make -j ${num_build_cores} dgswemv2-ompi
+
+echo ""
+echo "Setting up runtime files..."
+rm -rf ${DGSWEMV2_TEST}
+mkdir -p ${DGSWEMV2_TEST}
+cp -r $DGSWEMV2_ROOT_/test/files_for_testing/weir/* ${DGSWEMV2_TEST}
+
+cd ${DGSWEMV2_TEST}
+
+# 120 steps of 3 s with checkpoints and output every 30 steps; the restarted run continues from the checkpoint of
+# step 60 into its own output directory
+sed -i 's/end_time: 25-11-1987 14:00:00/end_time: 25-11-1987 12:06:00/' dgswemv2_input.15
+RESTART_STEP=60
+LAST_STEP=120
+
+# the input file does not end with a newline
+{ cat dgswemv2_input.15; echo ""; echo "output:"; echo "  path: full/"; echo "  vtu:"; echo "    frequency: 90"; \
+  echo "  checkpoint:"; echo "    frequency: 90"; } > dgswemv2_input_full.15
+{ cat dgswemv2_input.15; echo ""; echo "output:"; echo "  path: restarted/"; echo "  vtu:"; echo "    frequency: 90"; \
+  echo "  checkpoint:"; echo "    frequency: 90"; echo "restart:"; echo "  path: full/"; \
+  echo "  step: ${RESTART_STEP}"; } > dgswemv2_input_restarted.15
+
+# checkpoint written at step LAST_STEP by the full and the restarted run in directory $1 for mesh $2, and no output
+# of step RESTART_STEP written again by the restarted run
+compare_runs() {
+    if [ ! -f full/${1}${2}_checkpoint_${LAST_STEP}.bin ] ||
+       [ ! -f restarted/${1}${2}_checkpoint_${LAST_STEP}.bin ]; then
+        echo "ERROR!!! Checkpoint of step ${LAST_STEP} missing for ${2}"
+        exit 1
+    fi
+
+    if ls restarted/${1}${2}_*_${RESTART_STEP}.* &> /dev/null; then
+        echo "ERROR!!! Restarted run wrote the output of step ${RESTART_STEP} again for ${2}"
+        exit 1
+    fi
+
+    python $DGSWEMV2_ROOT_/scripts/correctness/compare_checkpoints.py full/${1}${2}_checkpoint_${LAST_STEP}.bin \
+        restarted/${1}${2}_checkpoint_${LAST_STEP}.bin
+}
+
+echo ""
+echo "Running Serial Test case..."
+rm -rf full restarted
+$ABS_BUILD_DIR/source/dgswemv2-serial dgswemv2_input_full.15 &> serial_full.out
+$ABS_BUILD_DIR/source/dgswemv2-serial dgswemv2_input_restarted.15 &> serial_restarted.out
+
+compare_runs "" quadrilateral
+
+echo ""
+echo "Running OMPI Test case..."
+rm -rf full restarted weir_*
+$ABS_BUILD_DIR/partitioner/partitioner dgswemv2_input_full.15 2 1 2
+$ABS_BUILD_DIR/partitioner/partitioner dgswemv2_input_restarted.15 2 1 2
+
+# See test_rkdg_parallel_weirs.sh for OMP_NUM_THREADS and CI_MPI_CLI
+OMP_NUM_THREADS=1 mpirun -np 2 ${CI_MPI_CLI} $ABS_BUILD_DIR/source/dgswemv2-ompi \
+    dgswemv2_input_full_parallelized.15 &> ompi_full.out
+OMP_NUM_THREADS=1 mpirun -np 2 ${CI_MPI_CLI} $ABS_BUILD_DIR/source/dgswemv2-ompi \
+    dgswemv2_input_restarted_parallelized.15 &> ompi_restarted.out
+
+# each submesh checkpoints into and restarts from a directory of its own
+for submesh in 0_0 1_0; do
+    compare_runs ${submesh}/ quadrilateral_${submesh}
+done
+
+exit 0
@@ -0,0 +1,66 @@
+import array
+import struct
+import sys
+
+# Converts per step meteo text files (input_file with _<step> inserted before the extension, one "node_ID tau_x tau_y
+# p_atm" line per node) into the binary meteo data file read by SWE::MeteoFile.
+#
+# usage: python convert_meteo_data.py input_file frequency dt output_file
+#   frequency: time between meteo records in seconds, as in the meteo_forcing input
+#   dt: time step of the simulation in seconds
+
+def step_file_name(input_file, step):
+    dot = input_file.rfind('.')
+    return input_file[:dot] + '_' + str(step) + input_file[dot:]
+
+def read_step_file(file_name):
+    values = {}
+    with open(file_name) as f:
+        for line in f:
+            entries = line.split()
+            if len(entries) < 4:
+                break
+            values[int(entries[0])] = [float(v) for v in entries[1:4]]
+    return values
+
+if __name__ == '__main__':
+    if len(sys.argv) != 5:
+        print('usage: python convert_meteo_data.py input_file frequency dt output_file')
+        sys.exit(1)
+
+    input_file = sys.argv[1]
+    frequency = float(sys.argv[2])
+    dt = float(sys.argv[3])
+    output_file = sys.argv[4]
+
+    # same rounding as the parser
+    parse_frequency = int(-(-frequency // dt))
+
+    records = []
+    while True:
+        try:
+            records.append(read_step_file(step_file_name(input_file, len(records) * parse_frequency)))
+        except IOError:
+            break
+
+    if not records:
+        print('No meteo data file ' + step_file_name(input_file, 0) + ' found')
+        sys.exit(1)
+
+    node_IDs = sorted(records[0].keys())
+
+    with open(output_file, 'wb') as f:
+        f.write(b'DGSWEMET')
+        f.write(struct.pack('<IId', len(node_IDs), len(records), frequency))
+        f.write(array.array('I', node_IDs).tobytes())
+
+        for step, record in enumerate(records):
+            for field in range(3):
+                try:
+                    f.write(array.array('f', [record[node_ID][field] for node_ID in node_IDs]).tobytes())
+                except KeyError as missing:
+                    print('Node ' + str(missing) + ' is missing in ' +
+                          step_file_name(input_file, step * parse_frequency))
+                    sys.exit(1)
+
+    print('Wrote ' + str(len(records)) + ' records of ' + str(len(node_IDs)) + ' nodes to ' + output_file)
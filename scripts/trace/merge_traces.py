@@ -0,0 +1,46 @@
+import glob
+import json
+import os
+import sys
+
+# Merges the Chrome trace files trace_<rank>.json written by each rank of a run built with the cmake option
+# EVENT_TRACER into a single trace, which can be opened with chrome://tracing or ui.perfetto.dev.
+# The ranks share a time axis, so their events are concatenated as they are.
+#
+# usage: python merge_traces.py output_path merged_file
+#   output_path: output path of the run, holding the trace_<rank>.json files
+
+def rank_of(file_name):
+    name = os.path.basename(file_name)
+    return int(name[len('trace_'):-len('.json')])
+
+if __name__ == '__main__':
+    if len(sys.argv) != 3:
+        print('usage: python merge_traces.py output_path merged_file')
+        sys.exit(1)
+
+    output_path = sys.argv[1]
+    merged_file = sys.argv[2]
+
+    trace_files = sorted(glob.glob(os.path.join(output_path, 'trace_*.json')), key=rank_of)
+
+    if not trace_files:
+        print('no trace files found in ' + output_path)
+        sys.exit(1)
+
+    events = []
+    dropped_events = {}
+    for trace_file in trace_files:
+        with open(trace_file) as f:
+            trace = json.load(f)
+        events.extend(trace['traceEvents'])
+        dropped_events[trace['otherData']['rank']] = trace['otherData']['dropped_events']
+
+    for rank, n_dropped in sorted(dropped_events.items()):
+        if n_dropped > 0:
+            print('warning: rank ' + str(rank) + ' dropped its ' + str(n_dropped) + ' oldest events')
+
+    with open(merged_file, 'w') as f:
+        json.dump({'traceEvents': events, 'displayTimeUnit': 'ms'}, f)
+
+    print('merged ' + str(len(trace_files)) + ' traces with ' + str(len(events)) + ' events into ' + merged_file)
@@ -28,6 +28,12 @@ class DBDataExchanger {
 
     void SetToSendBuffer(const uint comm_type, const std::vector<double>& message);
     void GetFromReceiveBuffer(const uint comm_type, std::vector<double>& message);
+
+    // Views into the rank boundary buffers at this boundary's offset, which allow kernels to pack and unpack
+    // messages in place. Buffers may be reassigned by the communicator (e.g. HPX channels), therefore
+    // views must be reacquired after every exchange and must not be stored.
+    double* GetSendBufferPointer(const uint comm_type);
+    const double* GetReceiveBufferPointer(const uint comm_type) const;
 };
 
 DBDataExchanger::DBDataExchanger(const uint locality_in,
@@ -55,4 +61,16 @@ void DBDataExchanger::GetFromReceiveBuffer(const uint comm_type, std::vector<dou
               message.begin());
 }
 
+double* DBDataExchanger::GetSendBufferPointer(const uint comm_type) {
+    assert(this->offset[comm_type] <= this->send_buffer[comm_type].size());
+
+    return this->send_buffer[comm_type].data() + this->offset[comm_type];
+}
+
+const double* DBDataExchanger::GetReceiveBufferPointer(const uint comm_type) const {
+    assert(this->offset[comm_type] <= this->receive_buffer[comm_type].size());
+
+    return this->receive_buffer[comm_type].data() + this->offset[comm_type];
+}
+
 #endif
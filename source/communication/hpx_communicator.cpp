@@ -31,8 +31,17 @@ HPXCommunicator::HPXCommunicator(const DistributedBoundaryMetaData& db_data) {
 void HPXCommunicator::SendAll(const uint comm_type, const uint timestamp) {
     const uint offset = this->GetNumberOfCommunications() * timestamp + comm_type;
 
+#ifdef HAS_COMM_PROFILER
+    this->ResizeCommCounters();
+#endif
+
     for (auto& rank_boundary : this->rank_boundaries) {
         rank_boundary.outgoing.set(rank_boundary.send_buffer[comm_type], offset);
+
+#ifdef HAS_COMM_PROFILER
+        // channels never block the sender, so there is no send wait
+        rank_boundary.counters[comm_type].CountSend(rank_boundary.send_buffer[comm_type].size() * sizeof(double));
+#endif
     }
 }
 
@@ -42,12 +51,84 @@ hpx::future<void> HPXCommunicator::ReceiveAll(const uint comm_type, const uint t
 
     const uint offset = this->GetNumberOfCommunications() * timestamp + comm_type;
 
+#ifdef HAS_COMM_PROFILER
+    this->ResizeCommCounters();
+#endif
+
     for (auto& rank_boundary : this->rank_boundaries) {
         receive_futures.push_back(
             rank_boundary.incoming.get(offset).then([&rank_boundary, comm_type](hpx::future<array_double> msg_future) {
                 rank_boundary.receive_buffer[comm_type] = msg_future.get();
+
+#ifdef HAS_COMM_PROFILER
+                rank_boundary.arrivals[comm_type] = Utilities::WaitCharger::clock_t::now();
+                rank_boundary.counters[comm_type].CountReceive(rank_boundary.receive_buffer[comm_type].size() *
+                                                               sizeof(double));
+#endif
             }));
     }
 
     return hpx::when_all(receive_futures);
+}
+
+hpx::future<void> HPXCommunicator::WaitAllReceives(const uint comm_type, hpx::future<void>&& receive_future) {
+#ifdef HAS_COMM_PROFILER
+    const Utilities::WaitCharger::clock_t::time_point wait_begin = Utilities::WaitCharger::clock_t::now();
+
+    return receive_future.then([this, comm_type, wait_begin](auto&& f) {
+        f.get();  // check for exceptions
+
+        std::vector<HPXRankBoundary*> arrived_boundaries;
+
+        for (auto& rank_boundary : this->rank_boundaries) {
+            arrived_boundaries.push_back(&rank_boundary);
+        }
+
+        std::sort(arrived_boundaries.begin(),
+                  arrived_boundaries.end(),
+                  [comm_type](const HPXRankBoundary* lhs, const HPXRankBoundary* rhs) {
+                      return lhs->arrivals[comm_type] < rhs->arrivals[comm_type];
+                  });
+
+        // messages that arrived before the wait began are charged nothing
+        Utilities::WaitCharger charger(wait_begin);
+
+        for (HPXRankBoundary* rank_boundary : arrived_boundaries) {
+            Utilities::CommCounters& counters = rank_boundary->counters[comm_type];
+
+            counters.receive_wait_seconds += charger.Charge(rank_boundary->arrivals[comm_type]);
+        }
+    });
+#else
+    return std::move(receive_future);
+#endif
+}
+
+std::vector<Utilities::CommCountersRecord> HPXCommunicator::GetCommCounters() {
+    std::vector<Utilities::CommCountersRecord> records;
+
+    for (auto& rank_boundary : this->rank_boundaries) {
+        const RankBoundaryMetaData& rb_meta_data = rank_boundary.db_data;
+
+        records.push_back(Utilities::CommCountersRecord{rb_meta_data.locality_in,
+                                                        rb_meta_data.submesh_in,
+                                                        rb_meta_data.locality_ex,
+                                                        rb_meta_data.submesh_ex,
+                                                        rank_boundary.counters});
+    }
+
+    return records;
+}
+
+void HPXCommunicator::ResizeCommCounters() {
+    // the first exchange happens before any receive continuation exists, so resizing cannot race with them
+    const uint ncomm = this->GetNumberOfCommunications();
+
+    for (auto& rank_boundary : this->rank_boundaries) {
+        // arrival times are not serialized, so they are missing on a migrated simulation unit
+        if (rank_boundary.counters.size() < ncomm || rank_boundary.arrivals.size() < ncomm) {
+            rank_boundary.counters.resize(ncomm);
+            rank_boundary.arrivals.resize(ncomm);
+        }
+    }
 }
\ No newline at end of file
@@ -6,6 +6,7 @@
 
 #include "general_definitions.hpp"
 #include "preprocessor/mesh_metadata.hpp"
+#include "utilities/comm_counters.hpp"
 
 using array_double = std::vector<double>;
 HPX_REGISTER_CHANNEL_DECLARATION(array_double);
@@ -19,6 +20,11 @@ struct HPXRankBoundary {
     std::vector<std::vector<double>> send_buffer;
     std::vector<std::vector<double>> receive_buffer;
 
+    // by communication type, only counted with HAS_COMM_PROFILER
+    std::vector<Utilities::CommCounters> counters;
+    // arrival time of the last message of each communication type
+    std::vector<Utilities::WaitCharger::clock_t::time_point> arrivals;
+
     template <typename Archive>
     void serialize(Archive& ar, unsigned) {
         // clang-format off
@@ -26,7 +32,8 @@ struct HPXRankBoundary {
             & outgoing
             & incoming
             & send_buffer
-            & receive_buffer;
+            & receive_buffer
+            & counters;
         // clang-format on
     }
 };
@@ -48,6 +55,15 @@ class HPXCommunicator {
     void SendAll(const uint comm_type, const uint timestamp);
     hpx::future<void> ReceiveAll(const uint comm_type, const uint timestamp);
 
+    // Continues receive_future, returned by ReceiveAll, once the simulation unit has nothing left to do but wait for
+    // it. With HAS_COMM_PROFILER the time until the messages arrive is charged to their rank boundaries.
+    hpx::future<void> WaitAllReceives(const uint comm_type, hpx::future<void>&& receive_future);
+
+    std::vector<Utilities::CommCountersRecord> GetCommCounters();
+
+  private:
+    void ResizeCommCounters();
+
   public:
     using RankBoundaryType = HPXRankBoundary;
 
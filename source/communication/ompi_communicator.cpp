@@ -1,6 +1,6 @@
 #include "ompi_communicator.hpp"
 
-OMPICommunicator::OMPICommunicator(const DistributedBoundaryMetaData& db_data) {
+OMPICommunicator::OMPICommunicator(const DistributedBoundaryMetaData& db_data, const bool one_sided) {
     for (auto& rb_meta_data : db_data.rank_boundary_data) {
         OMPIRankBoundary rank_boundary;
 
@@ -14,63 +14,444 @@ OMPICommunicator::OMPICommunicator(const DistributedBoundaryMetaData& db_data) {
         rank_boundary.receive_tag =
             (int)((unsigned short)rb_meta_data.submesh_ex << 8 | (unsigned short)rb_meta_data.submesh_in);
 
+        // boundaries between submeshes on the same rank keep using two-sided communication
+        rank_boundary.one_sided = one_sided && (rb_meta_data.locality_ex != rb_meta_data.locality_in);
+
         this->rank_boundaries.push_back(std::move(rank_boundary));
     }
 }
 
+namespace {
+DistributedBoundaryMetaData ghost_rank_boundaries(const GhostLayerMetaData& gl_data) {
+    DistributedBoundaryMetaData db_data;
+
+    for (auto& rank_ghosts : gl_data.rank_ghost_data) {
+        RankBoundaryMetaData rb_meta_data;
+
+        rb_meta_data.locality_in = rank_ghosts.locality_in;
+        rb_meta_data.locality_ex = rank_ghosts.locality_ex;
+
+        rb_meta_data.submesh_in = rank_ghosts.submesh_in;
+        rb_meta_data.submesh_ex = rank_ghosts.submesh_ex;
+
+        db_data.rank_boundary_data.push_back(std::move(rb_meta_data));
+    }
+
+    return db_data;
+}
+}
+
+OMPICommunicator::OMPICommunicator(const GhostLayerMetaData& gl_data, const bool one_sided)
+    : OMPICommunicator(ghost_rank_boundaries(gl_data), one_sided) {
+    for (uint rank_boundary_id = 0; rank_boundary_id < this->rank_boundaries.size(); ++rank_boundary_id) {
+        this->rank_boundaries[rank_boundary_id].gl_data = gl_data.rank_ghost_data[rank_boundary_id];
+    }
+
+    this->ghost_layers = true;
+}
+
+void OMPICommunicator::SetReducedPrecision(const uint comm_type) {
+    if (comm_type >= this->reduced_precision.size()) {
+        this->reduced_precision.resize(comm_type + 1, false);
+    }
+
+    this->reduced_precision[comm_type] = true;
+}
+
 void OMPICommunicator::InitializeCommunication() {
-    uint ncomm   = this->rank_boundaries.begin()->send_buffer.size();
-    uint nrbound = this->rank_boundaries.size();
+    uint ncomm = this->rank_boundaries.begin()->send_buffer.size();
 
-    this->send_requests.resize(ncomm);
-    this->receive_requests.resize(ncomm);
+    if (this->reduced_precision.size() > ncomm) {
+        throw std::logic_error("Fatal Error: reduced precision requested for unknown communication type\n");
+    }
+
+    this->reduced_precision.resize(ncomm, false);
+
+    // every communication type gets its own tags, so that receives posted early for one type, e.g. the slope
+    // limiter states at the beginning of a stage, can not match a message of another type between the same submeshes
+    int* tag_ub;
+    int flag;
+    MPI_Comm_get_attr(MPI_COMM_WORLD, MPI_TAG_UB, &tag_ub, &flag);
 
-    for (uint comm = 0; comm < ncomm; ++comm) {
-        this->send_requests[comm].resize(nrbound);
-        this->receive_requests[comm].resize(nrbound);
+    if (flag && ncomm > 0 && (int)((ncomm - 1) << 16 | 0xffff) > *tag_ub) {
+        throw std::logic_error("Fatal Error: MPI tag upper bound " + std::to_string(*tag_ub) +
+                               " is too small for the number of communication types\n");
     }
 
+    this->send_requests.resize(ncomm);
+    this->receive_requests.resize(ncomm);
+    this->request_boundaries.resize(ncomm);
+
     for (uint rank_boundary_id = 0; rank_boundary_id < this->rank_boundaries.size(); ++rank_boundary_id) {
         OMPIRankBoundary& rank_boundary = this->rank_boundaries[rank_boundary_id];
 
         uint ncomm = rank_boundary.send_buffer.size();
 
+        rank_boundary.send_buffer_reduced.resize(ncomm);
+        rank_boundary.receive_buffer_reduced.resize(ncomm);
+
+        rank_boundary.counters.resize(ncomm);
+
         for (uint comm = 0; comm < ncomm; ++comm) {
-            MPI_Request& send_request    = this->send_requests[comm][rank_boundary_id];
-            MPI_Request& receive_request = this->receive_requests[comm][rank_boundary_id];
+            if (this->reduced_precision[comm]) {
+                rank_boundary.send_buffer_reduced[comm].resize(rank_boundary.send_buffer[comm].size());
+                rank_boundary.receive_buffer_reduced[comm].resize(rank_boundary.receive_buffer[comm].size());
+            }
+
+            if (rank_boundary.one_sided) {
+                continue;
+            }
+
+            this->send_requests[comm].emplace_back();
+            this->receive_requests[comm].emplace_back();
+            this->request_boundaries[comm].push_back(rank_boundary_id);
+
+            MPI_Request& send_request    = this->send_requests[comm].back();
+            MPI_Request& receive_request = this->receive_requests[comm].back();
 
-            MPI_Send_init(&rank_boundary.send_buffer[comm].front(),
+            const int send_tag    = (int)(comm << 16) | rank_boundary.send_tag;
+            const int receive_tag = (int)(comm << 16) | rank_boundary.receive_tag;
+
+            if (this->reduced_precision[comm]) {
+                MPI_Send_init(rank_boundary.send_buffer_reduced[comm].data(),
+                              rank_boundary.send_buffer_reduced[comm].size(),
+                              MPI_FLOAT,
+                              rank_boundary.send_rank,
+                              send_tag,
+                              MPI_COMM_WORLD,
+                              &send_request);
+
+                MPI_Recv_init(rank_boundary.receive_buffer_reduced[comm].data(),
+                              rank_boundary.receive_buffer_reduced[comm].size(),
+                              MPI_FLOAT,
+                              rank_boundary.receive_rank,
+                              receive_tag,
+                              MPI_COMM_WORLD,
+                              &receive_request);
+
+                continue;
+            }
+
+            MPI_Send_init(rank_boundary.send_buffer[comm].data(),
                           rank_boundary.send_buffer[comm].size(),
                           MPI_DOUBLE,
                           rank_boundary.send_rank,
-                          rank_boundary.send_tag,
+                          send_tag,
                           MPI_COMM_WORLD,
                           &send_request);
 
-            MPI_Recv_init(&rank_boundary.receive_buffer[comm].front(),
+            MPI_Recv_init(rank_boundary.receive_buffer[comm].data(),
                           rank_boundary.receive_buffer[comm].size(),
                           MPI_DOUBLE,
                           rank_boundary.receive_rank,
-                          rank_boundary.receive_tag,
+                          receive_tag,
                           MPI_COMM_WORLD,
                           &receive_request);
         }
     }
 }
 
+void OMPICommunicator::TraceReceive(const OMPIRankBoundary& rank_boundary,
+                                    const Utilities::EventTracer::clock_t::time_point wait_begin) {
+    const RankBoundaryMetaData& rb_meta_data = rank_boundary.db_data;
+
+    Utilities::EventTracer::Get().Record("receive",
+                                         "communication",
+                                         wait_begin,
+                                         Utilities::EventTracer::clock_t::now(),
+                                         rb_meta_data.submesh_in,
+                                         rb_meta_data.locality_ex,
+                                         rb_meta_data.submesh_ex);
+}
+
+std::vector<Utilities::CommCountersRecord> OMPICommunicator::GetCommCounters() {
+    std::vector<Utilities::CommCountersRecord> records;
+
+    for (auto& rank_boundary : this->rank_boundaries) {
+        const RankBoundaryMetaData& rb_meta_data = rank_boundary.db_data;
+
+        records.push_back(Utilities::CommCountersRecord{rb_meta_data.locality_in,
+                                                        rb_meta_data.submesh_in,
+                                                        rb_meta_data.locality_ex,
+                                                        rb_meta_data.submesh_ex,
+                                                        rank_boundary.counters});
+    }
+
+    return records;
+}
+
+std::vector<OMPIRankBoundary*> OMPICommunicator::SortedOneSidedRankBoundaries(
+    const std::vector<OMPICommunicator*>& communicators) {
+    // key each boundary by (lower rank side, higher rank side), which both ranks of the boundary agree on
+    std::map<std::array<uint, 4>, OMPIRankBoundary*> one_sided_boundaries;
+
+    for (OMPICommunicator* communicator : communicators) {
+        for (auto& rank_boundary : communicator->rank_boundaries) {
+            if (!rank_boundary.one_sided) {
+                continue;
+            }
+
+            const RankBoundaryMetaData& rb_meta_data = rank_boundary.db_data;
+
+            std::array<uint, 4> key{
+                rb_meta_data.locality_in, rb_meta_data.submesh_in, rb_meta_data.locality_ex, rb_meta_data.submesh_ex};
+
+            if (rb_meta_data.locality_ex < rb_meta_data.locality_in) {
+                std::swap(key[0], key[2]);
+                std::swap(key[1], key[3]);
+            }
+
+            one_sided_boundaries.insert(std::make_pair(key, &rank_boundary));
+        }
+    }
+
+    std::vector<OMPIRankBoundary*> sorted_boundaries;
+    for (auto& rb : one_sided_boundaries) {
+        sorted_boundaries.push_back(rb.second);
+    }
+
+    return sorted_boundaries;
+}
+
+void OMPICommunicator::InitializeOneSidedCommunication(const std::vector<OMPICommunicator*>& communicators) {
+    MPI_Group world_group;
+    MPI_Comm_group(MPI_COMM_WORLD, &world_group);
+
+    for (OMPIRankBoundary* rank_boundary : OMPICommunicator::SortedOneSidedRankBoundaries(communicators)) {
+        const RankBoundaryMetaData& rb_meta_data = rank_boundary->db_data;
+
+        std::array<int, 2> pair_ranks{(int)std::min(rb_meta_data.locality_in, rb_meta_data.locality_ex),
+                                      (int)std::max(rb_meta_data.locality_in, rb_meta_data.locality_ex)};
+
+        MPI_Group pair_group;
+        MPI_Group_incl(world_group, 2, pair_ranks.data(), &pair_group);
+        MPI_Comm_create_group(MPI_COMM_WORLD, pair_group, 0, &rank_boundary->pair_comm);
+
+        rank_boundary->neighbor_pair_rank = rb_meta_data.locality_ex < rb_meta_data.locality_in ? 0 : 1;
+
+        MPI_Comm_group(rank_boundary->pair_comm, &pair_group);
+        MPI_Group_incl(pair_group, 1, &rank_boundary->neighbor_pair_rank, &rank_boundary->neighbor_group);
+        MPI_Group_free(&pair_group);
+
+        uint ncomm = rank_boundary->receive_buffer.size();
+
+        rank_boundary->windows.resize(ncomm);
+        rank_boundary->window_buffers.resize(ncomm);
+
+        for (uint comm = 0; comm < ncomm; ++comm) {
+            // reduced buffers are only sized for communications sent in reduced precision
+            int disp_unit = rank_boundary->receive_buffer_reduced[comm].empty() ? sizeof(double) : sizeof(float);
+
+            MPI_Win_allocate((MPI_Aint)(rank_boundary->receive_buffer[comm].size() * disp_unit),
+                             disp_unit,
+                             MPI_INFO_NULL,
+                             rank_boundary->pair_comm,
+                             &rank_boundary->window_buffers[comm],
+                             &rank_boundary->windows[comm]);
+
+            // the exposure epoch of the first message, later ones are posted by WaitAllReceives
+            MPI_Win_post(rank_boundary->neighbor_group, 0, rank_boundary->windows[comm]);
+        }
+    }
+
+    MPI_Group_free(&world_group);
+}
+
+void OMPICommunicator::FinalizeOneSidedCommunication(const std::vector<OMPICommunicator*>& communicators) {
+    std::vector<OMPIRankBoundary*> sorted_boundaries = OMPICommunicator::SortedOneSidedRankBoundaries(communicators);
+
+    // close the exposure epochs left open by the last WaitAllReceives with an empty access epoch from each side
+    for (OMPIRankBoundary* rank_boundary : sorted_boundaries) {
+        for (MPI_Win& window : rank_boundary->windows) {
+            MPI_Win_start(rank_boundary->neighbor_group, 0, window);
+            MPI_Win_complete(window);
+        }
+    }
+
+    for (OMPIRankBoundary* rank_boundary : sorted_boundaries) {
+        for (MPI_Win& window : rank_boundary->windows) {
+            MPI_Win_wait(window);
+        }
+    }
+
+    for (OMPIRankBoundary* rank_boundary : sorted_boundaries) {
+        for (MPI_Win& window : rank_boundary->windows) {
+            MPI_Win_free(&window);
+        }
+
+        rank_boundary->windows.clear();
+        rank_boundary->window_buffers.clear();
+
+        MPI_Group_free(&rank_boundary->neighbor_group);
+        MPI_Comm_free(&rank_boundary->pair_comm);
+    }
+}
+
 void OMPICommunicator::SendAll(const uint comm_type, const uint timestamp) {
-    MPI_Startall(this->send_requests[comm_type].size(), &this->send_requests[comm_type].front());
+    if (this->reduced_precision[comm_type]) {
+        for (auto& rank_boundary : this->rank_boundaries) {
+            std::copy(rank_boundary.send_buffer[comm_type].begin(),
+                      rank_boundary.send_buffer[comm_type].end(),
+                      rank_boundary.send_buffer_reduced[comm_type].begin());
+        }
+    }
+
+    // with only one-sided boundaries there are no requests, and Open MPI rejects the null request array
+    if (!this->send_requests[comm_type].empty()) {
+        MPI_Startall(this->send_requests[comm_type].size(), this->send_requests[comm_type].data());
+    }
+
+    for (auto& rank_boundary : this->rank_boundaries) {
+        if (rank_boundary.one_sided) {
+            MPI_Win& window = rank_boundary.windows[comm_type];
+
+            MPI_Win_start(rank_boundary.neighbor_group, 0, window);
+
+            if (this->reduced_precision[comm_type]) {
+                std::vector<float>& message = rank_boundary.send_buffer_reduced[comm_type];
+
+                MPI_Put(message.data(),
+                        message.size(),
+                        MPI_FLOAT,
+                        rank_boundary.neighbor_pair_rank,
+                        0,
+                        message.size(),
+                        MPI_FLOAT,
+                        window);
+            } else {
+                std::vector<double>& message = rank_boundary.send_buffer[comm_type];
+
+                MPI_Put(message.data(),
+                        message.size(),
+                        MPI_DOUBLE,
+                        rank_boundary.neighbor_pair_rank,
+                        0,
+                        message.size(),
+                        MPI_DOUBLE,
+                        window);
+            }
+        }
+    }
+
+    // the receiver only waits for completed access epochs, so they cannot be left open until WaitAllSends
+    for (auto& rank_boundary : this->rank_boundaries) {
+        if (rank_boundary.one_sided) {
+#ifdef HAS_COMM_PROFILER
+            Utilities::WaitCharger charger(Utilities::WaitCharger::clock_t::now());
+
+            MPI_Win_complete(rank_boundary.windows[comm_type]);
+
+            rank_boundary.counters[comm_type].send_wait_seconds +=
+                charger.Charge(Utilities::WaitCharger::clock_t::now());
+#else
+            MPI_Win_complete(rank_boundary.windows[comm_type]);
+#endif
+        }
+    }
+
+#ifdef HAS_COMM_PROFILER
+    for (auto& rank_boundary : this->rank_boundaries) {
+        rank_boundary.counters[comm_type].CountSend(
+            this->reduced_precision[comm_type] ? rank_boundary.send_buffer_reduced[comm_type].size() * sizeof(float)
+                                               : rank_boundary.send_buffer[comm_type].size() * sizeof(double));
+    }
+#endif
 }
 
 void OMPICommunicator::ReceiveAll(const uint comm_type, const uint timestamp) {
-    MPI_Startall(this->receive_requests[comm_type].size(), &this->receive_requests[comm_type].front());
+    // windows of one-sided boundaries are already exposed, see WaitAllReceives
+    if (!this->receive_requests[comm_type].empty()) {
+        MPI_Startall(this->receive_requests[comm_type].size(), this->receive_requests[comm_type].data());
+    }
 }
 
 void OMPICommunicator::WaitAllSends(const uint comm_type, const uint timestamp) {
-    MPI_Waitall(this->send_requests[comm_type].size(), &this->send_requests[comm_type].front(), MPI_STATUSES_IGNORE);
+#ifdef HAS_COMM_PROFILER
+    Utilities::WaitCharger charger(Utilities::WaitCharger::clock_t::now());
+
+    for (uint n_sent = 0; n_sent < this->send_requests[comm_type].size(); ++n_sent) {
+        int request_id;
+        MPI_Waitany(this->send_requests[comm_type].size(),
+                    this->send_requests[comm_type].data(),
+                    &request_id,
+                    MPI_STATUS_IGNORE);
+
+        OMPIRankBoundary& rank_boundary = this->rank_boundaries[this->request_boundaries[comm_type][request_id]];
+
+        rank_boundary.counters[comm_type].send_wait_seconds += charger.Charge(Utilities::WaitCharger::clock_t::now());
+    }
+#else
+    if (!this->send_requests[comm_type].empty()) {
+        MPI_Waitall(
+            this->send_requests[comm_type].size(), this->send_requests[comm_type].data(), MPI_STATUSES_IGNORE);
+    }
+#endif
 }
 
 void OMPICommunicator::WaitAllReceives(const uint comm_type, const uint timestamp) {
-    MPI_Waitall(
-        this->receive_requests[comm_type].size(), &this->receive_requests[comm_type].front(), MPI_STATUSES_IGNORE);
-}
\ No newline at end of file
+#if defined(HAS_EVENT_TRACER) || defined(HAS_COMM_PROFILER)
+    // the arrival of each neighbor's message is traced and charged, to tell which neighbor held up the wait
+    const Utilities::EventTracer::clock_t::time_point wait_begin = Utilities::EventTracer::clock_t::now();
+
+    Utilities::WaitCharger charger(wait_begin);
+
+    const auto arrived = [this, comm_type, wait_begin, &charger](OMPIRankBoundary& rank_boundary) {
+#ifdef HAS_EVENT_TRACER
+        OMPICommunicator::TraceReceive(rank_boundary, wait_begin);
+#endif
+
+#ifdef HAS_COMM_PROFILER
+        Utilities::CommCounters& counters = rank_boundary.counters[comm_type];
+
+        counters.receive_wait_seconds += charger.Charge(Utilities::WaitCharger::clock_t::now());
+        counters.CountReceive(this->reduced_precision[comm_type]
+                                  ? rank_boundary.receive_buffer_reduced[comm_type].size() * sizeof(float)
+                                  : rank_boundary.receive_buffer[comm_type].size() * sizeof(double));
+#endif
+    };
+
+    for (uint n_received = 0; n_received < this->receive_requests[comm_type].size(); ++n_received) {
+        int request_id;
+        MPI_Waitany(this->receive_requests[comm_type].size(),
+                    this->receive_requests[comm_type].data(),
+                    &request_id,
+                    MPI_STATUS_IGNORE);
+
+        arrived(this->rank_boundaries[this->request_boundaries[comm_type][request_id]]);
+    }
+#else
+    if (!this->receive_requests[comm_type].empty()) {
+        MPI_Waitall(
+            this->receive_requests[comm_type].size(), this->receive_requests[comm_type].data(), MPI_STATUSES_IGNORE);
+    }
+#endif
+
+    for (auto& rank_boundary : this->rank_boundaries) {
+        std::vector<double>& receive_buffer = rank_boundary.receive_buffer[comm_type];
+
+        if (rank_boundary.one_sided) {
+            MPI_Win_wait(rank_boundary.windows[comm_type]);
+
+#if defined(HAS_EVENT_TRACER) || defined(HAS_COMM_PROFILER)
+            arrived(rank_boundary);
+#endif
+
+            if (this->reduced_precision[comm_type]) {
+                const float* message = (float*)rank_boundary.window_buffers[comm_type];
+                std::copy(message, message + receive_buffer.size(), receive_buffer.begin());
+            } else {
+                const double* message = (double*)rank_boundary.window_buffers[comm_type];
+                std::copy(message, message + receive_buffer.size(), receive_buffer.begin());
+            }
+
+            // Expose the window for the next message right away. Posting it in ReceiveAll instead would let the
+            // neighbor's access epoch wait on a post that sits behind one of our own waits, e.g. when a thread
+            // drives several submeshes whose boundaries cross connect to the submeshes of another rank.
+            MPI_Win_post(rank_boundary.neighbor_group, 0, rank_boundary.windows[comm_type]);
+        } else if (this->reduced_precision[comm_type]) {
+            std::copy(rank_boundary.receive_buffer_reduced[comm_type].begin(),
+                      rank_boundary.receive_buffer_reduced[comm_type].end(),
+                      receive_buffer.begin());
+        }
+    }
+}
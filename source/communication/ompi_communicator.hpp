@@ -5,18 +5,42 @@
 
 #include "general_definitions.hpp"
 #include "preprocessor/mesh_metadata.hpp"
+#include "utilities/comm_counters.hpp"
+#include "utilities/event_tracer.hpp"
 
 struct OMPIRankBoundary {
     RankBoundaryMetaData db_data;
+    // ghost elements exchanged once per time step, only set with ghost layers
+    RankGhostLayerMetaData gl_data;
 
     int send_rank;
     int receive_rank;
 
+    // tags of the submesh pair, the communication type is added above them in InitializeCommunication
     int send_tag;
     int receive_tag;
 
     std::vector<std::vector<double>> send_buffer;
     std::vector<std::vector<double>> receive_buffer;
+
+    // single precision wire copies of the buffers for communications sent in reduced precision
+    std::vector<std::vector<float>> send_buffer_reduced;
+    std::vector<std::vector<float>> receive_buffer_reduced;
+
+    // one-sided backend: each side exposes its receive buffers in a window per communication type over a
+    // communicator that holds only the two ranks of this boundary, the neighbor puts into it using PSCW epochs.
+    // A window stays exposed between messages, its next exposure epoch is posted as soon as the last one is waited on.
+    bool one_sided{false};
+
+    MPI_Comm pair_comm;
+    MPI_Group neighbor_group;
+    int neighbor_pair_rank;
+
+    std::vector<MPI_Win> windows;
+    std::vector<void*> window_buffers;
+
+    // by communication type, only counted with HAS_COMM_PROFILER
+    std::vector<Utilities::CommCounters> counters;
 };
 
 class OMPICommunicator {
@@ -26,12 +50,31 @@ class OMPICommunicator {
     std::vector<std::vector<MPI_Request>> send_requests;
     std::vector<std::vector<MPI_Request>> receive_requests;
 
+    // rank boundary of each send and receive request
+    std::vector<std::vector<uint>> request_boundaries;
+
+    std::vector<bool> reduced_precision;
+
+    bool ghost_layers{false};
+
   public:
     OMPICommunicator() = default;
-    OMPICommunicator(const DistributedBoundaryMetaData& db_data);
+    OMPICommunicator(const DistributedBoundaryMetaData& db_data, const bool one_sided = false);
+    // rank boundaries to the submeshes exchanging ghost layers, which share no distributed boundaries
+    OMPICommunicator(const GhostLayerMetaData& gl_data, const bool one_sided = false);
 
+    // Must be called before InitializeCommunication. Messages of comm_type are then sent as float32, which halves
+    // the bytes on the wire at a relative rounding error of about 6e-8 per exchanged value.
+    void SetReducedPrecision(const uint comm_type);
     void InitializeCommunication();
 
+    // Windows are created and freed collectively by both ranks of a boundary. To avoid deadlock every rank must
+    // process its boundaries in the same global order, so these act on all communicators of a rank at once.
+    static void InitializeOneSidedCommunication(const std::vector<OMPICommunicator*>& communicators);
+    static void FinalizeOneSidedCommunication(const std::vector<OMPICommunicator*>& communicators);
+
+    bool UsesGhostLayers() { return this->ghost_layers; }
+
     uint GetRankBoundaryNumber() { return this->rank_boundaries.size(); }
     OMPIRankBoundary& GetRankBoundary(const uint rank_boundary_id) {
         return this->rank_boundaries.at(rank_boundary_id);
@@ -44,6 +87,15 @@ class OMPICommunicator {
 
   public:
     using RankBoundaryType = OMPIRankBoundary;
+
+    std::vector<Utilities::CommCountersRecord> GetCommCounters();
+
+  private:
+    static void TraceReceive(const OMPIRankBoundary& rank_boundary,
+                             const Utilities::EventTracer::clock_t::time_point wait_begin);
+
+    static std::vector<OMPIRankBoundary*> SortedOneSidedRankBoundaries(
+        const std::vector<OMPICommunicator*>& communicators);
 };
 
 #endif
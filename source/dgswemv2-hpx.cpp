@@ -7,6 +7,7 @@
 #include "general_definitions.hpp"
 
 #include "simulation/hpx/simulation_hpx.hpp"
+#include "simulation/writer.hpp"
 
 int main(int argc, char* argv[]) {
     if (argc != 2) {
@@ -39,10 +40,56 @@ int hpx_main(int argc, char* argv[]) {
     }
 
     hpx::wait_all(run_futures);
+
+    for (auto& run_future : run_futures) {
+        run_future.get();  // check for exceptions
+    }
     auto t2 = std::chrono::high_resolution_clock::now();
 
+    InputParameters<> input(input_string);
+
+    if (input.writer_input.writing_station_output) {
+        merge_station_output(input.writer_input);
+    }
+
     std::cout << "Time Elapsed (in us): " << std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count()
               << std::endl;
 
+#ifdef HAS_KERNEL_TIMERS
+    std::vector<Utilities::KernelTimersRecord> timers_records;
+
+    for (auto& sim_client : simulation_clients) {
+        std::vector<Utilities::KernelTimersRecord> locality_records = sim_client.GetKernelTimers().get();
+
+        timers_records.insert(timers_records.end(), locality_records.begin(), locality_records.end());
+    }
+
+    Utilities::write_kernel_timers_summary(std::cout, timers_records);
+    Utilities::write_kernel_timers_json(input.writer_input.output_path + "kernel_timers.json", timers_records);
+#endif
+
+#ifdef HAS_COMM_PROFILER
+    std::vector<Utilities::CommCountersRecord> counters_records;
+
+    for (auto& sim_client : simulation_clients) {
+        std::vector<Utilities::CommCountersRecord> locality_records = sim_client.GetCommCounters().get();
+
+        counters_records.insert(counters_records.end(), locality_records.begin(), locality_records.end());
+    }
+
+    Utilities::write_comm_counters_summary(std::cout, counters_records);
+    Utilities::write_comm_counters_json(input.writer_input.output_path + "comm_counters.json", counters_records);
+#endif
+
+#ifdef HAS_EVENT_TRACER
+    std::vector<hpx::future<void>> trace_futures;
+
+    for (auto& sim_client : simulation_clients) {
+        trace_futures.push_back(sim_client.WriteEventTrace(input.writer_input.output_path));
+    }
+
+    hpx::wait_all(trace_futures);
+#endif
+
     return hpx::finalize();
 }
@@ -9,6 +9,10 @@
 
 #include "simulation/ompi/simulation_ompi_base.hpp"
 
+#ifdef HAS_EVENT_TRACER
+#include "utilities/event_tracer.hpp"
+#endif
+
 int main(int argc, char* argv[]) {
     if (argc < 2) {
         std::cerr << "Usage\n"
@@ -31,6 +35,12 @@ int main(int argc, char* argv[]) {
             }
         }
 
+#ifdef HAS_EVENT_TRACER
+        // ranks leave the barrier together, which aligns the time axes of their traces
+        MPI_Barrier(MPI_COMM_WORLD);
+        Utilities::EventTracer::Get().SetEpoch(Utilities::EventTracer::clock_t::now());
+#endif
+
 #ifdef HAS_PETSC
         PetscInitialize(&argc, &argv, (char*)nullptr, nullptr);
 #endif
@@ -38,6 +38,7 @@ class Boundary {
     const Master::Master<dimension + 1>& GetMaster() { return this->master; }
     const Shape::Shape<dimension + 1>& GetShape() { return this->shape; }
     const std::vector<uint>& GetNodeID() { return this->node_ID; }
+    const AlignedVector<Point<dimension + 1>>& GetGPGlobalCoordinates() { return this->gp_global_coordinates; }
 
     template <typename F>
     DynMatrix<double> ComputeFgp(const F& f);
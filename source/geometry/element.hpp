@@ -59,6 +59,7 @@ class Element {
     const std::vector<uint>& GetNodeID() { return this->node_ID; }
     const std::vector<uint>& GetNeighborID() { return this->neighbor_ID; }
     const std::vector<uchar>& GetBoundaryType() { return this->boundary_type; }
+    const AlignedVector<Point<dimension>>& GetGPGlobalCoordinates() { return this->gp_global_coordinates; }
 
     void SetMaster(MasterType& master) { this->master = &master; };
     void SetSurveyPoints(const AlignedVector<Point<dimension>>& survey_points);
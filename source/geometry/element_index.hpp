@@ -0,0 +1,187 @@
+#ifndef ELEMENT_INDEX_HPP
+#define ELEMENT_INDEX_HPP
+
+#include "general_definitions.hpp"
+#include "geometry/mesh.hpp"
+#include "geometry/spatial_index.hpp"
+#include "preprocessor/mesh_metadata.hpp"
+
+namespace Geometry {
+/**
+ * Point location over the straight triangles of a mesh or submesh.
+ * The triangle vertices are kept next to the bucket grid, so that queries neither touch the elements nor need the
+ * mesh to be built; the index can be created from the mesh meta data, a binary mesh, or a (sub)mesh.
+ */
+class ElementIndex {
+  private:
+    std::vector<uint> element_IDs;
+    // x, y of the vertices, plain arrays avoid the alignment requirements of the fixed size vector types
+    std::vector<std::array<std::array<double, 2>, 3>> triangles;
+
+    SpatialIndex spatial_index;
+
+  public:
+    ElementIndex() = default;
+    ElementIndex(const MeshMetaData& mesh_data);
+    ElementIndex(const BinaryMeshData& mesh_data);
+    template <typename ElementTypes, typename InterfaceTypes, typename BoundaryTypes, typename DistributedBoundaryTypes>
+    ElementIndex(Mesh<ElementTypes, InterfaceTypes, BoundaryTypes, DistributedBoundaryTypes>& mesh);
+
+    uint GetNumberElements() const { return this->element_IDs.size(); }
+
+    /**
+     * @return ID of the element containing point, DEFAULT_ID if the point is outside of the mesh
+     */
+    uint LocatePoint(const Point<2>& point) const;
+
+    /**
+     * @return per point, ID of the element containing it, DEFAULT_ID for points outside of the mesh
+     */
+    std::vector<uint> LocatePoints(const AlignedVector<Point<2>>& points) const;
+
+    /**
+     * @return ID of the element closest to point, the containing element for points inside of the mesh
+     */
+    uint FindNearestElement(const Point<2>& point) const;
+
+  private:
+    void AddElement(const uint ID, const AlignedVector<Point<3>>& nodal_coordinates);
+    void BuildIndex();
+
+    bool ContainsPoint(const uint entry, const Point<2>& point) const;
+    double Distance(const uint entry, const Point<2>& point) const;
+};
+
+inline ElementIndex::ElementIndex(const MeshMetaData& mesh_data) {
+    // the meta data of a Binary format mesh only holds its name
+    if (mesh_data.elements.empty()) {
+        throw std::logic_error("Fatal Error: mesh meta data of " + mesh_data.mesh_name +
+                               " holds no elements, binary meshes are indexed through BinaryMeshData\n");
+    }
+
+    for (const auto& elt : mesh_data.elements) {
+        this->AddElement(elt.first, mesh_data.get_nodal_coordinates(elt.first));
+    }
+
+    this->BuildIndex();
+}
+
+inline ElementIndex::ElementIndex(const BinaryMeshData& mesh_data) {
+    for (uint elt_index = 0; elt_index < mesh_data.GetNumberElements(); ++elt_index) {
+        this->AddElement(mesh_data.GetElementID(elt_index), mesh_data.get_nodal_coordinates(elt_index));
+    }
+
+    this->BuildIndex();
+}
+
+template <typename ElementTypes, typename InterfaceTypes, typename BoundaryTypes, typename DistributedBoundaryTypes>
+ElementIndex::ElementIndex(Mesh<ElementTypes, InterfaceTypes, BoundaryTypes, DistributedBoundaryTypes>& mesh) {
+    mesh.CallForEachOwnedElement(
+        [this](auto& elt) { this->AddElement(elt.GetID(), elt.GetShape().nodal_coordinates); });
+
+    this->BuildIndex();
+}
+
+inline uint ElementIndex::LocatePoint(const Point<2>& point) const {
+    const uint entry = this->spatial_index.LocatePoint(
+        point, [this](const uint entry, const Point<2>& point) { return this->ContainsPoint(entry, point); });
+
+    return entry == DEFAULT_ID ? DEFAULT_ID : this->element_IDs[entry];
+}
+
+inline std::vector<uint> ElementIndex::LocatePoints(const AlignedVector<Point<2>>& points) const {
+    std::vector<uint> IDs = this->spatial_index.LocatePoints(
+        points, [this](const uint entry, const Point<2>& point) { return this->ContainsPoint(entry, point); });
+
+    for (uint& ID : IDs) {
+        if (ID != DEFAULT_ID) {
+            ID = this->element_IDs[ID];
+        }
+    }
+
+    return IDs;
+}
+
+inline uint ElementIndex::FindNearestElement(const Point<2>& point) const {
+    const uint entry = this->spatial_index.FindNearest(
+        point, [this](const uint entry, const Point<2>& point) { return this->Distance(entry, point); });
+
+    return entry == DEFAULT_ID ? DEFAULT_ID : this->element_IDs[entry];
+}
+
+inline void ElementIndex::AddElement(const uint ID, const AlignedVector<Point<3>>& nodal_coordinates) {
+    if (nodal_coordinates.size() != 3) {
+        throw std::logic_error("Fatal Error: element " + std::to_string(ID) +
+                               " is not a triangle, only straight triangles can be indexed\n");
+    }
+
+    this->element_IDs.push_back(ID);
+    this->triangles.emplace_back();
+
+    for (uint node = 0; node < 3; ++node) {
+        this->triangles.back()[node][GlobalCoord::x] = nodal_coordinates[node][GlobalCoord::x];
+        this->triangles.back()[node][GlobalCoord::y] = nodal_coordinates[node][GlobalCoord::y];
+    }
+}
+
+inline void ElementIndex::BuildIndex() {
+    std::vector<BoundingBox> bounding_boxes(this->triangles.size());
+
+    for (uint entry = 0; entry < this->triangles.size(); ++entry) {
+        for (const std::array<double, 2>& vertex : this->triangles[entry]) {
+            bounding_boxes[entry].Extend(vertex[GlobalCoord::x], vertex[GlobalCoord::y]);
+        }
+    }
+
+    this->spatial_index = SpatialIndex(std::move(bounding_boxes));
+}
+
+inline bool ElementIndex::ContainsPoint(const uint entry, const Point<2>& point) const {
+    const std::array<std::array<double, 2>, 3>& triangle = this->triangles[entry];
+
+    // barycentric coordinates, as in StraightTriangle::ContainsPoint
+    const double T00 = triangle[1][GlobalCoord::x] - triangle[0][GlobalCoord::x];
+    const double T01 = triangle[2][GlobalCoord::x] - triangle[0][GlobalCoord::x];
+    const double T10 = triangle[1][GlobalCoord::y] - triangle[0][GlobalCoord::y];
+    const double T11 = triangle[2][GlobalCoord::y] - triangle[0][GlobalCoord::y];
+
+    const double det = T00 * T11 - T01 * T10;
+
+    const double dx = point[GlobalCoord::x] - triangle[0][GlobalCoord::x];
+    const double dy = point[GlobalCoord::y] - triangle[0][GlobalCoord::y];
+
+    const double lambda_1 = (T11 * dx - T01 * dy) / det;
+    const double lambda_2 = (-T10 * dx + T00 * dy) / det;
+
+    return lambda_1 >= 0.0 && lambda_2 >= 0.0 && lambda_1 + lambda_2 <= 1.0;
+}
+
+inline double ElementIndex::Distance(const uint entry, const Point<2>& point) const {
+    if (this->ContainsPoint(entry, point)) {
+        return 0.0;
+    }
+
+    const std::array<std::array<double, 2>, 3>& triangle = this->triangles[entry];
+
+    double distance = std::numeric_limits<double>::max();
+
+    for (uint edge = 0; edge < 3; ++edge) {
+        const std::array<double, 2>& a = triangle[edge];
+        const std::array<double, 2>& b = triangle[(edge + 1) % 3];
+
+        const double ab_x = b[GlobalCoord::x] - a[GlobalCoord::x];
+        const double ab_y = b[GlobalCoord::y] - a[GlobalCoord::y];
+        const double ap_x = point[GlobalCoord::x] - a[GlobalCoord::x];
+        const double ap_y = point[GlobalCoord::y] - a[GlobalCoord::y];
+
+        // closest point on the edge, clamped to its end points
+        const double t = std::min(std::max((ap_x * ab_x + ap_y * ab_y) / (ab_x * ab_x + ab_y * ab_y), 0.0), 1.0);
+
+        distance = std::min(distance, std::hypot(ap_x - t * ab_x, ap_y - t * ab_y));
+    }
+
+    return distance;
+}
+}
+
+#endif
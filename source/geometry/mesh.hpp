@@ -5,6 +5,8 @@
 #include "utilities/heterogeneous_containers.hpp"
 #include "mesh_utilities.hpp"
 
+#include <unordered_set>
+
 namespace Geometry {
 // Since elements types already come in a tuple. We can use specialization
 // to get easy access to the parameter packs for the element and edge types.
@@ -35,6 +37,9 @@ class Mesh<std::tuple<Elements...>,
     BoundaryContainer boundaries;
     DistributedBoundaryContainer distributed_boundaries;
 
+    // elements owned by neighboring submeshes, which are computed redundantly and left out of the output
+    std::unordered_set<uint> ghost_element_IDs;
+
     std::string mesh_name;
 
   public:
@@ -55,6 +60,7 @@ class Mesh<std::tuple<Elements...>,
     void SetMasters() { this->masters = master_maker<MasterElementTypes>::construct_masters(p); }
 
     uint GetNumberElements() { return this->elements.size(); }
+    uint GetNumberOwnedElements() { return this->elements.size() - this->ghost_element_IDs.size(); }
     uint GetNumberInterfaces() { return this->interfaces.size(); }
     uint GetNumberBoundaries() { return this->boundaries.size(); }
     uint GetNumberDistributedBoundaries() { return this->distributed_boundaries.size(); }
@@ -68,9 +74,16 @@ class Mesh<std::tuple<Elements...>,
     template <typename DistributedBoundaryType, typename... Args>
     void CreateDistributedBoundary(Args&&... args);
 
+    void SetGhostElement(const uint ID) { this->ghost_element_IDs.insert(ID); }
+    bool IsGhostElement(const uint ID) { return this->ghost_element_IDs.count(ID); }
+
+    template <typename F>
+    void CallForElement(const uint ID, const F& f);
     template <typename F>
     void CallForEachElement(const F& f);
     template <typename F>
+    void CallForEachOwnedElement(const F& f);
+    template <typename F>
     void CallForEachInterface(const F& f);
     template <typename F>
     void CallForEachBoundary(const F& f);
@@ -138,6 +151,21 @@ void Mesh<std::tuple<Elements...>,
     this->distributed_boundaries.template emplace_back<DistributedBoundaryType>(std::forward<Args>(args)...);
 }
 
+template <typename... Elements, typename... Interfaces, typename... Boundaries, typename... DistributedBoundaries>
+template <typename F>
+void Mesh<std::tuple<Elements...>,
+          std::tuple<Interfaces...>,
+          std::tuple<Boundaries...>,
+          std::tuple<DistributedBoundaries...>>::CallForElement(const uint ID, const F& f) {
+    Utilities::for_each_in_tuple(this->elements.data, [ID, &f](auto& element_map) {
+        auto elt_it = element_map.find(ID);
+
+        if (elt_it != element_map.end()) {
+            f(elt_it->second);
+        }
+    });
+}
+
 template <typename... Elements, typename... Interfaces, typename... Boundaries, typename... DistributedBoundaries>
 template <typename F>
 void Mesh<std::tuple<Elements...>,
@@ -149,6 +177,27 @@ void Mesh<std::tuple<Elements...>,
     });
 }
 
+template <typename... Elements, typename... Interfaces, typename... Boundaries, typename... DistributedBoundaries>
+template <typename F>
+void Mesh<std::tuple<Elements...>,
+          std::tuple<Interfaces...>,
+          std::tuple<Boundaries...>,
+          std::tuple<DistributedBoundaries...>>::CallForEachOwnedElement(const F& f) {
+    if (this->ghost_element_IDs.empty()) {
+        this->CallForEachElement(f);
+
+        return;
+    }
+
+    Utilities::for_each_in_tuple(this->elements.data, [this, &f](auto& element_map) {
+        std::for_each(element_map.begin(), element_map.end(), [this, &f](auto& pair) {
+            if (!this->ghost_element_IDs.count(pair.first)) {
+                f(pair.second);
+            }
+        });
+    });
+}
+
 template <typename... Elements, typename... Interfaces, typename... Boundaries, typename... DistributedBoundaries>
 template <typename F>
 void Mesh<std::tuple<Elements...>,
@@ -0,0 +1,269 @@
+#ifndef SPATIAL_INDEX_HPP
+#define SPATIAL_INDEX_HPP
+
+#include "general_definitions.hpp"
+
+namespace Geometry {
+struct BoundingBox {
+    std::array<double, 2> min{std::numeric_limits<double>::max(), std::numeric_limits<double>::max()};
+    std::array<double, 2> max{std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest()};
+
+    void Extend(const double x, const double y) {
+        this->min[GlobalCoord::x] = std::min(this->min[GlobalCoord::x], x);
+        this->min[GlobalCoord::y] = std::min(this->min[GlobalCoord::y], y);
+        this->max[GlobalCoord::x] = std::max(this->max[GlobalCoord::x], x);
+        this->max[GlobalCoord::y] = std::max(this->max[GlobalCoord::y], y);
+    }
+
+    bool Contains(const double x, const double y) const {
+        return x >= this->min[GlobalCoord::x] && x <= this->max[GlobalCoord::x] && y >= this->min[GlobalCoord::y] &&
+               y <= this->max[GlobalCoord::y];
+    }
+
+    double Distance(const double x, const double y) const {
+        const double dx = std::max({this->min[GlobalCoord::x] - x, 0.0, x - this->max[GlobalCoord::x]});
+        const double dy = std::max({this->min[GlobalCoord::y] - y, 0.0, y - this->max[GlobalCoord::y]});
+
+        return std::hypot(dx, dy);
+    }
+};
+
+/**
+ * Uniform bucket grid over the bounding boxes of a set of elements.
+ * Each grid cell lists the elements whose bounding box overlaps it, so locating a point only tests the few
+ * elements of the cell it falls into instead of every element of the mesh.
+ */
+class SpatialIndex {
+  private:
+    BoundingBox domain;
+    std::array<uint, 2> n_cells{0, 0};
+    std::array<double, 2> cell_size{0.0, 0.0};
+
+    std::vector<BoundingBox> bounding_boxes;
+
+    // entries of cell c are cell_entries[cell_offsets[c]] ... cell_entries[cell_offsets[c + 1] - 1]
+    std::vector<uint> cell_offsets;
+    std::vector<uint> cell_entries;
+
+  public:
+    SpatialIndex() = default;
+    SpatialIndex(std::vector<BoundingBox>&& bounding_boxes);
+
+    uint GetNumberEntries() const { return this->bounding_boxes.size(); }
+
+    /**
+     * Find the entry containing a point.
+     *
+     * @param point point to locate
+     * @param contains_point callable (entry index, point) -> bool testing whether the entry contains the point
+     * @return index of the first entry containing the point, DEFAULT_ID if there is none
+     */
+    template <typename F>
+    uint LocatePoint(const Point<2>& point, const F& contains_point) const;
+
+    /**
+     * Find the entries containing a batch of points.
+     * Points are processed grouped by grid cell, so that the entries of a cell are tested for all of its points in
+     * a row.
+     *
+     * @param points points to locate
+     * @param contains_point callable (entry index, point) -> bool testing whether the entry contains the point
+     * @return per point, index of the first entry containing it, DEFAULT_ID if there is none
+     */
+    template <typename F>
+    std::vector<uint> LocatePoints(const AlignedVector<Point<2>>& points, const F& contains_point) const;
+
+    /**
+     * Find the entry nearest to a point.
+     * Grid cells are searched in rings of increasing distance around the point, until no closer entry can be found.
+     *
+     * @param point point to query, may lie outside of the indexed domain
+     * @param distance callable (entry index, point) -> double returning the distance between the entry and the point
+     * @return index of the nearest entry, DEFAULT_ID if the index is empty
+     */
+    template <typename F>
+    uint FindNearest(const Point<2>& point, const F& distance) const;
+
+  private:
+    uint GetCell(const uint dir, const double coordinate) const {
+        const double cell = (coordinate - this->domain.min[dir]) / this->cell_size[dir];
+
+        return (uint)std::min(std::max(cell, 0.0), (double)(this->n_cells[dir] - 1));
+    }
+
+    uint GetCell(const Point<2>& point) const {
+        return this->GetCell(GlobalCoord::y, point[GlobalCoord::y]) * this->n_cells[GlobalCoord::x] +
+               this->GetCell(GlobalCoord::x, point[GlobalCoord::x]);
+    }
+};
+
+inline SpatialIndex::SpatialIndex(std::vector<BoundingBox>&& bounding_boxes)
+    : bounding_boxes(std::move(bounding_boxes)) {
+    if (this->bounding_boxes.empty()) {
+        return;
+    }
+
+    for (const BoundingBox& box : this->bounding_boxes) {
+        this->domain.Extend(box.min[GlobalCoord::x], box.min[GlobalCoord::y]);
+        this->domain.Extend(box.max[GlobalCoord::x], box.max[GlobalCoord::y]);
+    }
+
+    // about one entry per cell, with cells as square as the extent of the domain allows
+    const double length_x = std::max(this->domain.max[GlobalCoord::x] - this->domain.min[GlobalCoord::x],
+                                     std::numeric_limits<double>::min());
+    const double length_y = std::max(this->domain.max[GlobalCoord::y] - this->domain.min[GlobalCoord::y],
+                                     std::numeric_limits<double>::min());
+
+    const double cell_length = std::sqrt(length_x * length_y / this->bounding_boxes.size());
+
+    this->n_cells[GlobalCoord::x] = (uint)std::min(std::max(length_x / cell_length, 1.0), 65536.0);
+    this->n_cells[GlobalCoord::y] = (uint)std::min(std::max(length_y / cell_length, 1.0), 65536.0);
+
+    this->cell_size[GlobalCoord::x] = length_x / this->n_cells[GlobalCoord::x];
+    this->cell_size[GlobalCoord::y] = length_y / this->n_cells[GlobalCoord::y];
+
+    // two passes, counting and filling, to store the cell lists contiguously
+    this->cell_offsets.assign(this->n_cells[GlobalCoord::x] * this->n_cells[GlobalCoord::y] + 1, 0);
+
+    for (uint pass = 0; pass < 2; ++pass) {
+        std::vector<uint> cell_fill;
+
+        if (pass == 1) {
+            for (uint cell = 1; cell < this->cell_offsets.size(); ++cell) {
+                this->cell_offsets[cell] += this->cell_offsets[cell - 1];
+            }
+
+            this->cell_entries.resize(this->cell_offsets.back());
+
+            cell_fill.assign(this->cell_offsets.begin(), this->cell_offsets.end() - 1);
+        }
+
+        for (uint entry = 0; entry < this->bounding_boxes.size(); ++entry) {
+            const BoundingBox& box = this->bounding_boxes[entry];
+
+            const uint i_min = this->GetCell(GlobalCoord::x, box.min[GlobalCoord::x]);
+            const uint i_max = this->GetCell(GlobalCoord::x, box.max[GlobalCoord::x]);
+            const uint j_min = this->GetCell(GlobalCoord::y, box.min[GlobalCoord::y]);
+            const uint j_max = this->GetCell(GlobalCoord::y, box.max[GlobalCoord::y]);
+
+            for (uint j = j_min; j <= j_max; ++j) {
+                for (uint i = i_min; i <= i_max; ++i) {
+                    const uint cell = j * this->n_cells[GlobalCoord::x] + i;
+
+                    if (pass == 0) {
+                        ++(this->cell_offsets[cell + 1]);
+                    } else {
+                        this->cell_entries[cell_fill[cell]++] = entry;
+                    }
+                }
+            }
+        }
+    }
+}
+
+template <typename F>
+uint SpatialIndex::LocatePoint(const Point<2>& point, const F& contains_point) const {
+    if (this->bounding_boxes.empty() || !this->domain.Contains(point[GlobalCoord::x], point[GlobalCoord::y])) {
+        return DEFAULT_ID;
+    }
+
+    const uint cell = this->GetCell(point);
+
+    for (uint index = this->cell_offsets[cell]; index < this->cell_offsets[cell + 1]; ++index) {
+        const uint entry = this->cell_entries[index];
+
+        if (this->bounding_boxes[entry].Contains(point[GlobalCoord::x], point[GlobalCoord::y]) &&
+            contains_point(entry, point)) {
+            return entry;
+        }
+    }
+
+    return DEFAULT_ID;
+}
+
+template <typename F>
+std::vector<uint> SpatialIndex::LocatePoints(const AlignedVector<Point<2>>& points, const F& contains_point) const {
+    std::vector<uint> entries(points.size(), DEFAULT_ID);
+
+    if (this->bounding_boxes.empty()) {
+        return entries;
+    }
+
+    std::vector<uint> point_cells(points.size());
+    for (uint pt = 0; pt < points.size(); ++pt) {
+        point_cells[pt] = this->GetCell(points[pt]);
+    }
+
+    std::vector<uint> order(points.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&point_cells](const uint pt_a, const uint pt_b) {
+        return point_cells[pt_a] < point_cells[pt_b];
+    });
+
+    for (const uint pt : order) {
+        entries[pt] = this->LocatePoint(points[pt], contains_point);
+    }
+
+    return entries;
+}
+
+template <typename F>
+uint SpatialIndex::FindNearest(const Point<2>& point, const F& distance) const {
+    if (this->bounding_boxes.empty()) {
+        return DEFAULT_ID;
+    }
+
+    const int i_point = this->GetCell(GlobalCoord::x, point[GlobalCoord::x]);
+    const int j_point = this->GetCell(GlobalCoord::y, point[GlobalCoord::y]);
+
+    const int max_ring = std::max(this->n_cells[GlobalCoord::x], this->n_cells[GlobalCoord::y]);
+    const double min_cell_size = std::min(this->cell_size[GlobalCoord::x], this->cell_size[GlobalCoord::y]);
+
+    uint nearest_entry      = DEFAULT_ID;
+    double nearest_distance = std::numeric_limits<double>::max();
+
+    for (int ring = 0; ring <= max_ring; ++ring) {
+        // cells of this ring are at least ring - 1 cells away from the cell of the point
+        if ((ring - 1) * min_cell_size > nearest_distance) {
+            break;
+        }
+
+        for (int j = j_point - ring; j <= j_point + ring; ++j) {
+            if (j < 0 || j >= (int)this->n_cells[GlobalCoord::y]) {
+                continue;
+            }
+
+            // interior rows of the ring only contribute their first and last cell
+            const int i_step = (j == j_point - ring || j == j_point + ring) ? 1 : std::max(2 * ring, 1);
+
+            for (int i = i_point - ring; i <= i_point + ring; i += i_step) {
+                if (i < 0 || i >= (int)this->n_cells[GlobalCoord::x]) {
+                    continue;
+                }
+
+                const uint cell = j * this->n_cells[GlobalCoord::x] + i;
+
+                for (uint index = this->cell_offsets[cell]; index < this->cell_offsets[cell + 1]; ++index) {
+                    const uint entry = this->cell_entries[index];
+
+                    if (this->bounding_boxes[entry].Distance(point[GlobalCoord::x], point[GlobalCoord::y]) >=
+                        nearest_distance) {
+                        continue;
+                    }
+
+                    const double entry_distance = distance(entry, point);
+
+                    if (entry_distance < nearest_distance) {
+                        nearest_entry    = entry;
+                        nearest_distance = entry_distance;
+                    }
+                }
+            }
+        }
+    }
+
+    return nearest_entry;
+}
+}
+
+#endif
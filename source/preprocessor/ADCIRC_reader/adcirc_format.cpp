@@ -1,6 +1,76 @@
 #include "adcirc_format.hpp"
 
-AdcircFormat::AdcircFormat(const std::string& fort14) {
+#include <cctype>
+#include <cstring>
+#include <thread>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+const char* skip_blanks(const char* pos, const char* end) {
+    while (pos != end && (*pos == ' ' || *pos == '\t' || *pos == '\r')) {
+        ++pos;
+    }
+
+    return pos;
+}
+
+const char* parse_uint(const char* pos, const char* end, uint& value) {
+    pos = skip_blanks(pos, end);
+
+    if (pos == end || *pos < '0' || *pos > '9') {
+        throw std::logic_error("Fatal Error: unable to parse integer in ADCIRC mesh file!\n");
+    }
+
+    value = 0;
+    while (pos != end && *pos >= '0' && *pos <= '9') {
+        value = 10 * value + (uint)(*pos - '0');
+        ++pos;
+    }
+
+    return pos;
+}
+
+const char* parse_double(const char* pos, const char* end, double& value) {
+    pos = skip_blanks(pos, end);
+
+    // the mapped file is not null terminated, so the number is copied out for strtod
+    char buffer[64];
+
+    std::size_t length = 0;
+    while (pos + length != end && length + 1 < sizeof(buffer) && !std::isspace(pos[length])) {
+        buffer[length] = pos[length];
+        ++length;
+    }
+    buffer[length] = '\0';
+
+    char* number_end;
+    value = std::strtod(buffer, &number_end);
+
+    if (number_end == buffer) {
+        throw std::logic_error("Fatal Error: unable to parse floating point number in ADCIRC mesh file!\n");
+    }
+
+    return pos + (number_end - buffer);
+}
+
+const char* next_line(const char* pos, const char* end) {
+    pos = (const char*)std::memchr(pos, '\n', end - pos);
+
+    return pos ? pos + 1 : end;
+}
+
+// empty or white space only line, e.g. a stray CRLF line ending
+bool is_blank_line(const char* pos, const char* end) {
+    pos = skip_blanks(pos, end);
+
+    return pos == end || *pos == '\n';
+}
+}
+
+AdcircFormat::AdcircFormat(const std::string& fort14, const std::size_t min_chunk_size) {
     if (!Utilities::file_exists(fort14)) {
         throw std::logic_error("Fatal Error: ADCIRC mesh file " + fort14 + " was not found!\n");
     }
@@ -16,33 +86,8 @@ AdcircFormat::AdcircFormat(const std::string& fort14) {
     ifs >> n_nodes;
     ifs.ignore(1000, '\n');
 
-    {  // read in node information
-        uint node_name;
-        std::array<double, 3> node_data;
-
-        for (uint i = 0; i < n_nodes; ++i) {
-            ifs >> node_name;
-            ifs >> node_data[0] >> node_data[1] >> node_data[2];
-
-            assert(!this->nodes.count(node_name));  // Can't define a node twice
-            this->nodes.insert({node_name, node_data});
-            ifs.ignore(1000, '\n');
-        }
-    }
-
-    {  // read in element information
-        uint element_name;
-        std::array<uint, 4> element_data;
-
-        for (uint i = 0; i < n_elements; ++i) {
-            ifs >> element_name;
-            ifs >> element_data[0] >> element_data[1] >> element_data[2] >> element_data[3];
-
-            assert(!this->elements.count(element_name));  // Can't define element twice
-            this->elements.insert({element_name, element_data});
-            ifs.ignore(1000, '\n');
-        }
-    }
+    // node and element tables make up nearly the whole file, they are parsed in parallel from a memory mapping
+    ifs.seekg(this->read_nodes_elements(fort14, ifs.tellg(), n_nodes, n_elements, min_chunk_size));
 
     {  // process open boundaries
         ifs >> this->NOPE;
@@ -122,8 +167,8 @@ AdcircFormat::AdcircFormat(const std::string& fort14) {
     std::string line;
     std::getline(ifs, line);
 
-    if (line.find_first_not_of(' ') != std::string::npos) {  // process generic boundaries if there are any, i.e. not a
-                                                             // white space or end of file
+    // process generic boundaries if there are any, i.e. not a white space line or end of file
+    if (line.find_first_not_of(" \t\r") != std::string::npos) {
         std::stringstream stream;
         stream = std::stringstream(line);
 
@@ -148,6 +193,149 @@ AdcircFormat::AdcircFormat(const std::string& fort14) {
     ifs.close();
 }
 
+std::size_t AdcircFormat::read_nodes_elements(const std::string& fort14,
+                                              const std::size_t begin,
+                                              const uint n_nodes,
+                                              const uint n_elements,
+                                              const std::size_t min_chunk_size) {
+    int fd = open(fort14.c_str(), O_RDONLY);
+
+    struct stat file_stat;
+    if (fd < 0 || fstat(fd, &file_stat) != 0) {
+        throw std::logic_error("Fatal Error: unable to open ADCIRC mesh file " + fort14 + "\n");
+    }
+
+    const std::size_t file_size = file_stat.st_size;
+
+    void* data = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (data == MAP_FAILED) {
+        throw std::logic_error("Fatal Error: unable to map ADCIRC mesh file " + fort14 + "\n");
+    }
+
+    const char* file_begin = (const char*)data;
+    const char* file_end   = file_begin + file_size;
+
+    // the number of chunks only depends on the file, threads take turns on them
+    const std::size_t n_chunks =
+        std::max((std::size_t)1, (file_size - begin) / std::max((std::size_t)1, min_chunk_size));
+    const uint n_threads = std::max(1u, (uint)std::min((std::size_t)std::thread::hardware_concurrency(), n_chunks));
+
+    // split the rest of the file into chunks starting at line beginnings
+    std::vector<const char*> chunk_begin(n_chunks + 1);
+    for (std::size_t chunk = 0; chunk < n_chunks; ++chunk) {
+        chunk_begin[chunk] = file_begin + begin + (file_size - begin) * chunk / n_chunks;
+
+        if (chunk != 0 && *(chunk_begin[chunk] - 1) != '\n') {
+            chunk_begin[chunk] = next_line(chunk_begin[chunk], file_end);
+        }
+    }
+    chunk_begin[n_chunks] = file_end;
+
+    auto run_in_parallel = [n_threads, n_chunks](const std::function<void(std::size_t)>& kernel) {
+        auto run_chunks = [n_threads, n_chunks, &kernel](uint thread) {
+            for (std::size_t chunk = thread; chunk < n_chunks; chunk += n_threads) {
+                kernel(chunk);
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (uint thread = 1; thread < n_threads; ++thread) {
+            threads.emplace_back(run_chunks, thread);
+        }
+
+        run_chunks(0);
+
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    };
+
+    // first pass: count table lines per chunk to know which node or element each chunk starts with
+    std::vector<std::size_t> chunk_lines(n_chunks + 1, 0);
+
+    run_in_parallel([&chunk_begin, &chunk_lines](std::size_t chunk) {
+        for (const char* pos = chunk_begin[chunk]; pos < chunk_begin[chunk + 1];
+             pos = next_line(pos, chunk_begin[chunk + 1])) {
+            if (!is_blank_line(pos, chunk_begin[chunk + 1])) {
+                ++chunk_lines[chunk + 1];
+            }
+        }
+    });
+
+    for (std::size_t chunk = 0; chunk < n_chunks; ++chunk) {
+        chunk_lines[chunk + 1] += chunk_lines[chunk];
+    }
+
+    const std::size_t n_lines = (std::size_t)n_nodes + n_elements;
+
+    if (chunk_lines[n_chunks] < n_lines) {
+        munmap(data, file_size);
+        throw std::logic_error("Fatal Error: ADCIRC mesh file " + fort14 + " is truncated!\n");
+    }
+
+    std::vector<uint> node_IDs(n_nodes);
+    std::vector<std::array<double, 3>> node_data(n_nodes);
+
+    std::vector<uint> element_IDs(n_elements);
+    std::vector<std::array<uint, 4>> element_data(n_elements);
+
+    std::size_t end = begin;
+    std::vector<std::exception_ptr> errors(n_chunks);
+
+    // second pass: parse the lines of the node and element tables
+    run_in_parallel([&](std::size_t chunk) {
+        try {
+            const char* chunk_end = chunk_begin[chunk + 1];
+
+            std::size_t line = chunk_lines[chunk];
+            const char* pos  = chunk_begin[chunk];
+
+            for (; pos < chunk_end && line < n_lines; pos = next_line(pos, chunk_end)) {
+                if (is_blank_line(pos, chunk_end)) {
+                    continue;
+                }
+
+                if (line < n_nodes) {
+                    pos = parse_uint(pos, chunk_end, node_IDs[line]);
+                    for (uint i = 0; i < 3; ++i) {
+                        pos = parse_double(pos, chunk_end, node_data[line][i]);
+                    }
+                } else {
+                    const std::size_t elt = line - n_nodes;
+
+                    pos = parse_uint(pos, chunk_end, element_IDs[elt]);
+                    for (uint i = 0; i < 4; ++i) {
+                        pos = parse_uint(pos, chunk_end, element_data[elt][i]);
+                    }
+                }
+
+                ++line;
+            }
+
+            if (line == n_lines && chunk_lines[chunk] < n_lines) {
+                end = pos - file_begin;
+            }
+        } catch (...) {
+            errors[chunk] = std::current_exception();
+        }
+    });
+
+    munmap(data, file_size);
+
+    for (std::exception_ptr& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    this->nodes.assign(node_IDs, std::move(node_data));
+    this->elements.assign(element_IDs, std::move(element_data));
+
+    return end;
+}
+
 void AdcircFormat::write_to(const char* out_name) const {
     std::ofstream file;
     file.open(out_name);
@@ -4,11 +4,12 @@
 #include "general_definitions.hpp"
 #include "problem/SWE/swe_definitions.hpp"
 #include "utilities/file_exists.hpp"
+#include "utilities/id_map.hpp"
 
 struct AdcircFormat {
     std::string name;
-    std::unordered_map<uint, std::array<double, 3>> nodes;
-    std::unordered_map<uint, std::array<uint, 4>> elements;
+    Utilities::IDMap<std::array<double, 3>> nodes;
+    Utilities::IDMap<std::array<uint, 4>> elements;
 
     // see
     // http://adcirc.org/home/documentation/users-manual-v51/input-file-descriptions/adcirc-grid-and-boundary-information-file-fort-14/
@@ -28,12 +29,15 @@ struct AdcircFormat {
     std::map<uint, std::vector<double>> BARINCFSB;  // for internal barrier segment k
     std::map<uint, std::vector<double>> BARINCFSP;  // for internal barrier segment k
 
-    uint NGEN;  // number of generic boundaries
-    uint NNGN;  // total number of nodes for generic boundaries
+    uint NGEN = 0;  // number of generic boundaries
+    uint NNGN = 0;  // total number of nodes for generic boundaries
 
     std::vector<std::vector<uint>> NBGN;  // node numbers for a segment of generic boundary
 
-    AdcircFormat(const std::string& in_name);
+    // node and element lines are parsed in chunks of at least this many bytes
+    static constexpr std::size_t default_min_chunk_size = 1 << 20;
+
+    AdcircFormat(const std::string& in_name, const std::size_t min_chunk_size = default_min_chunk_size);
 
     void write_to(const char* out_name) const;
 
@@ -41,6 +45,12 @@ struct AdcircFormat {
     std::array<uint, 2> get_internal_node_pair(std::array<uint, 2>& node_pair) const;
 
   private:
+    std::size_t read_nodes_elements(const std::string& fort14,
+                                    const std::size_t begin,
+                                    const uint n_nodes,
+                                    const uint n_elements,
+                                    const std::size_t min_chunk_size);
+
     bool has_edge(std::vector<uint>::const_iterator cbegin,
                   std::vector<uint>::const_iterator cend,
                   std::array<uint, 2>& node_pair) const;
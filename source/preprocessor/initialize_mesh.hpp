@@ -36,6 +36,18 @@ void initialize_mesh_elements(typename ProblemType::ProblemMeshType& mesh,
     using ElementType =
         typename std::tuple_element<0, Geometry::ElementTypeTuple<typename ProblemType::ProblemDataType>>::type;
 
+    if (input.mesh_input.binary_mesh_data) {
+        const BinaryMeshData& binary_mesh_data = *input.mesh_input.binary_mesh_data;
+
+        for (uint elt_index = 0; elt_index < binary_mesh_data.GetNumberElements(); ++elt_index) {
+            mesh.template CreateElement<ElementType>(binary_mesh_data.GetElementID(elt_index),
+                                                     binary_mesh_data.get_nodal_coordinates(elt_index),
+                                                     binary_mesh_data.GetElementNodeIDs(elt_index),
+                                                     binary_mesh_data.GetElementNeighborIDs(elt_index),
+                                                     binary_mesh_data.GetElementBoundaryTypes(elt_index));
+        }
+    }
+
     for (auto& element_meta : mesh_data.elements) {
         uint elt_id = element_meta.first;
 
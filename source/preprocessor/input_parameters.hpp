@@ -21,11 +21,16 @@ struct MeshInput {
     std::string mesh_file_name;
     std::string bc_is_file_name;
     std::string db_file_name;
+    std::string gh_file_name;
 
     CoordinateSystem mesh_coordinate_sys;
 
     MeshMetaData mesh_data;
     DistributedBoundaryMetaData dbmd_data;
+    GhostLayerMetaData ghmd_data;
+
+    // set for the Binary format instead of the meta data maps, mesh_data then only holds the mesh name
+    std::shared_ptr<BinaryMeshData> binary_mesh_data;
 };
 
 struct StepperInput {
@@ -56,10 +61,40 @@ struct WriterInput {
     bool writing_vtu_output{false};
     double vtu_output_frequency{std::numeric_limits<double>::max()};
     uint vtu_output_freq_step{std::numeric_limits<uint>::max()};
+    std::string vtu_output_format{"ascii"};
 
     bool writing_modal_output{false};
     double modal_output_frequency{std::numeric_limits<double>::max()};
     uint modal_output_freq_step{std::numeric_limits<uint>::max()};
+    // write the modal data of all submeshes into one binary file per time step (OMPI only)
+    bool modal_shared_file{false};
+    // number of ranks reserved to write the shared file, compute ranks forward their data to them
+    uint modal_io_ranks{0};
+
+    bool writing_checkpoint{false};
+    double checkpoint_frequency{std::numeric_limits<double>::max()};
+    uint checkpoint_freq_step{std::numeric_limits<uint>::max()};
+
+    bool writing_station_output{false};
+    std::string station_file_name;
+    double station_output_frequency{std::numeric_limits<double>::max()};
+    uint station_output_freq_step{std::numeric_limits<uint>::max()};
+    // in the coordinate system of the mesh, projected along with the mesh nodes
+    AlignedVector<Point<2>> station_coordinates;
+    std::vector<std::string> station_names;
+
+    bool writing_extrema_output{false};
+    double extrema_frequency{std::numeric_limits<double>::max()};
+    uint extrema_freq_step{std::numeric_limits<uint>::max()};
+    // extrema are written at checkpoints and once the last step of the run is reached
+    uint last_step{std::numeric_limits<uint>::max()};
+};
+
+struct RestartInput {
+    bool restarting{false};
+    // output path of the run that wrote the checkpoint
+    std::string path;
+    uint step;
 };
 
 struct LoadBalancerInput {
@@ -68,6 +103,18 @@ struct LoadBalancerInput {
     double rebalance_frequency;
 };
 
+struct CommunicatorInput {
+    // names of the problem's communication types to be sent in single precision (MPI only)
+    std::vector<std::string> reduced_precision;
+
+    // two_sided (persistent send/receive) or one_sided (RMA put with PSCW synchronization), MPI only
+    std::string backend{"two_sided"};
+
+    // submeshes overlap by one ghost layer per stage, whose states are exchanged once per time step instead of
+    // exchanging boundary states every stage (RKDG SWE with MPI only)
+    bool ghost_layers{false};
+};
+
 template <typename ProblemInput = YamlNodeWrapper>
 struct InputParameters {
     uint polynomial_order;
@@ -77,6 +124,8 @@ struct InputParameters {
     ProblemInput problem_input;
     WriterInput writer_input;
     LoadBalancerInput load_balancer_input;
+    CommunicatorInput communicator_input;
+    RestartInput restart_input;
 
     InputParameters() = default;
     InputParameters(const std::string& input_string);
@@ -85,6 +134,8 @@ struct InputParameters {
     void read_mesh();
     void read_bcis();
     void read_dbmd(const uint locality_id, const uint submesh_id);
+    void read_ghmd(const uint locality_id, const uint submesh_id);
+    void read_stations();
 
     void write_to(const std::string& output_filename);
 
@@ -111,7 +162,8 @@ InputParameters<ProblemInput>::InputParameters(const std::string& input_string)
         if (raw_mesh["format"] && raw_mesh["file_name"] && raw_mesh["coordinate_system"]) {
             this->mesh_input.mesh_format = raw_mesh["format"].as<std::string>();
 
-            if (!((this->mesh_input.mesh_format == "Adcirc") || (this->mesh_input.mesh_format == "Meta"))) {
+            if (!((this->mesh_input.mesh_format == "Adcirc") || (this->mesh_input.mesh_format == "Meta") ||
+                  (this->mesh_input.mesh_format == "Binary"))) {
                 std::string err_msg = "Error: Unsupported mesh format: " + this->mesh_input.mesh_format + '\n';
                 throw std::logic_error(err_msg);
             }
@@ -121,6 +173,8 @@ InputParameters<ProblemInput>::InputParameters(const std::string& input_string)
                 this->mesh_input.mesh_file_name.substr(0, this->mesh_input.mesh_file_name.find_last_of('.')) + ".bcis";
             this->mesh_input.db_file_name =
                 this->mesh_input.mesh_file_name.substr(0, this->mesh_input.mesh_file_name.find_last_of('.')) + ".dbmd";
+            this->mesh_input.gh_file_name =
+                this->mesh_input.mesh_file_name.substr(0, this->mesh_input.mesh_file_name.find_last_of('.')) + ".ghmd";
             std::string coord_sys_string = raw_mesh["coordinate_system"].as<std::string>();
 
             if (coord_sys_string == "cartesian") {
@@ -195,6 +249,67 @@ InputParameters<ProblemInput>::InputParameters(const std::string& input_string)
         }
     }
 
+    // Process communication information
+    if (input_file["communication"]) {
+        YAML::Node comm_node = input_file["communication"];
+
+        if (comm_node["reduced_precision"]) {
+            if (comm_node["reduced_precision"].IsSequence()) {
+                this->communicator_input.reduced_precision =
+                    comm_node["reduced_precision"].as<std::vector<std::string>>();
+            } else {
+                std::string err_msg{"Error: Communication YAML node is malformatted\n"};
+                throw std::logic_error(err_msg);
+            }
+        }
+
+        if (comm_node["backend"]) {
+            this->communicator_input.backend = comm_node["backend"].as<std::string>();
+
+            if (!((this->communicator_input.backend == "two_sided") ||
+                  (this->communicator_input.backend == "one_sided"))) {
+                std::string err_msg =
+                    "Error: Unsupported communication backend: " + this->communicator_input.backend + '\n';
+                throw std::logic_error(err_msg);
+            }
+        }
+
+        if (comm_node["ghost_layers"]) {
+            this->communicator_input.ghost_layers = comm_node["ghost_layers"].as<bool>();
+
+            const std::string problem_name = input_file["problem"]["name"].as<std::string>();
+
+            if (this->communicator_input.ghost_layers && problem_name != "rkdg_swe") {
+                std::string err_msg("Error: Ghost layers are not supported for problem " + problem_name + '\n');
+                throw std::logic_error(err_msg);
+            }
+
+            // the troubled cell indicator spreads over several neighbors, which the ghost layers do not cover
+            if (this->communicator_input.ghost_layers && input_file["problem"]["slope_limiting"]) {
+                std::string err_msg("Error: Ghost layers are not supported with slope limiting\n");
+                throw std::logic_error(err_msg);
+            }
+        }
+    }
+
+    // Process restart information
+    if (input_file["restart"]) {
+        YAML::Node restart_node = input_file["restart"];
+
+        if (restart_node["path"] && restart_node["step"]) {
+            this->restart_input.restarting = true;
+            this->restart_input.path       = restart_node["path"].as<std::string>();
+            this->restart_input.step       = restart_node["step"].as<uint>();
+
+            if (this->restart_input.path.back() != '/') {
+                this->restart_input.path += "/";
+            }
+        } else {
+            std::string err_msg{"Error: Restart YAML node is malformatted\n"};
+            throw std::logic_error(err_msg);
+        }
+    }
+
     // Process output information (else no output)
     if (input_file["output"]) {
         YAML::Node out_node = input_file["output"];
@@ -240,18 +355,94 @@ InputParameters<ProblemInput>::InputParameters(const std::string& input_string)
                 this->writer_input.vtu_output_frequency = out_node["vtu"]["frequency"].as<double>();
                 this->writer_input.vtu_output_freq_step =
                     (uint)std::ceil(this->writer_input.vtu_output_frequency / this->stepper_input.dt);
+
+                if (out_node["vtu"]["format"]) {
+                    this->writer_input.vtu_output_format = out_node["vtu"]["format"].as<std::string>();
+
+                    if (!((this->writer_input.vtu_output_format == "ascii") ||
+                          (this->writer_input.vtu_output_format == "binary") ||
+                          (this->writer_input.vtu_output_format == "compressed"))) {
+                        std::string err_msg =
+                            "Error: Unsupported VTU format: " + this->writer_input.vtu_output_format + '\n';
+                        throw std::logic_error(err_msg);
+                    }
+                }
             } else {
                 std::string err_msg("Error: VTU YAML node is malformatted\n");
                 throw std::logic_error(err_msg);
             }
         }
 
+        if (out_node["checkpoint"]) {
+            if (out_node["checkpoint"]["frequency"]) {
+                this->writer_input.writing_checkpoint   = true;
+                this->writer_input.checkpoint_frequency = out_node["checkpoint"]["frequency"].as<double>();
+                this->writer_input.checkpoint_freq_step =
+                    (uint)std::ceil(this->writer_input.checkpoint_frequency / this->stepper_input.dt);
+            } else {
+                std::string err_msg("Error: Checkpoint YAML node is malformatted\n");
+                throw std::logic_error(err_msg);
+            }
+        }
+
+        if (out_node["stations"]) {
+            if (out_node["stations"]["file"] && out_node["stations"]["frequency"]) {
+                this->writer_input.writing_station_output   = true;
+                this->writer_input.station_file_name        = out_node["stations"]["file"].as<std::string>();
+                this->writer_input.station_output_frequency = out_node["stations"]["frequency"].as<double>();
+                this->writer_input.station_output_freq_step =
+                    (uint)std::ceil(this->writer_input.station_output_frequency / this->stepper_input.dt);
+
+                this->read_stations();
+            } else {
+                std::string err_msg("Error: Stations YAML node is malformatted\n");
+                throw std::logic_error(err_msg);
+            }
+        }
+
+        if (out_node["extrema"]) {
+            if (out_node["extrema"]["frequency"]) {
+                this->writer_input.writing_extrema_output = true;
+                this->writer_input.extrema_frequency      = out_node["extrema"]["frequency"].as<double>();
+                this->writer_input.extrema_freq_step =
+                    (uint)std::ceil(this->writer_input.extrema_frequency / this->stepper_input.dt);
+                this->writer_input.last_step = (uint)std::ceil(this->stepper_input.run_time / this->stepper_input.dt);
+            } else {
+                std::string err_msg("Error: Extrema YAML node is malformatted\n");
+                throw std::logic_error(err_msg);
+            }
+        }
+
         if (out_node["modal"]) {
             if (out_node["modal"]["frequency"]) {
                 this->writer_input.writing_modal_output   = true;
                 this->writer_input.modal_output_frequency = out_node["modal"]["frequency"].as<double>();
                 this->writer_input.modal_output_freq_step =
                     (uint)std::ceil(this->writer_input.modal_output_frequency / this->stepper_input.dt);
+
+                if (out_node["modal"]["shared_file"]) {
+                    this->writer_input.modal_shared_file = out_node["modal"]["shared_file"].as<bool>();
+                }
+
+                if (out_node["modal"]["io_ranks"]) {
+                    this->writer_input.modal_io_ranks = out_node["modal"]["io_ranks"].as<uint>();
+
+                    if (this->writer_input.modal_io_ranks > 0 && !this->writer_input.modal_shared_file) {
+                        std::string err_msg("Error: Modal output through I/O ranks requires shared_file: true\n");
+                        throw std::logic_error(err_msg);
+                    }
+
+                    // I/O ranks skip the time loop, so they would never join the global problem collectives of
+                    // the implicit and Green-Naghdi solvers on MPI_COMM_WORLD
+                    const std::string problem_name = input_file["problem"]["name"].as<std::string>();
+
+                    if (this->writer_input.modal_io_ranks > 0 && problem_name != "rkdg_swe" &&
+                        problem_name != "ehdg_swe") {
+                        std::string err_msg("Error: Modal output through I/O ranks is not supported for problem " +
+                                            problem_name + '\n');
+                        throw std::logic_error(err_msg);
+                    }
+                }
             } else {
                 std::string err_msg("Error: Modal YAML node is malformatted\n");
                 throw std::logic_error(err_msg);
@@ -270,6 +461,14 @@ InputParameters<ProblemInput>::InputParameters(const std::string& input_string,
 
     this->mesh_input.db_file_name.insert(this->mesh_input.db_file_name.find_last_of("."),
                                          '_' + std::to_string(locality_id) + '_' + std::to_string(submesh_id));
+
+    this->mesh_input.gh_file_name.insert(this->mesh_input.gh_file_name.find_last_of("."),
+                                         '_' + std::to_string(locality_id) + '_' + std::to_string(submesh_id));
+
+    // checkpoints are written into the output directory of every submesh
+    if (this->restart_input.restarting) {
+        this->restart_input.path += std::to_string(locality_id) + '_' + std::to_string(submesh_id) + '/';
+    }
 }
 
 template <typename ProblemInput>
@@ -279,6 +478,10 @@ void InputParameters<ProblemInput>::read_mesh() {
         this->mesh_input.mesh_data = MeshMetaData(adcirc_file);
     } else if (this->mesh_input.mesh_format == "Meta") {
         this->mesh_input.mesh_data = MeshMetaData(this->mesh_input.mesh_file_name);
+    } else if (this->mesh_input.mesh_format == "Binary") {
+        this->mesh_input.binary_mesh_data = std::make_shared<BinaryMeshData>(this->mesh_input.mesh_file_name);
+
+        this->mesh_input.mesh_data.mesh_name = this->mesh_input.binary_mesh_data->GetMeshName();
     }
 }
 
@@ -287,9 +490,57 @@ void InputParameters<ProblemInput>::read_bcis() {
     this->problem_input.read_bcis(this->mesh_input.bc_is_file_name);
 }
 
+template <typename ProblemInput>
+void InputParameters<ProblemInput>::read_stations() {
+    const std::string& station_file = this->writer_input.station_file_name;
+
+    if (!Utilities::file_exists(station_file)) {
+        throw std::logic_error("Fatal Error: station file " + station_file + " was not found!\n");
+    }
+
+    // number of stations, followed by one line per station: x y [name]
+    std::ifstream file(station_file);
+
+    uint n_stations;
+    file >> n_stations;
+    file.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+
+    this->writer_input.station_coordinates.resize(n_stations);
+    this->writer_input.station_names.resize(n_stations);
+
+    std::string line;
+
+    for (uint station = 0; station < n_stations; ++station) {
+        std::getline(file, line);
+        std::istringstream line_stream(line);
+
+        Point<2>& coordinates = this->writer_input.station_coordinates[station];
+
+        if (!(line_stream >> coordinates[GlobalCoord::x] >> coordinates[GlobalCoord::y])) {
+            throw std::logic_error("Fatal Error: station " + std::to_string(station) + " in station file " +
+                                   station_file + " is malformatted\n");
+        }
+
+        if (!(line_stream >> this->writer_input.station_names[station])) {
+            this->writer_input.station_names[station] = "station_" + std::to_string(station);
+        }
+    }
+}
+
 template <typename ProblemInput>
 void InputParameters<ProblemInput>::read_dbmd(const uint locality_id, const uint submesh_id) {
-    this->mesh_input.dbmd_data = DistributedBoundaryMetaData(this->mesh_input.db_file_name, locality_id, submesh_id);
+    // binary meshes carry their distributed boundary data
+    if (this->mesh_input.binary_mesh_data) {
+        this->mesh_input.dbmd_data = this->mesh_input.binary_mesh_data->get_dbmd_data(locality_id, submesh_id);
+    } else {
+        this->mesh_input.dbmd_data =
+            DistributedBoundaryMetaData(this->mesh_input.db_file_name, locality_id, submesh_id);
+    }
+}
+
+template <typename ProblemInput>
+void InputParameters<ProblemInput>::read_ghmd(const uint locality_id, const uint submesh_id) {
+    this->mesh_input.ghmd_data = GhostLayerMetaData(this->mesh_input.gh_file_name, locality_id, submesh_id);
 }
 
 template <typename ProblemInput>
@@ -356,16 +607,47 @@ void InputParameters<ProblemInput>::write_to(const std::string& output_filename)
 
         if (this->writer_input.writing_vtu_output) {
             writer["vtu"]["frequency"] = this->writer_input.vtu_output_frequency;
+            writer["vtu"]["format"]    = this->writer_input.vtu_output_format;
         }
 
         if (this->writer_input.writing_modal_output) {
             writer["modal"]["frequency"] = this->writer_input.modal_output_frequency;
+
+            if (this->writer_input.modal_shared_file) {
+                writer["modal"]["shared_file"] = true;
+            }
+
+            if (this->writer_input.modal_io_ranks > 0) {
+                writer["modal"]["io_ranks"] = this->writer_input.modal_io_ranks;
+            }
+        }
+
+        if (this->writer_input.writing_checkpoint) {
+            writer["checkpoint"]["frequency"] = this->writer_input.checkpoint_frequency;
+        }
+
+        if (this->writer_input.writing_station_output) {
+            writer["stations"]["file"]      = this->writer_input.station_file_name;
+            writer["stations"]["frequency"] = this->writer_input.station_output_frequency;
+        }
+
+        if (this->writer_input.writing_extrema_output) {
+            writer["extrema"]["frequency"] = this->writer_input.extrema_frequency;
         }
 
         output << YAML::Key << "output";
         output << YAML::Value << writer;
     }
 
+    if (this->restart_input.restarting) {
+        YAML::Node restart;
+        restart["path"] = this->restart_input.path;
+        restart["step"] = this->restart_input.step;
+
+        output << YAML::Key << "restart";
+        output << YAML::Value << restart;
+    }
+
     if (this->load_balancer_input.use_load_balancer) {
         YAML::Node load_balancer;
         load_balancer["name"]                = this->load_balancer_input.name;
@@ -375,6 +657,24 @@ void InputParameters<ProblemInput>::write_to(const std::string& output_filename)
         output << YAML::Value << load_balancer;
     }
 
+    if (!this->communicator_input.reduced_precision.empty() || this->communicator_input.backend != "two_sided" ||
+        this->communicator_input.ghost_layers) {
+        YAML::Node communication;
+
+        if (!this->communicator_input.reduced_precision.empty()) {
+            communication["reduced_precision"] = this->communicator_input.reduced_precision;
+        }
+
+        communication["backend"] = this->communicator_input.backend;
+
+        if (this->communicator_input.ghost_layers) {
+            communication["ghost_layers"] = true;
+        }
+
+        output << YAML::Key << "communication";
+        output << YAML::Value << communication;
+    }
+
     output << YAML::EndMap;
 
     std::ofstream ofs(output_filename);
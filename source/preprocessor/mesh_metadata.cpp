@@ -1,5 +1,11 @@
 #include "mesh_metadata.hpp"
 
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 MeshMetaData::MeshMetaData(const AdcircFormat& mesh_file) {
     this->mesh_name = mesh_file.name;
 
@@ -221,3 +227,395 @@ DistributedBoundaryMetaData::DistributedBoundaryMetaData(const std::string& dbmd
         this->rank_boundary_data.push_back(std::move(rank_boundary));
     }
 }
+
+namespace {
+constexpr char binary_mesh_magic[8]        = {'D', 'G', 'S', 'W', 'E', 'M', 'S', 'H'};
+constexpr std::uint64_t binary_mesh_version = 1;
+
+std::size_t align_8(const std::size_t offset) {
+    return (offset + 7) & ~(std::size_t)7;
+}
+
+// byte offsets of the sections of a binary mesh file, shared by the reader and the writer
+struct BinaryMeshLayout {
+    enum Section : uint {
+        name,
+        node_ID,
+        node_coordinates,
+        element_ID,
+        element_node_ID,
+        element_node_index,
+        element_neighbor_ID,
+        element_boundary_type,
+        rank_boundaries,
+        dboundaries,
+        n_sections = dboundaries + 5
+    };
+
+    std::array<std::size_t, n_sections> offset;
+    std::size_t file_size;
+
+    BinaryMeshLayout(const BinaryMeshData::Header& header) {
+        const std::size_t n_element_faces = header.n_elements * header.n_faces;
+
+        std::array<std::size_t, n_sections> size;
+        size[name]                  = header.name_length;
+        size[node_ID]               = header.n_nodes * sizeof(std::uint32_t);
+        size[node_coordinates]      = header.n_nodes * 3 * sizeof(double);
+        size[element_ID]            = header.n_elements * sizeof(std::uint32_t);
+        size[element_node_ID]       = n_element_faces * sizeof(std::uint32_t);
+        size[element_node_index]    = n_element_faces * sizeof(std::uint32_t);
+        size[element_neighbor_ID]   = n_element_faces * sizeof(std::uint32_t);
+        size[element_boundary_type] = n_element_faces * sizeof(std::uint8_t);
+        size[rank_boundaries]       = header.n_rank_boundaries * sizeof(BinaryMeshData::RankBoundaryRecord);
+
+        for (uint db_array = 0; db_array < 5; ++db_array) {
+            size[dboundaries + db_array] = header.n_dboundaries * sizeof(std::uint32_t);
+        }
+
+        std::size_t curr_offset = sizeof(BinaryMeshData::Header);
+
+        for (uint section = 0; section < n_sections; ++section) {
+            this->offset[section] = curr_offset;
+
+            curr_offset = align_8(curr_offset + size[section]);
+        }
+
+        this->file_size = curr_offset;
+    }
+};
+
+template <typename T>
+void write_section(std::ofstream& file, const std::vector<T>& data) {
+    static const char padding[8] = {};
+
+    const std::size_t n_bytes = data.size() * sizeof(T);
+
+    file.write((const char*)data.data(), n_bytes);
+    file.write(padding, align_8(n_bytes) - n_bytes);
+}
+}
+
+BinaryMeshData::BinaryMeshData(const std::string& mesh_file) {
+    if (!Utilities::file_exists(mesh_file)) {
+        throw std::logic_error("Fatal Error: binary mesh file " + mesh_file + " was not found!\n");
+    }
+
+    int fd = open(mesh_file.c_str(), O_RDONLY);
+
+    if (fd < 0) {
+        throw std::logic_error("Fatal Error: unable to open binary mesh file " + mesh_file + "\n");
+    }
+
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0) {
+        close(fd);
+        throw std::logic_error("Fatal Error: unable to open binary mesh file " + mesh_file + "\n");
+    }
+
+    this->file_size = file_stat.st_size;
+
+    if (this->file_size < sizeof(Header)) {
+        close(fd);
+        throw std::logic_error("Fatal Error: " + mesh_file + " is not a binary mesh file\n");
+    }
+
+    // private mapping: pages are only copied if the solver modifies them, e.g. when projecting coordinates
+    void* data = mmap(nullptr, this->file_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (data == MAP_FAILED) {
+        throw std::logic_error("Fatal Error: unable to map binary mesh file " + mesh_file + "\n");
+    }
+
+    this->file_data = (char*)data;
+
+    // elements are built in file order
+    madvise(this->file_data, this->file_size, MADV_SEQUENTIAL);
+
+    this->header = (const Header*)this->file_data;
+
+    if (std::memcmp(this->header->magic, binary_mesh_magic, 8) != 0 ||
+        this->header->version != binary_mesh_version) {
+        munmap(this->file_data, this->file_size);
+        throw std::logic_error("Fatal Error: " + mesh_file + " is not a binary mesh file of version " +
+                               std::to_string(binary_mesh_version) + "\n");
+    }
+
+    const BinaryMeshLayout layout(*this->header);
+
+    if (layout.file_size > this->file_size) {
+        munmap(this->file_data, this->file_size);
+        throw std::logic_error("Fatal Error: binary mesh file " + mesh_file + " is truncated\n");
+    }
+
+    using Section = BinaryMeshLayout::Section;
+
+    this->mesh_name = std::string(this->file_data + layout.offset[Section::name], this->header->name_length);
+
+    this->node_ID          = (const std::uint32_t*)(this->file_data + layout.offset[Section::node_ID]);
+    this->node_coordinates = (double*)(this->file_data + layout.offset[Section::node_coordinates]);
+
+    this->element_ID          = (const std::uint32_t*)(this->file_data + layout.offset[Section::element_ID]);
+    this->element_node_ID     = (const std::uint32_t*)(this->file_data + layout.offset[Section::element_node_ID]);
+    this->element_node_index  = (const std::uint32_t*)(this->file_data + layout.offset[Section::element_node_index]);
+    this->element_neighbor_ID = (const std::uint32_t*)(this->file_data + layout.offset[Section::element_neighbor_ID]);
+    this->element_boundary_type =
+        (const std::uint8_t*)(this->file_data + layout.offset[Section::element_boundary_type]);
+
+    this->rank_boundaries = (const RankBoundaryRecord*)(this->file_data + layout.offset[Section::rank_boundaries]);
+
+    for (uint db_array = 0; db_array < 5; ++db_array) {
+        this->dboundaries[db_array] =
+            (const std::uint32_t*)(this->file_data + layout.offset[Section::dboundaries + db_array]);
+    }
+}
+
+BinaryMeshData::~BinaryMeshData() {
+    if (this->file_data) {
+        munmap(this->file_data, this->file_size);
+    }
+}
+
+void BinaryMeshData::write_to(const std::string& file,
+                              const MeshMetaData& mesh_data,
+                              const DistributedBoundaryMetaData& dbmd_data) {
+    // sort by ID so that the file does not depend on the hashing of the meta data maps
+    std::vector<uint> node_IDs;
+    node_IDs.reserve(mesh_data.nodes.size());
+    for (const auto& node : mesh_data.nodes) {
+        node_IDs.push_back(node.first);
+    }
+    std::sort(node_IDs.begin(), node_IDs.end());
+
+    std::vector<uint> element_IDs;
+    element_IDs.reserve(mesh_data.elements.size());
+    for (const auto& elt : mesh_data.elements) {
+        element_IDs.push_back(elt.first);
+    }
+    std::sort(element_IDs.begin(), element_IDs.end());
+
+    const uint n_faces = element_IDs.empty() ? 0 : mesh_data.elements.at(element_IDs.front()).node_ID.size();
+
+    Header header;
+    std::memcpy(header.magic, binary_mesh_magic, 8);
+    header.version           = binary_mesh_version;
+    header.n_nodes           = node_IDs.size();
+    header.n_elements        = element_IDs.size();
+    header.n_faces           = n_faces;
+    header.n_rank_boundaries = dbmd_data.rank_boundary_data.size();
+    header.n_dboundaries     = 0;
+    header.name_length       = mesh_data.mesh_name.size();
+
+    std::unordered_map<uint, uint> node_index;
+    std::vector<std::uint32_t> node_ID_data;
+    std::vector<double> node_coordinate_data;
+
+    node_ID_data.reserve(node_IDs.size());
+    node_coordinate_data.reserve(3 * node_IDs.size());
+
+    for (uint node_ID : node_IDs) {
+        const Point<3>& coordinates = mesh_data.nodes.at(node_ID).coordinates;
+
+        node_index[node_ID] = node_ID_data.size();
+        node_ID_data.push_back(node_ID);
+
+        node_coordinate_data.insert(node_coordinate_data.end(), coordinates.begin(), coordinates.end());
+    }
+
+    std::vector<std::uint32_t> element_ID_data;
+    std::vector<std::uint32_t> element_node_ID_data;
+    std::vector<std::uint32_t> element_node_index_data;
+    std::vector<std::uint32_t> element_neighbor_ID_data;
+    std::vector<std::uint8_t> element_boundary_type_data;
+
+    for (uint elt_ID : element_IDs) {
+        const ElementMetaData& elt = mesh_data.elements.at(elt_ID);
+
+        if (elt.node_ID.size() != n_faces) {
+            throw std::logic_error("Fatal Error: binary mesh format requires all elements to have the same shape\n");
+        }
+
+        element_ID_data.push_back(elt_ID);
+
+        for (uint face = 0; face < n_faces; ++face) {
+            element_node_ID_data.push_back(elt.node_ID[face]);
+            element_node_index_data.push_back(node_index.at(elt.node_ID[face]));
+            element_neighbor_ID_data.push_back(elt.neighbor_ID[face]);
+            element_boundary_type_data.push_back(elt.boundary_type[face]);
+        }
+    }
+
+    std::vector<RankBoundaryRecord> rank_boundary_data;
+    std::array<std::vector<std::uint32_t>, 5> dboundary_data;
+
+    for (const RankBoundaryMetaData& rank_boundary : dbmd_data.rank_boundary_data) {
+        RankBoundaryRecord record;
+        record.locality_in = rank_boundary.locality_in;
+        record.locality_ex = rank_boundary.locality_ex;
+        record.submesh_in  = rank_boundary.submesh_in;
+        record.submesh_ex  = rank_boundary.submesh_ex;
+        record.begin       = header.n_dboundaries;
+        record.size        = rank_boundary.elements_in.size();
+
+        rank_boundary_data.push_back(record);
+
+        header.n_dboundaries += record.size;
+
+        dboundary_data[0].insert(
+            dboundary_data[0].end(), rank_boundary.elements_in.begin(), rank_boundary.elements_in.end());
+        dboundary_data[1].insert(
+            dboundary_data[1].end(), rank_boundary.elements_ex.begin(), rank_boundary.elements_ex.end());
+        dboundary_data[2].insert(
+            dboundary_data[2].end(), rank_boundary.bound_ids_in.begin(), rank_boundary.bound_ids_in.end());
+        dboundary_data[3].insert(
+            dboundary_data[3].end(), rank_boundary.bound_ids_ex.begin(), rank_boundary.bound_ids_ex.end());
+        dboundary_data[4].insert(dboundary_data[4].end(), rank_boundary.p.begin(), rank_boundary.p.end());
+    }
+
+    std::ofstream ofs(file, std::ios_base::binary);
+
+    ofs.write((const char*)&header, sizeof(Header));
+
+    write_section(ofs, std::vector<char>(mesh_data.mesh_name.begin(), mesh_data.mesh_name.end()));
+    write_section(ofs, node_ID_data);
+    write_section(ofs, node_coordinate_data);
+    write_section(ofs, element_ID_data);
+    write_section(ofs, element_node_ID_data);
+    write_section(ofs, element_node_index_data);
+    write_section(ofs, element_neighbor_ID_data);
+    write_section(ofs, element_boundary_type_data);
+    write_section(ofs, rank_boundary_data);
+
+    for (const std::vector<std::uint32_t>& db_array : dboundary_data) {
+        write_section(ofs, db_array);
+    }
+
+    ofs.close();
+
+    if (!ofs) {
+        throw std::logic_error("Fatal Error: unable to write binary mesh file " + file + "\n");
+    }
+}
+
+std::vector<uint> BinaryMeshData::GetElementNodeIDs(const uint elt_index) const {
+    const std::uint32_t* begin = this->element_node_ID + elt_index * this->header->n_faces;
+
+    return std::vector<uint>(begin, begin + this->header->n_faces);
+}
+
+std::vector<uint> BinaryMeshData::GetElementNeighborIDs(const uint elt_index) const {
+    const std::uint32_t* begin = this->element_neighbor_ID + elt_index * this->header->n_faces;
+
+    return std::vector<uint>(begin, begin + this->header->n_faces);
+}
+
+std::vector<uchar> BinaryMeshData::GetElementBoundaryTypes(const uint elt_index) const {
+    const std::uint8_t* begin = this->element_boundary_type + elt_index * this->header->n_faces;
+
+    return std::vector<uchar>(begin, begin + this->header->n_faces);
+}
+
+AlignedVector<Point<3>> BinaryMeshData::get_nodal_coordinates(const uint elt_index) const {
+    AlignedVector<Point<3>> nodal_coordinates(this->header->n_faces);
+
+    for (uint indx = 0; indx < this->header->n_faces; ++indx) {
+        const double* coordinates =
+            this->node_coordinates + 3 * this->element_node_index[elt_index * this->header->n_faces + indx];
+
+        nodal_coordinates[indx] = Point<3>{coordinates[0], coordinates[1], coordinates[2]};
+    }
+
+    return nodal_coordinates;
+}
+
+DistributedBoundaryMetaData BinaryMeshData::get_dbmd_data(const uint locality_id, const uint submesh_id) const {
+    DistributedBoundaryMetaData dbmd_data;
+
+    for (uint rb = 0; rb < this->header->n_rank_boundaries; ++rb) {
+        const RankBoundaryRecord& record = this->rank_boundaries[rb];
+
+        if (record.locality_in != locality_id || record.submesh_in != submesh_id) {
+            throw std::logic_error("Fatal Error: error in locality/submesh in distributed boundary data of mesh " +
+                                   this->mesh_name + "!\n");
+        }
+
+        RankBoundaryMetaData rank_boundary;
+
+        rank_boundary.locality_in = record.locality_in;
+        rank_boundary.locality_ex = record.locality_ex;
+
+        rank_boundary.submesh_in = record.submesh_in;
+        rank_boundary.submesh_ex = record.submesh_ex;
+
+        const std::size_t begin = record.begin;
+        const std::size_t end   = record.begin + record.size;
+
+        rank_boundary.elements_in.assign(this->dboundaries[0] + begin, this->dboundaries[0] + end);
+        rank_boundary.elements_ex.assign(this->dboundaries[1] + begin, this->dboundaries[1] + end);
+
+        rank_boundary.bound_ids_in.assign(this->dboundaries[2] + begin, this->dboundaries[2] + end);
+        rank_boundary.bound_ids_ex.assign(this->dboundaries[3] + begin, this->dboundaries[3] + end);
+
+        rank_boundary.p.assign(this->dboundaries[4] + begin, this->dboundaries[4] + end);
+
+        dbmd_data.rank_boundary_data.push_back(std::move(rank_boundary));
+    }
+
+    return dbmd_data;
+}
+
+GhostLayerMetaData::GhostLayerMetaData(const std::string& ghmd_file, uint locality_id, uint submesh_id) {
+    if (!Utilities::file_exists(ghmd_file)) {
+        throw std::logic_error("Fatal Error: ghost layer data file " + ghmd_file + " was not found!\n");
+    }
+
+    std::ifstream file(ghmd_file);
+
+    std::string line;
+
+    uint n_receive, n_send;
+
+    while (std::getline(file, line)) {
+        std::stringstream neighborhood_data(line);
+
+        RankGhostLayerMetaData rank_ghosts;
+
+        neighborhood_data >> rank_ghosts.locality_in >> rank_ghosts.submesh_in >> rank_ghosts.locality_ex >>
+            rank_ghosts.submesh_ex >> n_receive >> n_send;
+
+        if (rank_ghosts.locality_in != locality_id || rank_ghosts.submesh_in != submesh_id) {
+            throw std::logic_error("Fatal Error: error in locality/submesh in ghost layer file " + ghmd_file + "!\n");
+        }
+
+        rank_ghosts.elements_receive.resize(n_receive);
+        rank_ghosts.layers_receive.resize(n_receive);
+
+        for (uint ghost = 0; ghost < n_receive; ++ghost) {
+            file >> rank_ghosts.elements_receive[ghost] >> rank_ghosts.layers_receive[ghost];
+            file.ignore(1000, '\n');
+        }
+
+        rank_ghosts.elements_send.resize(n_send);
+        rank_ghosts.layers_send.resize(n_send);
+
+        for (uint ghost = 0; ghost < n_send; ++ghost) {
+            file >> rank_ghosts.elements_send[ghost] >> rank_ghosts.layers_send[ghost];
+            file.ignore(1000, '\n');
+        }
+
+        this->rank_ghost_data.push_back(std::move(rank_ghosts));
+    }
+}
+
+uint GhostLayerMetaData::GetNumberOfLayers() const {
+    uint n_layers = 0;
+
+    for (const auto& rank_ghosts : this->rank_ghost_data) {
+        for (uint layer : rank_ghosts.layers_receive) {
+            n_layers = std::max(n_layers, layer);
+        }
+    }
+
+    return n_layers;
+}
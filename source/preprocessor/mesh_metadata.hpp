@@ -147,4 +147,130 @@ struct DistributedBoundaryMetaData {
     DistributedBoundaryMetaData(const std::string& dbmd_file, uint locality_id, uint submesh_id);  // read from file
 };
 
+// Elements of neighboring submeshes which are redundantly computed on this submesh (deep halo).
+// Layer 1 elements share an edge with the submesh, layer k elements share an edge with layer k-1.
+struct RankGhostLayerMetaData {
+    uint locality_in;
+    uint locality_ex;
+
+    uint submesh_in;
+    uint submesh_ex;
+
+    // ghost elements owned by ex submesh, whose state is received from ex
+    std::vector<uint> elements_receive;
+    std::vector<uint> layers_receive;
+
+    // elements owned by in submesh, whose state is sent to ex
+    std::vector<uint> elements_send;
+    std::vector<uint> layers_send;
+
+#ifdef HAS_HPX
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned) {
+        // clang-format off
+        ar  & locality_in
+            & locality_ex
+            & submesh_in
+            & submesh_ex
+            & elements_receive
+            & layers_receive
+            & elements_send
+            & layers_send;
+        // clang-format on
+    }
+#endif
+};
+
+/**
+ * Binary mesh container written by the partitioner for every submesh.
+ * The file is memory mapped and the solver builds elements directly from its flat arrays, with no parsing and no
+ * intermediate maps. Layout (native byte order, every section aligned to 8 bytes):
+ *  - header: magic, version, number of nodes, elements, faces per element, rank boundaries, distributed
+ *    boundaries and length of the mesh name
+ *  - mesh name
+ *  - nodes: IDs, coordinates (3 per node)
+ *  - elements: IDs, node IDs, node indices into the node arrays, neighbor IDs, boundary types (n_faces each)
+ *  - rank boundaries: locality/submesh in/ex and range into the distributed boundary arrays
+ *  - distributed boundaries: elements in/ex, bound ids in/ex, p
+ */
+class BinaryMeshData {
+  public:
+    struct Header {
+        char magic[8];
+        std::uint64_t version;
+        std::uint64_t n_nodes;
+        std::uint64_t n_elements;
+        std::uint64_t n_faces;
+        std::uint64_t n_rank_boundaries;
+        std::uint64_t n_dboundaries;
+        std::uint64_t name_length;
+    };
+
+    struct RankBoundaryRecord {
+        std::uint32_t locality_in;
+        std::uint32_t locality_ex;
+        std::uint32_t submesh_in;
+        std::uint32_t submesh_ex;
+        std::uint64_t begin;
+        std::uint64_t size;
+    };
+
+  private:
+    char* file_data       = nullptr;
+    std::size_t file_size = 0;
+
+    const Header* header = nullptr;
+    std::string mesh_name;
+
+    const std::uint32_t* node_ID              = nullptr;
+    double* node_coordinates                  = nullptr;
+    const std::uint32_t* element_ID           = nullptr;
+    const std::uint32_t* element_node_ID      = nullptr;
+    const std::uint32_t* element_node_index   = nullptr;
+    const std::uint32_t* element_neighbor_ID  = nullptr;
+    const std::uint8_t* element_boundary_type = nullptr;
+
+    const RankBoundaryRecord* rank_boundaries = nullptr;
+    std::array<const std::uint32_t*, 5> dboundaries{};
+
+  public:
+    BinaryMeshData() = default;
+    BinaryMeshData(const std::string& mesh_file);  // map file
+
+    BinaryMeshData(const BinaryMeshData&) = delete;
+    BinaryMeshData& operator=(const BinaryMeshData&) = delete;
+
+    ~BinaryMeshData();
+
+    static void write_to(const std::string& file,
+                         const MeshMetaData& mesh_data,
+                         const DistributedBoundaryMetaData& dbmd_data);
+
+    const std::string& GetMeshName() const { return this->mesh_name; }
+    uint GetNumberNodes() const { return (uint)this->header->n_nodes; }
+    uint GetNumberElements() const { return (uint)this->header->n_elements; }
+    uint GetNumberFaces() const { return (uint)this->header->n_faces; }
+
+    // the mapping is private, modifying coordinates (e.g. projections) never writes back to the file
+    double* GetNodeCoordinates() { return this->node_coordinates; }
+
+    uint GetElementID(const uint elt_index) const { return this->element_ID[elt_index]; }
+    std::vector<uint> GetElementNodeIDs(const uint elt_index) const;
+    std::vector<uint> GetElementNeighborIDs(const uint elt_index) const;
+    std::vector<uchar> GetElementBoundaryTypes(const uint elt_index) const;
+
+    AlignedVector<Point<3>> get_nodal_coordinates(const uint elt_index) const;
+
+    DistributedBoundaryMetaData get_dbmd_data(const uint locality_id, const uint submesh_id) const;
+};
+
+struct GhostLayerMetaData {
+    std::vector<RankGhostLayerMetaData> rank_ghost_data;
+
+    GhostLayerMetaData() = default;
+    GhostLayerMetaData(const std::string& ghmd_file, uint locality_id, uint submesh_id);  // read from file
+
+    uint GetNumberOfLayers() const;
+};
+
 #endif
\ No newline at end of file
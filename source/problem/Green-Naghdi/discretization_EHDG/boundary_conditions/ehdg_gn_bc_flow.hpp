@@ -7,7 +7,8 @@ namespace BC {
 class Flow : public SWE_SIM::BC::Flow {
   public:
     Flow() = default;
-    Flow(const std::vector<SWE::FlowNode>& flow_input) : SWE_SIM::BC::Flow(flow_input) {}
+    Flow(const std::vector<SWE::FlowNode>& flow_input, const std::shared_ptr<SWE::HarmonicPhasors>& phasors)
+        : SWE_SIM::BC::Flow(flow_input, phasors) {}
 
     template <typename StepperType, typename EdgeBoundaryType>
     void ComputeGlobalKernelsDC(const StepperType& stepper, EdgeBoundaryType& edge_bound);
@@ -39,6 +39,9 @@ struct Problem {
     using ProblemWriterType  = Writer<Problem>;
     using ProblemParserType  = GN::Parser;
 
+    using ProblemOutputSnapshotType = SWE::OutputSnapshot;
+    using ProblemExtremaType        = SWE::Extrema;
+
     using ProblemDataType       = GN::Data;
     using ProblemEdgeDataType   = GN::EdgeData;
     using ProblemGlobalDataType = GN::GlobalData;
@@ -96,6 +99,18 @@ struct Problem {
         return offset;
     }
 
+    static uint comm_type_id(const std::string& comm_type_name) {
+        if (comm_type_name == "dc_global_dof_indx") {
+            throw std::logic_error("Fatal Error: dc_global_dof_indx must be communicated in full precision\n");
+        } else if (comm_type_name == "dbath") {
+            return CommTypes::dbath;
+        } else if (comm_type_name == "derivatives") {
+            return CommTypes::derivatives;
+        }
+
+        return SWE_SIM::Problem::comm_type_id(comm_type_name);
+    }
+
     template <typename RawBoundaryType>
     static void create_interfaces(std::map<uchar, std::map<std::pair<uint, uint>, RawBoundaryType>>& raw_boundaries,
                                   ProblemMeshType& mesh,
@@ -131,6 +146,11 @@ struct Problem {
         GN::create_distributed_boundaries<GN::EHDG::Problem>(raw_boundaries, mesh, input, communicator, writer);
     }
 
+    template <typename Communicator>
+    static void create_ghost_layers(ProblemMeshType&, Communicator&, ProblemWriterType&) {
+        throw std::logic_error("Fatal Error: ghost layers are not supported by the EHDG GN problem\n");
+    }
+
     static void create_edge_interfaces(ProblemMeshType& mesh,
                                        ProblemMeshSkeletonType& mesh_skeleton,
                                        ProblemWriterType& writer) {
@@ -269,18 +289,56 @@ struct Problem {
     static void dispersive_correction_kernel(const ESSPRKStepper& stepper, ElementType& elt);
 
     // writing output kernels
-    static void write_VTK_data(ProblemMeshType& mesh, std::ofstream& raw_data_file) {
-        return SWE::write_VTK_data(mesh, raw_data_file);
+    static void take_output_snapshot(const ProblemStepperType& stepper,
+                                     ProblemMeshType& mesh,
+                                     ProblemOutputSnapshotType& snapshot) {
+        return SWE::take_output_snapshot(stepper, mesh, snapshot);
+    }
+
+    static void write_VTK_data(const ProblemOutputSnapshotType& snapshot, std::ofstream& raw_data_file) {
+        return SWE::write_VTK_data(snapshot, raw_data_file);
+    }
+
+    static void write_VTU_data(const ProblemOutputSnapshotType& snapshot,
+                               std::ofstream& raw_data_file,
+                               const Utilities::VTUFormat format) {
+        return SWE::write_VTU_data(snapshot, raw_data_file, format);
+    }
+
+    static void write_modal_data(const ProblemOutputSnapshotType& snapshot, const std::string& output_path) {
+        return SWE::write_modal_data(snapshot, output_path);
+    }
+
+    static void write_station_data(ProblemMeshType& mesh,
+                                   const std::vector<uint>& element_IDs,
+                                   std::vector<double>& station_data) {
+        return SWE::write_station_data(mesh, element_IDs, station_data);
+    }
+
+    static void update_extrema(const ProblemStepperType& stepper, ProblemMeshType& mesh, ProblemExtremaType& extrema) {
+        return SWE::update_extrema(stepper, mesh, extrema);
+    }
+
+    static void write_extrema_VTU_data(const ProblemExtremaType& extrema,
+                                       std::ofstream& raw_data_file,
+                                       const Utilities::VTUFormat format) {
+        return SWE::write_extrema_VTU_data(extrema, raw_data_file, format);
+    }
+
+    static void write_extrema_checkpoint(const ProblemExtremaType& extrema, std::ostream& file) {
+        return SWE::write_extrema_checkpoint(extrema, file);
+    }
+
+    static void read_extrema_checkpoint(ProblemMeshType& mesh, ProblemExtremaType& extrema, std::istream& file) {
+        return SWE::read_extrema_checkpoint(mesh, extrema, file);
     }
 
-    static void write_VTU_data(ProblemMeshType& mesh, std::ofstream& raw_data_file) {
-        return SWE::write_VTU_data(mesh, raw_data_file);
+    static void write_checkpoint_data(ProblemMeshType& mesh, std::ostream& file) {
+        return SWE::write_checkpoint_data(mesh, file);
     }
 
-    static void write_modal_data(const ProblemStepperType& stepper,
-                                 ProblemMeshType& mesh,
-                                 const std::string& output_path) {
-        return SWE::write_modal_data(stepper, mesh, output_path);
+    static void read_checkpoint_data(ProblemMeshType& mesh, std::istream& file) {
+        return SWE::read_checkpoint_data(mesh, file);
     }
 
     template <typename ElementType>
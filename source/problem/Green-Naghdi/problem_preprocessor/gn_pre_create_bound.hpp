@@ -35,6 +35,9 @@ void create_boundaries(std::map<uchar, std::map<std::pair<uint, uint>, RawBounda
 
             auto& tide_data = problem_input.tide_bc_data;
 
+            // boundaries forced by the same constituents share their phasors
+            std::vector<std::shared_ptr<SWE::HarmonicPhasors>> tide_phasors(tide_data.size());
+
             auto itt = it->second.begin();
             while (itt != it->second.end()) {
                 auto& raw_boundary = itt->second;
@@ -43,8 +46,10 @@ void create_boundaries(std::map<uchar, std::map<std::pair<uint, uint>, RawBounda
 
                 bool found_data = false;
 
-                for (auto& tide_bound : tide_data) {
-                    found_data = tide_bound.get_tide_data(raw_boundary.node_ID, tide);
+                uint tide_index;
+
+                for (tide_index = 0; tide_index < tide_data.size(); ++tide_index) {
+                    found_data = tide_data[tide_index].get_tide_data(raw_boundary.node_ID, tide);
 
                     if (found_data)
                         break;
@@ -53,7 +58,11 @@ void create_boundaries(std::map<uchar, std::map<std::pair<uint, uint>, RawBounda
                 if (!found_data)
                     throw std::logic_error("Fatal Error: unable to find tide data!\n");
 
-                mesh.template CreateBoundary<BoundaryTypeTide>(std::move(raw_boundary), tide);
+                if (!tide_phasors[tide_index]) {
+                    tide_phasors[tide_index] = std::make_shared<SWE::HarmonicPhasors>(tide[0].frequency);
+                }
+
+                mesh.template CreateBoundary<BoundaryTypeTide>(std::move(raw_boundary), tide, tide_phasors[tide_index]);
 
                 it->second.erase(itt++);
             }
@@ -67,6 +76,9 @@ void create_boundaries(std::map<uchar, std::map<std::pair<uint, uint>, RawBounda
 
             auto& flow_data = problem_input.flow_bc_data;
 
+            // boundaries forced by the same constituents share their phasors
+            std::vector<std::shared_ptr<SWE::HarmonicPhasors>> flow_phasors(flow_data.size());
+
             auto itt = it->second.begin();
             while (itt != it->second.end()) {
                 auto& raw_boundary = itt->second;
@@ -75,8 +87,10 @@ void create_boundaries(std::map<uchar, std::map<std::pair<uint, uint>, RawBounda
 
                 bool found_data = false;
 
-                for (auto& flow_bound : flow_data) {
-                    found_data = flow_bound.get_flow_data(raw_boundary.node_ID, flow);
+                uint flow_index;
+
+                for (flow_index = 0; flow_index < flow_data.size(); ++flow_index) {
+                    found_data = flow_data[flow_index].get_flow_data(raw_boundary.node_ID, flow);
 
                     if (found_data)
                         break;
@@ -85,7 +99,11 @@ void create_boundaries(std::map<uchar, std::map<std::pair<uint, uint>, RawBounda
                 if (!found_data)
                     throw std::logic_error("Fatal Error: unable to find flow data!\n");
 
-                mesh.template CreateBoundary<BoundaryTypeFlow>(std::move(raw_boundary), flow);
+                if (!flow_phasors[flow_index]) {
+                    flow_phasors[flow_index] = std::make_shared<SWE::HarmonicPhasors>(flow[0].frequency);
+                }
+
+                mesh.template CreateBoundary<BoundaryTypeFlow>(std::move(raw_boundary), flow, flow_phasors[flow_index]);
 
                 it->second.erase(itt++);
             }
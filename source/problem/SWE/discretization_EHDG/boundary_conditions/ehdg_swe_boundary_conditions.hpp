@@ -1,6 +1,8 @@
 #ifndef EHDG_SWE_BOUNDARY_CONDITIONS_HPP
 #define EHDG_SWE_BOUNDARY_CONDITIONS_HPP
 
+#include "problem/SWE/problem_boundary_conditions/swe_harmonic_forcing.hpp"
+
 #include "ehdg_swe_bc_land.hpp"
 #include "ehdg_swe_bc_flow.hpp"
 #include "ehdg_swe_bc_tide.hpp"
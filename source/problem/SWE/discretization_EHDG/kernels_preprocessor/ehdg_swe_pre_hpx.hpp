@@ -15,6 +15,8 @@ auto Problem::preprocessor_hpx(HPXSimUnitType* sim_unit) {
 
     sim_unit->communicator.SendAll(CommTypes::baryctr_coord, sim_unit->stepper.GetTimestamp());
 
+    future = sim_unit->communicator.WaitAllReceives(CommTypes::baryctr_coord, std::move(future));
+
     future = future.then([sim_unit](auto&&) {
         SWE::initialize_data_parallel_post_receive(sim_unit->discretization.mesh, CommTypes::baryctr_coord);
 
@@ -22,7 +24,9 @@ auto Problem::preprocessor_hpx(HPXSimUnitType* sim_unit) {
 
         sim_unit->communicator.SendAll(CommTypes::init_global_prob, sim_unit->stepper.GetTimestamp());
 
-        return sim_unit->communicator.ReceiveAll(CommTypes::init_global_prob, sim_unit->stepper.GetTimestamp());
+        return sim_unit->communicator.WaitAllReceives(
+            CommTypes::init_global_prob,
+            sim_unit->communicator.ReceiveAll(CommTypes::init_global_prob, sim_unit->stepper.GetTimestamp()));
     });
 
     return future.then([sim_unit](auto&&) {
@@ -2,6 +2,7 @@
 #define EHDG_SWE_PROC_HPX_STAGE_HPP
 
 #include "ehdg_swe_kernels_processor.hpp"
+#include "utilities/kernel_timers.hpp"
 
 namespace SWE {
 namespace EHDG {
@@ -14,46 +15,68 @@ auto Problem::stage_hpx(HPXSimUnitType* sim_unit) {
         sim_unit->writer.GetLogFile() << "Exchanging data" << std::endl;
     }
 
+    START_KERNEL_PHASE(sim_unit->discretization.timers, comm_start);
     hpx::future<void> receive_future =
         sim_unit->communicator.ReceiveAll(CommTypes::bound_state, sim_unit->stepper.GetTimestamp());
+    STOP_KERNEL_PHASE(sim_unit->discretization.timers, comm_start);
 
+    START_KERNEL_PHASE(sim_unit->discretization.timers, distributed_boundary);
     sim_unit->discretization.mesh.CallForEachDistributedBoundary(
         [sim_unit](auto& dbound) { Problem::global_distributed_boundary_kernel(sim_unit->stepper, dbound); });
+    STOP_KERNEL_PHASE(sim_unit->discretization.timers, distributed_boundary);
 
+    START_KERNEL_PHASE(sim_unit->discretization.timers, comm_start);
     sim_unit->communicator.SendAll(CommTypes::bound_state, sim_unit->stepper.GetTimestamp());
+    STOP_KERNEL_PHASE(sim_unit->discretization.timers, comm_start);
 
     if (sim_unit->writer.WritingVerboseLog()) {
         sim_unit->writer.GetLogFile() << "Starting work before receive" << std::endl;
     }
 
     /* Global Pre Receive Step */
+    START_KERNEL_PHASE(sim_unit->discretization.timers, interface);
     sim_unit->discretization.mesh.CallForEachInterface(
         [sim_unit](auto& intface) { Problem::global_interface_kernel(sim_unit->stepper, intface); });
+    STOP_KERNEL_PHASE(sim_unit->discretization.timers, interface);
 
+    START_KERNEL_PHASE(sim_unit->discretization.timers, boundary);
     sim_unit->discretization.mesh.CallForEachBoundary(
         [sim_unit](auto& bound) { Problem::global_boundary_kernel(sim_unit->stepper, bound); });
+    STOP_KERNEL_PHASE(sim_unit->discretization.timers, boundary);
 
+    START_KERNEL_PHASE(sim_unit->discretization.timers, interface);
     sim_unit->discretization.mesh_skeleton.CallForEachEdgeInterface(
         [](auto& edge_int) { edge_int.interface.specialization.ComputeNumericalFlux(edge_int); });
+    STOP_KERNEL_PHASE(sim_unit->discretization.timers, interface);
 
+    START_KERNEL_PHASE(sim_unit->discretization.timers, boundary);
     sim_unit->discretization.mesh_skeleton.CallForEachEdgeBoundary([sim_unit](auto& edge_bound) {
         edge_bound.boundary.boundary_condition.ComputeNumericalFlux(sim_unit->stepper, edge_bound);
     });
+    STOP_KERNEL_PHASE(sim_unit->discretization.timers, boundary);
 
     /* Global Pre Receive Step */
 
     /* Local Pre Receive Step */
+    START_KERNEL_PHASE(sim_unit->discretization.timers, volume);
     sim_unit->discretization.mesh.CallForEachElement(
         [sim_unit](auto& elt) { Problem::local_volume_kernel(sim_unit->stepper, elt); });
+    STOP_KERNEL_PHASE(sim_unit->discretization.timers, volume);
 
+    START_KERNEL_PHASE(sim_unit->discretization.timers, source);
     sim_unit->discretization.mesh.CallForEachElement(
         [sim_unit](auto& elt) { Problem::local_source_kernel(sim_unit->stepper, elt); });
+    STOP_KERNEL_PHASE(sim_unit->discretization.timers, source);
 
+    START_KERNEL_PHASE(sim_unit->discretization.timers, interface);
     sim_unit->discretization.mesh.CallForEachInterface(
         [sim_unit](auto& intface) { Problem::local_interface_kernel(sim_unit->stepper, intface); });
+    STOP_KERNEL_PHASE(sim_unit->discretization.timers, interface);
 
+    START_KERNEL_PHASE(sim_unit->discretization.timers, boundary);
     sim_unit->discretization.mesh.CallForEachBoundary(
         [sim_unit](auto& bound) { Problem::local_boundary_kernel(sim_unit->stepper, bound); });
+    STOP_KERNEL_PHASE(sim_unit->discretization.timers, boundary);
     /* Local Pre Receive Step */
 
     if (sim_unit->writer.WritingVerboseLog()) {
@@ -62,20 +85,32 @@ auto Problem::stage_hpx(HPXSimUnitType* sim_unit) {
                                       << sim_unit->stepper.GetTimestamp() << std::endl;
     }
 
+    // the wait lasts until the continuation runs
+    START_KERNEL_PHASE(sim_unit->discretization.timers, halo_wait);
+
+    receive_future = sim_unit->communicator.WaitAllReceives(CommTypes::bound_state, std::move(receive_future));
+
     hpx::future<void> stage_future = receive_future.then([sim_unit](auto&&) {
+        STOP_KERNEL_PHASE(sim_unit->discretization.timers, halo_wait);
+
         if (sim_unit->writer.WritingVerboseLog()) {
             sim_unit->writer.GetLogFile() << "Starting work after receive" << std::endl;
         }
 
         /* Global Post Receive Step */
+        START_KERNEL_PHASE(sim_unit->discretization.timers, distributed_boundary);
         sim_unit->discretization.mesh_skeleton.CallForEachEdgeDistributed(
             [](auto& edge_dbound) { edge_dbound.boundary.boundary_condition.ComputeNumericalFlux(edge_dbound); });
+        STOP_KERNEL_PHASE(sim_unit->discretization.timers, distributed_boundary);
         /* Global Post Receive Step */
 
         /* Local Post Receive Step */
+        START_KERNEL_PHASE(sim_unit->discretization.timers, distributed_boundary);
         sim_unit->discretization.mesh.CallForEachDistributedBoundary(
             [sim_unit](auto& dbound) { Problem::local_distributed_boundary_kernel(sim_unit->stepper, dbound); });
+        STOP_KERNEL_PHASE(sim_unit->discretization.timers, distributed_boundary);
 
+        START_KERNEL_PHASE(sim_unit->discretization.timers, update);
         sim_unit->discretization.mesh.CallForEachElement([sim_unit](auto& elt) {
             auto& state = elt.data.state[sim_unit->stepper.GetStage()];
 
@@ -83,6 +118,7 @@ auto Problem::stage_hpx(HPXSimUnitType* sim_unit) {
 
             sim_unit->stepper.UpdateState(elt);
         });
+        STOP_KERNEL_PHASE(sim_unit->discretization.timers, update);
 
         ++(sim_unit->stepper);
         /* Local Post Receive Step */
@@ -96,8 +132,10 @@ auto Problem::stage_hpx(HPXSimUnitType* sim_unit) {
         stage_future = stage_future.then([sim_unit](auto&& f) {
             f.get();  // check for exceptions
 
+            START_KERNEL_PHASE(sim_unit->discretization.timers, wetting_drying);
             sim_unit->discretization.mesh.CallForEachElement(
                 [sim_unit](auto& elt) { wetting_drying_kernel(sim_unit->stepper, elt); });
+            STOP_KERNEL_PHASE(sim_unit->discretization.timers, wetting_drying);
         });
     }
 
@@ -112,12 +150,14 @@ auto Problem::stage_hpx(HPXSimUnitType* sim_unit) {
     return stage_future.then([sim_unit](auto&& f) {
         f.get();  // check for exceptions
 
+        START_KERNEL_PHASE(sim_unit->discretization.timers, scrutinize);
         sim_unit->discretization.mesh.CallForEachElement([sim_unit](auto& elt) {
             bool nan_found = SWE::scrutinize_solution(sim_unit->stepper, elt);
 
             if (nan_found)
                 hpx::terminate();
         });
+        STOP_KERNEL_PHASE(sim_unit->discretization.timers, scrutinize);
     });
 }
 }
@@ -2,6 +2,7 @@
 #define EHDG_SWE_PROC_OMPI_STEP_HPP
 
 #include "ehdg_swe_kernels_processor.hpp"
+#include "utilities/kernel_timers.hpp"
 
 namespace SWE {
 namespace EHDG {
@@ -14,7 +15,9 @@ void Problem::step_ompi(std::vector<std::unique_ptr<OMPISimUnitType<ProblemType>
     for (uint stage = 0; stage < stepper.GetNumStages(); ++stage) {
         for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
             if (sim_units[su_id]->parser.ParsingInput()) {
+                START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, parse);
                 sim_units[su_id]->parser.ParseInput(stepper, sim_units[su_id]->discretization.mesh);
+                STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, parse);
             }
         }
 
@@ -23,7 +26,9 @@ void Problem::step_ompi(std::vector<std::unique_ptr<OMPISimUnitType<ProblemType>
 
     for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
         if (sim_units[su_id]->writer.WritingOutput()) {
+            START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, output);
             sim_units[su_id]->writer.WriteOutput(stepper, sim_units[su_id]->discretization.mesh);
+            STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, output);
         }
     }
 }
@@ -42,12 +47,24 @@ void Problem::stage_ompi(std::vector<std::unique_ptr<OMPISimUnitType<ProblemType
             sim_units[su_id]->writer.GetLogFile() << "Exchanging data" << std::endl;
         }
 
+        START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, comm_start);
+
         sim_units[su_id]->communicator.ReceiveAll(CommTypes::bound_state, stepper.GetTimestamp());
 
+        if (SWE::PostProcessing::slope_limiting) {
+            sim_units[su_id]->communicator.ReceiveAll(CommTypes::baryctr_state, stepper.GetTimestamp());
+        }
+
+        STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, comm_start);
+
+        START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, distributed_boundary);
         sim_units[su_id]->discretization.mesh.CallForEachDistributedBoundary(
             [&stepper](auto& dbound) { Problem::global_distributed_boundary_kernel(stepper, dbound); });
+        STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, distributed_boundary);
 
+        START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, comm_start);
         sim_units[su_id]->communicator.SendAll(CommTypes::bound_state, stepper.GetTimestamp());
+        STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, comm_start);
     }
 
     for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
@@ -56,33 +73,49 @@ void Problem::stage_ompi(std::vector<std::unique_ptr<OMPISimUnitType<ProblemType
         }
 
         /* Global Pre Receive Step */
+        START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, interface);
         sim_units[su_id]->discretization.mesh.CallForEachInterface(
             [&stepper](auto& intface) { Problem::global_interface_kernel(stepper, intface); });
+        STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, interface);
 
+        START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, boundary);
         sim_units[su_id]->discretization.mesh.CallForEachBoundary(
             [&stepper](auto& bound) { Problem::global_boundary_kernel(stepper, bound); });
+        STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, boundary);
 
+        START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, interface);
         sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeInterface(
             [](auto& edge_int) { edge_int.interface.specialization.ComputeNumericalFlux(edge_int); });
+        STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, interface);
 
+        START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, boundary);
         sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeBoundary([&stepper](auto& edge_bound) {
             edge_bound.boundary.boundary_condition.ComputeNumericalFlux(stepper, edge_bound);
         });
+        STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, boundary);
 
         /* Global Pre Receive Step */
 
         /* Local Pre Receive Step */
+        START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, volume);
         sim_units[su_id]->discretization.mesh.CallForEachElement(
             [&stepper](auto& elt) { Problem::local_volume_kernel(stepper, elt); });
+        STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, volume);
 
+        START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, source);
         sim_units[su_id]->discretization.mesh.CallForEachElement(
             [&stepper](auto& elt) { Problem::local_source_kernel(stepper, elt); });
+        STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, source);
 
+        START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, interface);
         sim_units[su_id]->discretization.mesh.CallForEachInterface(
             [&stepper](auto& intface) { Problem::local_interface_kernel(stepper, intface); });
+        STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, interface);
 
+        START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, boundary);
         sim_units[su_id]->discretization.mesh.CallForEachBoundary(
             [&stepper](auto& bound) { Problem::local_boundary_kernel(stepper, bound); });
+        STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, boundary);
         /* Local Pre Receive Step */
 
         if (sim_units[su_id]->writer.WritingVerboseLog()) {
@@ -96,21 +129,28 @@ void Problem::stage_ompi(std::vector<std::unique_ptr<OMPISimUnitType<ProblemType
                 << "Starting to wait on receive with timestamp: " << stepper.GetTimestamp() << std::endl;
         }
 
+        START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, halo_wait);
         sim_units[su_id]->communicator.WaitAllReceives(CommTypes::bound_state, stepper.GetTimestamp());
+        STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, halo_wait);
 
         if (sim_units[su_id]->writer.WritingVerboseLog()) {
             sim_units[su_id]->writer.GetLogFile() << "Starting work after receive" << std::endl;
         }
 
         /* Global Post Receive Step */
+        START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, distributed_boundary);
         sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeDistributed(
             [](auto& edge_dbound) { edge_dbound.boundary.boundary_condition.ComputeNumericalFlux(edge_dbound); });
+        STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, distributed_boundary);
         /* Global Post Receive Step */
 
         /* Local Post Receive Step */
+        START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, distributed_boundary);
         sim_units[su_id]->discretization.mesh.CallForEachDistributedBoundary(
             [&stepper](auto& dbound) { Problem::local_distributed_boundary_kernel(stepper, dbound); });
+        STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, distributed_boundary);
 
+        START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, update);
         sim_units[su_id]->discretization.mesh.CallForEachElement([&stepper](auto& elt) {
             auto& state = elt.data.state[stepper.GetStage()];
 
@@ -118,6 +158,7 @@ void Problem::stage_ompi(std::vector<std::unique_ptr<OMPISimUnitType<ProblemType
 
             stepper.UpdateState(elt);
         });
+        STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, update);
         /* Local Post Receive Step */
 
         if (sim_units[su_id]->writer.WritingVerboseLog()) {
@@ -132,8 +173,10 @@ void Problem::stage_ompi(std::vector<std::unique_ptr<OMPISimUnitType<ProblemType
 
     if (SWE::PostProcessing::wetting_drying) {
         for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
+            START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, wetting_drying);
             sim_units[su_id]->discretization.mesh.CallForEachElement(
                 [&stepper](auto& elt) { wetting_drying_kernel(stepper, elt); });
+            STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, wetting_drying);
         }
     }
 
@@ -142,16 +185,26 @@ void Problem::stage_ompi(std::vector<std::unique_ptr<OMPISimUnitType<ProblemType
     }
 
     for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
+        START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, scrutinize);
         sim_units[su_id]->discretization.mesh.CallForEachElement([&stepper](auto& elt) {
             bool nan_found = SWE::scrutinize_solution(stepper, elt);
 
             if (nan_found)
                 MPI_Abort(MPI_COMM_WORLD, 0);
         });
+        STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, scrutinize);
     }
 
     for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
+        START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, comm_complete);
+
         sim_units[su_id]->communicator.WaitAllSends(CommTypes::bound_state, stepper.GetTimestamp());
+
+        if (SWE::PostProcessing::slope_limiting) {
+            sim_units[su_id]->communicator.WaitAllSends(CommTypes::baryctr_state, stepper.GetTimestamp());
+        }
+
+        STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, comm_complete);
     }
 }
 }
@@ -2,6 +2,7 @@
 #define EHDG_SWE_PROC_SERIAL_STEP_HPP
 
 #include "ehdg_swe_kernels_processor.hpp"
+#include "utilities/kernel_timers.hpp"
 
 namespace SWE {
 namespace EHDG {
@@ -13,14 +14,18 @@ void Problem::step_serial(HDGDiscretization<ProblemType>& discretization,
                           typename ProblemType::ProblemParserType& parser) {
     for (uint stage = 0; stage < stepper.GetNumStages(); ++stage) {
         if (parser.ParsingInput()) {
+            START_KERNEL_PHASE(discretization.timers, parse);
             parser.ParseInput(stepper, discretization.mesh);
+            STOP_KERNEL_PHASE(discretization.timers, parse);
         }
 
         Problem::stage_serial(discretization, global_data, stepper);
     }
 
     if (writer.WritingOutput()) {
+        START_KERNEL_PHASE(discretization.timers, output);
         writer.WriteOutput(stepper, discretization.mesh);
+        STOP_KERNEL_PHASE(discretization.timers, output);
     }
 }
 
@@ -29,31 +34,48 @@ void Problem::stage_serial(HDGDiscretization<ProblemType>& discretization,
                            typename ProblemType::ProblemGlobalDataType& global_data,
                            ProblemStepperType& stepper) {
     /* Global Step */
+    START_KERNEL_PHASE(discretization.timers, interface);
     discretization.mesh.CallForEachInterface(
         [&stepper](auto& intface) { Problem::global_interface_kernel(stepper, intface); });
+    STOP_KERNEL_PHASE(discretization.timers, interface);
 
+    START_KERNEL_PHASE(discretization.timers, boundary);
     discretization.mesh.CallForEachBoundary(
         [&stepper](auto& bound) { Problem::global_boundary_kernel(stepper, bound); });
+    STOP_KERNEL_PHASE(discretization.timers, boundary);
 
+    START_KERNEL_PHASE(discretization.timers, interface);
     discretization.mesh_skeleton.CallForEachEdgeInterface(
         [](auto& edge_int) { edge_int.interface.specialization.ComputeNumericalFlux(edge_int); });
+    STOP_KERNEL_PHASE(discretization.timers, interface);
 
+    START_KERNEL_PHASE(discretization.timers, boundary);
     discretization.mesh_skeleton.CallForEachEdgeBoundary([&stepper](auto& edge_bound) {
         edge_bound.boundary.boundary_condition.ComputeNumericalFlux(stepper, edge_bound);
     });
+    STOP_KERNEL_PHASE(discretization.timers, boundary);
     /* Global Step */
 
     /* Local Step */
+    START_KERNEL_PHASE(discretization.timers, volume);
     discretization.mesh.CallForEachElement([&stepper](auto& elt) { Problem::local_volume_kernel(stepper, elt); });
+    STOP_KERNEL_PHASE(discretization.timers, volume);
 
+    START_KERNEL_PHASE(discretization.timers, source);
     discretization.mesh.CallForEachElement([&stepper](auto& elt) { Problem::local_source_kernel(stepper, elt); });
+    STOP_KERNEL_PHASE(discretization.timers, source);
 
+    START_KERNEL_PHASE(discretization.timers, interface);
     discretization.mesh.CallForEachInterface(
         [&stepper](auto& intface) { Problem::local_interface_kernel(stepper, intface); });
+    STOP_KERNEL_PHASE(discretization.timers, interface);
 
+    START_KERNEL_PHASE(discretization.timers, boundary);
     discretization.mesh.CallForEachBoundary(
         [&stepper](auto& bound) { Problem::local_boundary_kernel(stepper, bound); });
+    STOP_KERNEL_PHASE(discretization.timers, boundary);
 
+    START_KERNEL_PHASE(discretization.timers, update);
     discretization.mesh.CallForEachElement([&stepper](auto& elt) {
         auto& state = elt.data.state[stepper.GetStage()];
 
@@ -61,18 +83,24 @@ void Problem::stage_serial(HDGDiscretization<ProblemType>& discretization,
 
         stepper.UpdateState(elt);
     });
+    STOP_KERNEL_PHASE(discretization.timers, update);
     /* Local Step */
 
     ++stepper;
 
     if (SWE::PostProcessing::wetting_drying) {
+        START_KERNEL_PHASE(discretization.timers, wetting_drying);
         discretization.mesh.CallForEachElement([&stepper](auto& elt) { wetting_drying_kernel(stepper, elt); });
+        STOP_KERNEL_PHASE(discretization.timers, wetting_drying);
     }
 
     if (SWE::PostProcessing::slope_limiting) {
+        START_KERNEL_PHASE(discretization.timers, slope_limiter);
         CS_slope_limiter_serial(stepper, discretization);
+        STOP_KERNEL_PHASE(discretization.timers, slope_limiter);
     }
 
+    START_KERNEL_PHASE(discretization.timers, scrutinize);
     discretization.mesh.CallForEachElement([&stepper](auto& elt) {
         bool nan_found = SWE::scrutinize_solution(stepper, elt);
 
@@ -81,6 +109,7 @@ void Problem::stage_serial(HDGDiscretization<ProblemType>& discretization,
             abort();
         }
     });
+    STOP_KERNEL_PHASE(discretization.timers, scrutinize);
 }
 }
 }
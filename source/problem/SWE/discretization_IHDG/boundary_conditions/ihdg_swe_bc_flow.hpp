@@ -12,15 +12,7 @@ class Flow {
     HybMatrix<double, SWE::n_variables> q_ex;
     DynRowVector<double> qn;
 
-    std::vector<double> frequency;
-    std::vector<double> forcing_fact;
-    std::vector<double> equilib_arg;
-
-    std::vector<DynRowVector<double>> amplitude;
-    std::vector<DynRowVector<double>> phase;
-
-    std::vector<DynRowVector<double>> amplitude_gp;
-    std::vector<DynRowVector<double>> phase_gp;
+    HarmonicForcing forcing;
 
     AlignedVector<StatMatrix<double, SWE::n_variables, SWE::n_variables>> Aplus;
     AlignedVector<StatMatrix<double, SWE::n_variables, SWE::n_variables>> dAplus_dze;
@@ -37,7 +29,7 @@ class Flow {
 
   public:
     Flow() = default;
-    Flow(const std::vector<FlowNode>& flow_input);
+    Flow(const std::vector<FlowNode>& flow_input, const std::shared_ptr<HarmonicPhasors>& phasors);
 
     template <typename BoundaryType>
     void Initialize(BoundaryType& bound);
@@ -49,43 +41,17 @@ class Flow {
     void ComputeGlobalKernels(const StepperType& stepper, EdgeBoundaryType& edge_bound);
 };
 
-Flow::Flow(const std::vector<FlowNode>& flow_input) {
-    this->frequency    = flow_input[0].frequency;
-    this->forcing_fact = flow_input[0].forcing_fact;
-    this->equilib_arg  = flow_input[0].equilib_arg;
-
-    uint n_contituents = this->frequency.size();
-    uint n_nodes       = flow_input.size();
-
-    this->amplitude.resize(n_contituents);
-    this->phase.resize(n_contituents);
-
-    for (uint con = 0; con < n_contituents; ++con) {
-        this->amplitude[con].resize(n_nodes);
-        this->phase[con].resize(n_nodes);
-
-        for (uint node = 0; node < n_nodes; ++node) {
-            this->amplitude[con][node] = flow_input[node].amplitude[con];
-            this->phase[con][node]     = flow_input[node].phase[con];
-        }
-    }
-}
+Flow::Flow(const std::vector<FlowNode>& flow_input, const std::shared_ptr<HarmonicPhasors>& phasors)
+    : forcing(flow_input, phasors) {}
 
 template <typename BoundaryType>
 void Flow::Initialize(BoundaryType& bound) {
-    uint ngp           = bound.data.get_ngp_boundary(bound.bound_id);
-    uint n_contituents = this->frequency.size();
+    uint ngp = bound.data.get_ngp_boundary(bound.bound_id);
 
     this->q_ex.resize(SWE::n_variables, ngp);
     this->qn.resize(ngp);
 
-    this->amplitude_gp.resize(n_contituents);
-    this->phase_gp.resize(n_contituents);
-
-    for (uint con = 0; con < n_contituents; ++con) {
-        this->amplitude_gp[con] = bound.ComputeBoundaryNodalUgp(this->amplitude[con]);
-        this->phase_gp[con]     = bound.ComputeBoundaryNodalUgp(this->phase[con]);
-    }
+    this->forcing.Initialize(bound);
 
     this->Aplus.resize(ngp);
     this->dAplus_dze.resize(ngp);
@@ -111,15 +77,7 @@ void Flow::ComputeInitTrace(const StepperType& stepper, EdgeBoundaryType& edge_b
 
     set_constant(edge_state.q_hat, 0.0);
 
-    set_constant(this->qn, 0.0);
-
-    for (uint con = 0; con < this->frequency.size(); ++con) {
-        for (uint gp = 0; gp < columns(boundary.q_at_gp); ++gp) {
-            this->qn[gp] += stepper.GetRamp() * this->forcing_fact[con] * this->amplitude_gp[con][gp] *
-                            cos(this->frequency[con] * stepper.GetTimeAtCurrentStage() +
-                                (this->equilib_arg[con] - this->phase_gp[con][gp]) * PI / 180);
-        }
-    }
+    this->qn = stepper.GetRamp() * this->forcing.ComputeForcing(stepper.GetTimeAtCurrentStage());
 
     auto n_x = row(edge_bound.boundary.surface_normal, GlobalCoord::x);
     auto n_y = row(edge_bound.boundary.surface_normal, GlobalCoord::y);
@@ -151,15 +109,7 @@ void Flow::ComputeGlobalKernels(const StepperType& stepper, EdgeBoundaryType& ed
     get_dAminus_dqx(q_hat_at_gp, aux_hat_at_gp, surface_normal, this->dAminus_dqx);
     get_dAminus_dqy(q_hat_at_gp, aux_hat_at_gp, surface_normal, this->dAminus_dqy);
 
-    set_constant(this->qn, 0.0);
-
-    for (uint con = 0; con < this->frequency.size(); ++con) {
-        for (uint gp = 0; gp < columns(boundary.q_at_gp); ++gp) {
-            this->qn[gp] += stepper.GetRampNext() * this->forcing_fact[con] * this->amplitude_gp[con][gp] *
-                            cos(this->frequency[con] * stepper.GetTimeAtNextStage() + this->equilib_arg[con] -
-                                this->phase_gp[con][gp]);
-        }
-    }
+    this->qn = stepper.GetRampNext() * this->forcing.ComputeForcing(stepper.GetTimeAtNextStage());
 
     auto n_x = row(surface_normal, GlobalCoord::x);
     auto n_y = row(surface_normal, GlobalCoord::y);
@@ -3,6 +3,7 @@
 
 #include "problem/SWE/problem_jacobian/swe_jacobian.hpp"
 #include "problem/SWE/discretization_EHDG/boundary_conditions/compute_bc_trace.hpp"
+#include "problem/SWE/problem_function_files/swe_boundary_condition_functions.hpp"
 
 namespace SWE {
 namespace IHDG {
@@ -10,6 +11,8 @@ namespace BC {
 class Function {
   private:
     HybMatrix<double, SWE::n_variables> q_ex;
+    // bc_q tabulated at the gauss points, see SWE::BoundaryFunction
+    HybMatrix<double, SWE::n_variables> q_ex_table;
 
     AlignedVector<StatMatrix<double, SWE::n_variables, SWE::n_variables>> Aplus;
     AlignedVector<StatMatrix<double, SWE::n_variables, SWE::n_variables>> dAplus_dze;
@@ -41,6 +44,9 @@ void Function::Initialize(BoundaryType& bound) {
 
     this->q_ex.resize(SWE::n_variables, ngp);
 
+    Utilities::tabulate_function<SWE::BoundaryFunction>(
+        bound.GetGPGlobalCoordinates(), SWE::n_variables, this->q_ex_table);
+
     this->Aplus.resize(ngp);
     this->dAplus_dze.resize(ngp);
     this->dAplus_dqx.resize(ngp);
@@ -67,24 +73,8 @@ void Function::ComputeInitTrace(const StepperType& stepper, EdgeBoundaryType& ed
 
     double t = stepper.GetTimeAtCurrentStage();
 
-    this->q_ex = edge_bound.boundary.ComputeFgp([t](Point<2>& pt) {
-        double ze = 0.0;
-        double qx = 0.0;
-        double qy = 0.0;
-
-        Utilities::ignore(ze, qx, qy);
-
-        if (t <= 3.0) {
-            ze = cos(PI * t) - 1.0;
-        } else {
-            ze = -2.0;
-        }
-
-        // StatVector<double, SWE::n_variables> q{ze, qx, qy};
-        StatVector<double, SWE::n_variables> q(SWE::ic_q(t, pt));
-
-        return q;
-    });
+    Utilities::evaluate_function<SWE::BoundaryFunction>(
+        t, edge_bound.boundary.GetGPGlobalCoordinates(), this->q_ex_table, this->q_ex);
 
     SWE::compute_bc_trace(edge_bound);
 }
@@ -111,24 +101,8 @@ void Function::ComputeGlobalKernels(const StepperType& stepper, EdgeBoundaryType
 
     double t = stepper.GetTimeAtNextStage();
 
-    this->q_ex = edge_bound.boundary.ComputeFgp([t](Point<2>& pt) {
-        double ze = 0.0;
-        double qx = 0.0;
-        double qy = 0.0;
-
-        Utilities::ignore(ze, qx, qy);
-
-        if (t <= 3.0) {
-            ze = cos(PI * t) - 1.0;
-        } else {
-            ze = -2.0;
-        }
-
-        // StatVector<double, SWE::n_variables> q{ze, qx, qy};
-        StatVector<double, SWE::n_variables> q(SWE::ic_q(t, pt));
-
-        return q;
-    });
+    Utilities::evaluate_function<SWE::BoundaryFunction>(
+        t, edge_bound.boundary.GetGPGlobalCoordinates(), this->q_ex_table, this->q_ex);
 
     for (uint gp = 0; gp < edge_bound.edge_data.get_ngp(); ++gp) {
         auto q     = column(boundary.q_at_gp, gp);
@@ -11,15 +11,7 @@ class Tide {
   private:
     HybMatrix<double, SWE::n_variables> q_ex;
 
-    std::vector<double> frequency;
-    std::vector<double> forcing_fact;
-    std::vector<double> equilib_arg;
-
-    std::vector<DynRowVector<double>> amplitude;
-    std::vector<DynRowVector<double>> phase;
-
-    std::vector<DynRowVector<double>> amplitude_gp;
-    std::vector<DynRowVector<double>> phase_gp;
+    HarmonicForcing forcing;
 
     AlignedVector<StatMatrix<double, SWE::n_variables, SWE::n_variables>> Aplus;
     AlignedVector<StatMatrix<double, SWE::n_variables, SWE::n_variables>> dAplus_dze;
@@ -36,7 +28,7 @@ class Tide {
 
   public:
     Tide() = default;
-    Tide(const std::vector<TideNode>& tide_input);
+    Tide(const std::vector<TideNode>& tide_input, const std::shared_ptr<HarmonicPhasors>& phasors);
 
     template <typename BoundaryType>
     void Initialize(BoundaryType& bound);
@@ -48,42 +40,16 @@ class Tide {
     void ComputeGlobalKernels(const StepperType& stepper, EdgeBoundaryType& edge_bound);
 };
 
-Tide::Tide(const std::vector<TideNode>& tide_input) {
-    this->frequency    = tide_input[0].frequency;
-    this->forcing_fact = tide_input[0].forcing_fact;
-    this->equilib_arg  = tide_input[0].equilib_arg;
-
-    uint n_contituents = this->frequency.size();
-    uint n_nodes       = tide_input.size();
-
-    this->amplitude.resize(n_contituents);
-    this->phase.resize(n_contituents);
-
-    for (uint con = 0; con < n_contituents; ++con) {
-        this->amplitude[con].resize(n_nodes);
-        this->phase[con].resize(n_nodes);
-
-        for (uint node = 0; node < n_nodes; ++node) {
-            this->amplitude[con][node] = tide_input[node].amplitude[con];
-            this->phase[con][node]     = tide_input[node].phase[con];
-        }
-    }
-}
+Tide::Tide(const std::vector<TideNode>& tide_input, const std::shared_ptr<HarmonicPhasors>& phasors)
+    : forcing(tide_input, phasors) {}
 
 template <typename BoundaryType>
 void Tide::Initialize(BoundaryType& bound) {
-    uint ngp           = bound.data.get_ngp_boundary(bound.bound_id);
-    uint n_contituents = this->frequency.size();
+    uint ngp = bound.data.get_ngp_boundary(bound.bound_id);
 
     this->q_ex.resize(SWE::n_variables, ngp);
 
-    this->amplitude_gp.resize(n_contituents);
-    this->phase_gp.resize(n_contituents);
-
-    for (uint con = 0; con < n_contituents; ++con) {
-        this->amplitude_gp[con] = bound.ComputeBoundaryNodalUgp(this->amplitude[con]);
-        this->phase_gp[con]     = bound.ComputeBoundaryNodalUgp(this->phase[con]);
-    }
+    this->forcing.Initialize(bound);
 
     this->Aplus.resize(ngp);
     this->dAplus_dze.resize(ngp);
@@ -109,16 +75,8 @@ void Tide::ComputeInitTrace(const StepperType& stepper, EdgeBoundaryType& edge_b
 
     set_constant(edge_state.q_hat, 0.0);
 
-    set_constant(this->q_ex, 0.0);
-
-    for (uint con = 0; con < this->frequency.size(); ++con) {
-        for (uint gp = 0; gp < columns(boundary.q_at_gp); ++gp) {
-            this->q_ex(SWE::Variables::ze, gp) += stepper.GetRamp() * this->forcing_fact[con] *
-                                                  this->amplitude_gp[con][gp] *
-                                                  cos(this->frequency[con] * stepper.GetTimeAtCurrentStage() +
-                                                      (this->equilib_arg[con] - this->phase_gp[con][gp]) * PI / 180);
-        }
-    }
+    row(this->q_ex, SWE::Variables::ze) =
+        stepper.GetRamp() * this->forcing.ComputeForcing(stepper.GetTimeAtCurrentStage());
 
     row(this->q_ex, SWE::Variables::qx) = row(boundary.q_at_gp, SWE::Variables::qx);
     row(this->q_ex, SWE::Variables::qy) = row(boundary.q_at_gp, SWE::Variables::qy);
@@ -146,16 +104,8 @@ void Tide::ComputeGlobalKernels(const StepperType& stepper, EdgeBoundaryType& ed
     get_dAminus_dqx(q_hat_at_gp, aux_hat_at_gp, surface_normal, this->dAminus_dqx);
     get_dAminus_dqy(q_hat_at_gp, aux_hat_at_gp, surface_normal, this->dAminus_dqy);
 
-    set_constant(this->q_ex, 0.0);
-
-    for (uint con = 0; con < this->frequency.size(); ++con) {
-        for (uint gp = 0; gp < columns(boundary.q_at_gp); ++gp) {
-            this->q_ex(SWE::Variables::ze, gp) += stepper.GetRampNext() * this->forcing_fact[con] *
-                                                  this->amplitude_gp[con][gp] *
-                                                  cos(this->frequency[con] * stepper.GetTimeAtNextStage() +
-                                                      this->equilib_arg[con] - this->phase_gp[con][gp]);
-        }
-    }
+    row(this->q_ex, SWE::Variables::ze) =
+        stepper.GetRampNext() * this->forcing.ComputeForcing(stepper.GetTimeAtNextStage());
 
     row(this->q_ex, SWE::Variables::qx) = row(boundary.q_at_gp, SWE::Variables::qx);
     row(this->q_ex, SWE::Variables::qy) = row(boundary.q_at_gp, SWE::Variables::qy);
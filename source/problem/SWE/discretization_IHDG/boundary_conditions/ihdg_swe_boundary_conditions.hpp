@@ -1,6 +1,8 @@
 #ifndef IHDG_SWE_BOUNDARY_CONDITIONS_HPP
 #define IHDG_SWE_BOUNDARY_CONDITIONS_HPP
 
+#include "problem/SWE/problem_boundary_conditions/swe_harmonic_forcing.hpp"
+
 #include "ihdg_swe_bc_land.hpp"
 #include "ihdg_swe_bc_flow.hpp"
 #include "ihdg_swe_bc_tide.hpp"
@@ -37,6 +37,10 @@ void Problem::stage_ompi(std::vector<std::unique_ptr<OMPISimUnitType<ProblemType
                          const uint begin_sim_id,
                          const uint end_sim_id) {
     for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
+        if (SWE::PostProcessing::slope_limiting) {
+            sim_units[su_id]->communicator.ReceiveAll(CommTypes::baryctr_state, stepper.GetTimestamp());
+        }
+
         Problem::init_iteration(stepper, sim_units[su_id]->discretization);
     }
 
@@ -117,6 +121,12 @@ void Problem::stage_ompi(std::vector<std::unique_ptr<OMPISimUnitType<ProblemType
                 MPI_Abort(MPI_COMM_WORLD, 0);
         });
     }
+
+    if (SWE::PostProcessing::slope_limiting) {
+        for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
+            sim_units[su_id]->communicator.WaitAllSends(CommTypes::baryctr_state, stepper.GetTimestamp());
+        }
+    }
 }
 }
 }
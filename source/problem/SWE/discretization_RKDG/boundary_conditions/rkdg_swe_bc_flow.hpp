@@ -9,19 +9,11 @@ class Flow {
     HybMatrix<double, SWE::n_variables> q_ex;
     DynRowVector<double> qn;
 
-    std::vector<double> frequency;
-    std::vector<double> forcing_fact;
-    std::vector<double> equilib_arg;
-
-    std::vector<DynRowVector<double>> amplitude;
-    std::vector<DynRowVector<double>> phase;
-
-    std::vector<DynRowVector<double>> amplitude_gp;
-    std::vector<DynRowVector<double>> phase_gp;
+    HarmonicForcing forcing;
 
   public:
     Flow() = default;
-    Flow(const std::vector<FlowNode>& flow_input);
+    Flow(const std::vector<FlowNode>& flow_input, const std::shared_ptr<HarmonicPhasors>& phasors);
 
     template <typename BoundaryType>
     void Initialize(BoundaryType& bound);
@@ -30,58 +22,24 @@ class Flow {
     void ComputeFlux(const StepperType& stepper, BoundaryType& bound);
 };
 
-Flow::Flow(const std::vector<FlowNode>& flow_input) {
-    this->frequency    = flow_input[0].frequency;
-    this->forcing_fact = flow_input[0].forcing_fact;
-    this->equilib_arg  = flow_input[0].equilib_arg;
-
-    uint n_contituents = this->frequency.size();
-    uint n_nodes       = flow_input.size();
-
-    this->amplitude.resize(n_contituents);
-    this->phase.resize(n_contituents);
-
-    for (uint con = 0; con < n_contituents; ++con) {
-        this->amplitude[con].resize(n_nodes);
-        this->phase[con].resize(n_nodes);
-
-        for (uint node = 0; node < n_nodes; ++node) {
-            this->amplitude[con][node] = flow_input[node].amplitude[con];
-            this->phase[con][node]     = flow_input[node].phase[con];
-        }
-    }
-}
+Flow::Flow(const std::vector<FlowNode>& flow_input, const std::shared_ptr<HarmonicPhasors>& phasors)
+    : forcing(flow_input, phasors) {}
 
 template <typename BoundaryType>
 void Flow::Initialize(BoundaryType& bound) {
-    uint ngp           = bound.data.get_ngp_boundary(bound.bound_id);
-    uint n_contituents = this->frequency.size();
+    uint ngp = bound.data.get_ngp_boundary(bound.bound_id);
 
     this->q_ex.resize(SWE::n_variables, ngp);
     this->qn.resize(ngp);
 
-    this->amplitude_gp.resize(n_contituents);
-    this->phase_gp.resize(n_contituents);
-
-    for (uint con = 0; con < n_contituents; ++con) {
-        this->amplitude_gp[con] = bound.ComputeBoundaryNodalUgp(this->amplitude[con]);
-        this->phase_gp[con]     = bound.ComputeBoundaryNodalUgp(this->phase[con]);
-    }
+    this->forcing.Initialize(bound);
 }
 
 template <typename StepperType, typename BoundaryType>
 void Flow::ComputeFlux(const StepperType& stepper, BoundaryType& bound) {
     auto& boundary = bound.data.boundary[bound.bound_id];
 
-    set_constant(this->qn, 0.0);
-
-    for (uint con = 0; con < this->frequency.size(); ++con) {
-        for (uint gp = 0; gp < columns(boundary.q_at_gp); ++gp) {
-            this->qn[gp] += stepper.GetRamp() * this->forcing_fact[con] * this->amplitude_gp[con][gp] *
-                            cos(this->frequency[con] * stepper.GetTimeAtCurrentStage() +
-                                (this->equilib_arg[con] - this->phase_gp[con][gp]) * PI / 180);
-        }
-    }
+    this->qn = stepper.GetRamp() * this->forcing.ComputeForcing(stepper.GetTimeAtCurrentStage());
 
     auto n_x = row(bound.surface_normal, GlobalCoord::x);
     auto n_y = row(bound.surface_normal, GlobalCoord::y);
@@ -1,7 +1,7 @@
 #ifndef RKDG_SWE_BC_FUNCTION_HPP
 #define RKDG_SWE_BC_FUNCTION_HPP
 
-#include "problem/SWE/problem_function_files/swe_initial_condition_functions.hpp"
+#include "problem/SWE/problem_function_files/swe_boundary_condition_functions.hpp"
 
 namespace SWE {
 namespace RKDG {
@@ -9,6 +9,8 @@ namespace BC {
 class Function {
   private:
     HybMatrix<double, SWE::n_variables> q_ex;
+    // bc_q tabulated at the gauss points, see SWE::BoundaryFunction
+    HybMatrix<double, SWE::n_variables> q_ex_table;
 
   public:
     template <typename BoundaryType>
@@ -22,6 +24,9 @@ template <typename BoundaryType>
 void Function::Initialize(BoundaryType& bound) {
     uint ngp = bound.data.get_ngp_boundary(bound.bound_id);
     this->q_ex.resize(SWE::n_variables, ngp);
+
+    Utilities::tabulate_function<SWE::BoundaryFunction>(
+        bound.GetGPGlobalCoordinates(), SWE::n_variables, this->q_ex_table);
 }
 
 template <typename StepperType, typename BoundaryType>
@@ -30,24 +35,8 @@ void Function::ComputeFlux(const StepperType& stepper, BoundaryType& bound) {
 
     double t = stepper.GetTimeAtCurrentStage();
 
-    this->q_ex = bound.ComputeFgp([t](Point<2>& pt) {
-        double ze = 0.0;
-        double qx = 0.0;
-        double qy = 0.0;
-
-        Utilities::ignore(ze, qx, qy);
-
-        if (t <= 3.0) {
-            ze = cos(PI * t) - 1.0;
-        } else {
-            ze = -2.0;
-        }
-
-        // StatVector<double, SWE::n_variables> q{ze, qx, qy};
-        StatVector<double, SWE::n_variables> q(SWE::ic_q(t, pt));
-
-        return q;
-    });
+    Utilities::evaluate_function<SWE::BoundaryFunction>(
+        t, bound.GetGPGlobalCoordinates(), this->q_ex_table, this->q_ex);
 
     for (uint gp = 0; gp < columns(boundary.q_at_gp); ++gp) {
         LLF_flux(Global::g,
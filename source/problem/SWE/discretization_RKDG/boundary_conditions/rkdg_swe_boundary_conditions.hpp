@@ -1,6 +1,8 @@
 #ifndef RKDG_SWE_BOUNDARY_CONDITIONS_HPP
 #define RKDG_SWE_BOUNDARY_CONDITIONS_HPP
 
+#include "problem/SWE/problem_boundary_conditions/swe_harmonic_forcing.hpp"
+
 #include "rkdg_swe_bc_land.hpp"
 #include "rkdg_swe_bc_flow.hpp"
 #include "rkdg_swe_bc_tide.hpp"
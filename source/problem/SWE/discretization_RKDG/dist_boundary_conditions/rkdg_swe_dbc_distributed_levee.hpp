@@ -63,11 +63,7 @@ void DistributedLevee::Initialize(DistributedBoundaryType& dbound) {
 
 template <typename DistributedBoundaryType>
 void DistributedLevee::ComputeFlux(DistributedBoundaryType& dbound) {
-    std::vector<double> message;
-
-    message.resize(1 + SWE::n_variables * dbound.data.get_ngp_boundary(dbound.bound_id));
-
-    dbound.boundary_condition.exchanger.GetFromReceiveBuffer(CommTypes::bound_state, message);
+    const double* message = dbound.boundary_condition.exchanger.GetReceiveBufferPointer(CommTypes::bound_state);
 
     uint gp_ex;
     for (uint gp = 0; gp < dbound.data.get_ngp_boundary(dbound.bound_id); ++gp) {
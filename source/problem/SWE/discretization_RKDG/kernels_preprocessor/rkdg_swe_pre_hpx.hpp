@@ -15,6 +15,8 @@ auto Problem::preprocessor_hpx(HPXSimUnitType* sim_unit) {
 
     sim_unit->communicator.SendAll(CommTypes::baryctr_coord, sim_unit->stepper.GetTimestamp());
 
+    receive_future = sim_unit->communicator.WaitAllReceives(CommTypes::baryctr_coord, std::move(receive_future));
+
     return receive_future.then([sim_unit](auto&&) {
         SWE::initialize_data_parallel_post_receive(sim_unit->discretization.mesh, CommTypes::baryctr_coord);
 
@@ -6,5 +6,6 @@
 #include "rkdg_swe_proc_intface.hpp"
 #include "rkdg_swe_proc_bound.hpp"
 #include "rkdg_swe_proc_dbound.hpp"
+#include "rkdg_swe_proc_ghost.hpp"
 
 #endif
\ No newline at end of file
@@ -0,0 +1,34 @@
+#ifndef RKDG_SWE_PROC_GHOST_HPP
+#define RKDG_SWE_PROC_GHOST_HPP
+
+namespace SWE {
+namespace RKDG {
+template <typename ElementType>
+void Problem::ghost_send_kernel(const ProblemStepperType& stepper, ElementType& elt, double* message) {
+    const auto& state = elt.data.state[stepper.GetStage()];
+
+    message[0] = (double)elt.data.wet_dry_state.wet;
+
+    for (uint dof = 0; dof < elt.data.get_ndof(); ++dof) {
+        for (uint var = 0; var < SWE::n_variables; ++var) {
+            message[1 + SWE::n_variables * dof + var] = state.q(var, dof);
+        }
+    }
+}
+
+template <typename ElementType>
+void Problem::ghost_receive_kernel(const ProblemStepperType& stepper, ElementType& elt, const double* message) {
+    auto& state = elt.data.state[stepper.GetStage()];
+
+    elt.data.wet_dry_state.wet = (bool)message[0];
+
+    for (uint dof = 0; dof < elt.data.get_ndof(); ++dof) {
+        for (uint var = 0; var < SWE::n_variables; ++var) {
+            state.q(var, dof) = message[1 + SWE::n_variables * dof + var];
+        }
+    }
+}
+}
+}
+
+#endif
@@ -3,6 +3,7 @@
 
 #include "rkdg_swe_kernels_processor.hpp"
 #include "problem/SWE/problem_slope_limiter/swe_CS_sl_hpx.hpp"
+#include "utilities/kernel_timers.hpp"
 
 namespace SWE {
 namespace RKDG {
@@ -15,29 +16,43 @@ auto Problem::stage_hpx(HPXSimUnitType* sim_unit) {
         sim_unit->writer.GetLogFile() << "Exchanging data" << std::endl;
     }
 
+    START_KERNEL_PHASE(sim_unit->discretization.timers, comm_start);
     hpx::future<void> receive_future =
         sim_unit->communicator.ReceiveAll(CommTypes::bound_state, sim_unit->stepper.GetTimestamp());
+    STOP_KERNEL_PHASE(sim_unit->discretization.timers, comm_start);
 
+    START_KERNEL_PHASE(sim_unit->discretization.timers, distributed_boundary);
     sim_unit->discretization.mesh.CallForEachDistributedBoundary(
         [sim_unit](auto& dbound) { Problem::distributed_boundary_send_kernel(sim_unit->stepper, dbound); });
+    STOP_KERNEL_PHASE(sim_unit->discretization.timers, distributed_boundary);
 
+    START_KERNEL_PHASE(sim_unit->discretization.timers, comm_start);
     sim_unit->communicator.SendAll(CommTypes::bound_state, sim_unit->stepper.GetTimestamp());
+    STOP_KERNEL_PHASE(sim_unit->discretization.timers, comm_start);
 
     if (sim_unit->writer.WritingVerboseLog()) {
         sim_unit->writer.GetLogFile() << "Starting work before receive" << std::endl;
     }
 
+    START_KERNEL_PHASE(sim_unit->discretization.timers, volume);
     sim_unit->discretization.mesh.CallForEachElement(
         [sim_unit](auto& elt) { Problem::volume_kernel(sim_unit->stepper, elt); });
+    STOP_KERNEL_PHASE(sim_unit->discretization.timers, volume);
 
+    START_KERNEL_PHASE(sim_unit->discretization.timers, source);
     sim_unit->discretization.mesh.CallForEachElement(
         [sim_unit](auto& elt) { Problem::source_kernel(sim_unit->stepper, elt); });
+    STOP_KERNEL_PHASE(sim_unit->discretization.timers, source);
 
+    START_KERNEL_PHASE(sim_unit->discretization.timers, interface);
     sim_unit->discretization.mesh.CallForEachInterface(
         [sim_unit](auto& intface) { Problem::interface_kernel(sim_unit->stepper, intface); });
+    STOP_KERNEL_PHASE(sim_unit->discretization.timers, interface);
 
+    START_KERNEL_PHASE(sim_unit->discretization.timers, boundary);
     sim_unit->discretization.mesh.CallForEachBoundary(
         [sim_unit](auto& bound) { Problem::boundary_kernel(sim_unit->stepper, bound); });
+    STOP_KERNEL_PHASE(sim_unit->discretization.timers, boundary);
 
     if (sim_unit->writer.WritingVerboseLog()) {
         sim_unit->writer.GetLogFile() << "Finished work before receive" << std::endl
@@ -45,16 +60,26 @@ auto Problem::stage_hpx(HPXSimUnitType* sim_unit) {
                                       << sim_unit->stepper.GetTimestamp() << std::endl;
     }
 
+    // the wait lasts until the continuation runs
+    START_KERNEL_PHASE(sim_unit->discretization.timers, halo_wait);
+
+    receive_future = sim_unit->communicator.WaitAllReceives(CommTypes::bound_state, std::move(receive_future));
+
     hpx::future<void> stage_future = receive_future.then([sim_unit](auto&& f) {
         f.get();  // check for exceptions
 
+        STOP_KERNEL_PHASE(sim_unit->discretization.timers, halo_wait);
+
         if (sim_unit->writer.WritingVerboseLog()) {
             sim_unit->writer.GetLogFile() << "Starting work after receive" << std::endl;
         }
 
+        START_KERNEL_PHASE(sim_unit->discretization.timers, distributed_boundary);
         sim_unit->discretization.mesh.CallForEachDistributedBoundary(
             [sim_unit](auto& dbound) { Problem::distributed_boundary_kernel(sim_unit->stepper, dbound); });
+        STOP_KERNEL_PHASE(sim_unit->discretization.timers, distributed_boundary);
 
+        START_KERNEL_PHASE(sim_unit->discretization.timers, update);
         sim_unit->discretization.mesh.CallForEachElement([sim_unit](auto& elt) {
             auto& state = elt.data.state[sim_unit->stepper.GetStage()];
 
@@ -62,6 +87,7 @@ auto Problem::stage_hpx(HPXSimUnitType* sim_unit) {
 
             sim_unit->stepper.UpdateState(elt);
         });
+        STOP_KERNEL_PHASE(sim_unit->discretization.timers, update);
 
         ++(sim_unit->stepper);
 
@@ -74,8 +100,10 @@ auto Problem::stage_hpx(HPXSimUnitType* sim_unit) {
         stage_future = stage_future.then([sim_unit](auto&& f) {
             f.get();  // check for exceptions
 
+            START_KERNEL_PHASE(sim_unit->discretization.timers, wetting_drying);
             sim_unit->discretization.mesh.CallForEachElement(
                 [sim_unit](auto& elt) { wetting_drying_kernel(sim_unit->stepper, elt); });
+            STOP_KERNEL_PHASE(sim_unit->discretization.timers, wetting_drying);
         });
     }
 
@@ -90,12 +118,14 @@ auto Problem::stage_hpx(HPXSimUnitType* sim_unit) {
     return stage_future.then([sim_unit](auto&& f) {
         f.get();  // check for exceptions
 
+        START_KERNEL_PHASE(sim_unit->discretization.timers, scrutinize);
         sim_unit->discretization.mesh.CallForEachElement([sim_unit](auto& elt) {
             bool nan_found = SWE::scrutinize_solution(sim_unit->stepper, elt);
 
             if (nan_found)
                 hpx::terminate();
         });
+        STOP_KERNEL_PHASE(sim_unit->discretization.timers, scrutinize);
     });
 }
 }
@@ -3,6 +3,7 @@
 
 #include "rkdg_swe_kernels_processor.hpp"
 #include "problem/SWE/problem_slope_limiter/swe_CS_sl_ompi.hpp"
+#include "utilities/kernel_timers.hpp"
 
 namespace SWE {
 namespace RKDG {
@@ -12,19 +13,93 @@ void Problem::step_ompi(std::vector<std::unique_ptr<OMPISimUnitType<ProblemType>
                         ProblemStepperType& stepper,
                         const uint begin_sim_id,
                         const uint end_sim_id) {
+    // With ghost layers the submeshes overlap by one layer per stage. The states of the ghosts are received once at
+    // the beginning of the step, after which every stage is computed without communication.
+    for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
+        if (sim_units[su_id]->communicator.UsesGhostLayers()) {
+            auto& communicator = sim_units[su_id]->communicator;
+            auto& mesh         = sim_units[su_id]->discretization.mesh;
+
+            START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, comm_start);
+            communicator.ReceiveAll(CommTypes::ghost_state, stepper.GetTimestamp());
+            STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, comm_start);
+
+            START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, distributed_boundary);
+            for (uint rank_boundary_id = 0; rank_boundary_id < communicator.GetRankBoundaryNumber();
+                 ++rank_boundary_id) {
+                auto& rank_boundary = communicator.GetRankBoundary(rank_boundary_id);
+
+                double* message = rank_boundary.send_buffer[CommTypes::ghost_state].data();
+
+                for (uint elt_id : rank_boundary.gl_data.elements_send) {
+                    mesh.CallForElement(elt_id, [&stepper, &message](auto& elt) {
+                        Problem::ghost_send_kernel(stepper, elt, message);
+
+                        message += SWE::n_variables * elt.data.get_ndof() + 1;
+                    });
+                }
+            }
+            STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, distributed_boundary);
+
+            START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, comm_start);
+            communicator.SendAll(CommTypes::ghost_state, stepper.GetTimestamp());
+            STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, comm_start);
+        }
+    }
+
+    for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
+        if (sim_units[su_id]->communicator.UsesGhostLayers()) {
+            auto& communicator = sim_units[su_id]->communicator;
+            auto& mesh         = sim_units[su_id]->discretization.mesh;
+
+            START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, halo_wait);
+            communicator.WaitAllReceives(CommTypes::ghost_state, stepper.GetTimestamp());
+            STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, halo_wait);
+
+            START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, distributed_boundary);
+            for (uint rank_boundary_id = 0; rank_boundary_id < communicator.GetRankBoundaryNumber();
+                 ++rank_boundary_id) {
+                auto& rank_boundary = communicator.GetRankBoundary(rank_boundary_id);
+
+                const double* message = rank_boundary.receive_buffer[CommTypes::ghost_state].data();
+
+                for (uint elt_id : rank_boundary.gl_data.elements_receive) {
+                    mesh.CallForElement(elt_id, [&stepper, &message](auto& elt) {
+                        Problem::ghost_receive_kernel(stepper, elt, message);
+
+                        message += SWE::n_variables * elt.data.get_ndof() + 1;
+                    });
+                }
+            }
+            STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, distributed_boundary);
+        }
+    }
+
     for (uint stage = 0; stage < stepper.GetNumStages(); ++stage) {
         for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
             if (sim_units[su_id]->parser.ParsingInput()) {
+                START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, parse);
                 sim_units[su_id]->parser.ParseInput(stepper, sim_units[su_id]->discretization.mesh);
+                STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, parse);
             }
         }
 
         Problem::stage_ompi(sim_units, global_data, stepper, begin_sim_id, end_sim_id);
     }
 
+    for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
+        if (sim_units[su_id]->communicator.UsesGhostLayers()) {
+            START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, comm_complete);
+            sim_units[su_id]->communicator.WaitAllSends(CommTypes::ghost_state, stepper.GetTimestamp());
+            STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, comm_complete);
+        }
+    }
+
     for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
         if (sim_units[su_id]->writer.WritingOutput()) {
+            START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, output);
             sim_units[su_id]->writer.WriteOutput(stepper, sim_units[su_id]->discretization.mesh);
+            STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, output);
         }
     }
 }
@@ -43,12 +118,28 @@ void Problem::stage_ompi(std::vector<std::unique_ptr<OMPISimUnitType<ProblemType
             sim_units[su_id]->writer.GetLogFile() << "Exchanging data" << std::endl;
         }
 
-        sim_units[su_id]->communicator.ReceiveAll(CommTypes::bound_state, stepper.GetTimestamp());
+        START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, comm_start);
+
+        if (!sim_units[su_id]->communicator.UsesGhostLayers()) {
+            sim_units[su_id]->communicator.ReceiveAll(CommTypes::bound_state, stepper.GetTimestamp());
+        }
+
+        if (SWE::PostProcessing::slope_limiting) {
+            sim_units[su_id]->communicator.ReceiveAll(CommTypes::baryctr_state, stepper.GetTimestamp());
+        }
 
+        STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, comm_start);
+
+        START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, distributed_boundary);
         sim_units[su_id]->discretization.mesh.CallForEachDistributedBoundary(
             [&stepper](auto& dbound) { Problem::distributed_boundary_send_kernel(stepper, dbound); });
+        STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, distributed_boundary);
 
-        sim_units[su_id]->communicator.SendAll(CommTypes::bound_state, stepper.GetTimestamp());
+        if (!sim_units[su_id]->communicator.UsesGhostLayers()) {
+            START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, comm_start);
+            sim_units[su_id]->communicator.SendAll(CommTypes::bound_state, stepper.GetTimestamp());
+            STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, comm_start);
+        }
     }
 
     for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
@@ -56,17 +147,25 @@ void Problem::stage_ompi(std::vector<std::unique_ptr<OMPISimUnitType<ProblemType
             sim_units[su_id]->writer.GetLogFile() << "Starting work before receive" << std::endl;
         }
 
+        START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, volume);
         sim_units[su_id]->discretization.mesh.CallForEachElement(
             [&stepper](auto& elt) { Problem::volume_kernel(stepper, elt); });
+        STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, volume);
 
+        START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, source);
         sim_units[su_id]->discretization.mesh.CallForEachElement(
             [&stepper](auto& elt) { Problem::source_kernel(stepper, elt); });
+        STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, source);
 
+        START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, interface);
         sim_units[su_id]->discretization.mesh.CallForEachInterface(
             [&stepper](auto& intface) { Problem::interface_kernel(stepper, intface); });
+        STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, interface);
 
+        START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, boundary);
         sim_units[su_id]->discretization.mesh.CallForEachBoundary(
             [&stepper](auto& bound) { Problem::boundary_kernel(stepper, bound); });
+        STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, boundary);
 
         if (sim_units[su_id]->writer.WritingVerboseLog()) {
             sim_units[su_id]->writer.GetLogFile() << "Finished work before receive" << std::endl;
@@ -79,15 +178,22 @@ void Problem::stage_ompi(std::vector<std::unique_ptr<OMPISimUnitType<ProblemType
                 << "Starting to wait on receive with timestamp: " << stepper.GetTimestamp() << std::endl;
         }
 
-        sim_units[su_id]->communicator.WaitAllReceives(CommTypes::bound_state, stepper.GetTimestamp());
+        if (!sim_units[su_id]->communicator.UsesGhostLayers()) {
+            START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, halo_wait);
+            sim_units[su_id]->communicator.WaitAllReceives(CommTypes::bound_state, stepper.GetTimestamp());
+            STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, halo_wait);
+        }
 
         if (sim_units[su_id]->writer.WritingVerboseLog()) {
             sim_units[su_id]->writer.GetLogFile() << "Starting work after receive" << std::endl;
         }
 
+        START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, distributed_boundary);
         sim_units[su_id]->discretization.mesh.CallForEachDistributedBoundary(
             [&stepper](auto& dbound) { Problem::distributed_boundary_kernel(stepper, dbound); });
+        STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, distributed_boundary);
 
+        START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, update);
         sim_units[su_id]->discretization.mesh.CallForEachElement([&stepper](auto& elt) {
             auto& state = elt.data.state[stepper.GetStage()];
 
@@ -95,6 +201,7 @@ void Problem::stage_ompi(std::vector<std::unique_ptr<OMPISimUnitType<ProblemType
 
             stepper.UpdateState(elt);
         });
+        STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, update);
 
         if (sim_units[su_id]->writer.WritingVerboseLog()) {
             sim_units[su_id]->writer.GetLogFile() << "Finished work after receive" << std::endl << std::endl;
@@ -108,8 +215,10 @@ void Problem::stage_ompi(std::vector<std::unique_ptr<OMPISimUnitType<ProblemType
 
     if (SWE::PostProcessing::wetting_drying) {
         for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
+            START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, wetting_drying);
             sim_units[su_id]->discretization.mesh.CallForEachElement(
                 [&stepper](auto& elt) { wetting_drying_kernel(stepper, elt); });
+            STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, wetting_drying);
         }
     }
 
@@ -118,16 +227,28 @@ void Problem::stage_ompi(std::vector<std::unique_ptr<OMPISimUnitType<ProblemType
     }
 
     for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
-        sim_units[su_id]->discretization.mesh.CallForEachElement([&stepper](auto& elt) {
+        START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, scrutinize);
+        sim_units[su_id]->discretization.mesh.CallForEachOwnedElement([&stepper](auto& elt) {
             bool nan_found = SWE::scrutinize_solution(stepper, elt);
 
             if (nan_found)
                 MPI_Abort(MPI_COMM_WORLD, 0);
         });
+        STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, scrutinize);
     }
 
     for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
-        sim_units[su_id]->communicator.WaitAllSends(CommTypes::bound_state, stepper.GetTimestamp());
+        START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, comm_complete);
+
+        if (!sim_units[su_id]->communicator.UsesGhostLayers()) {
+            sim_units[su_id]->communicator.WaitAllSends(CommTypes::bound_state, stepper.GetTimestamp());
+        }
+
+        if (SWE::PostProcessing::slope_limiting) {
+            sim_units[su_id]->communicator.WaitAllSends(CommTypes::baryctr_state, stepper.GetTimestamp());
+        }
+
+        STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, comm_complete);
     }
 }
 }
@@ -3,6 +3,7 @@
 
 #include "rkdg_swe_kernels_processor.hpp"
 #include "problem/SWE/problem_slope_limiter/swe_CS_sl_serial.hpp"
+#include "utilities/kernel_timers.hpp"
 
 namespace SWE {
 namespace RKDG {
@@ -14,14 +15,18 @@ void Problem::step_serial(DiscretizationType<ProblemType>& discretization,
                           typename ProblemType::ProblemParserType& parser) {
     for (uint stage = 0; stage < stepper.GetNumStages(); ++stage) {
         if (parser.ParsingInput()) {
+            START_KERNEL_PHASE(discretization.timers, parse);
             parser.ParseInput(stepper, discretization.mesh);
+            STOP_KERNEL_PHASE(discretization.timers, parse);
         }
 
         Problem::stage_serial(discretization, global_data, stepper);
     }
 
     if (writer.WritingOutput()) {
+        START_KERNEL_PHASE(discretization.timers, output);
         writer.WriteOutput(stepper, discretization.mesh);
+        STOP_KERNEL_PHASE(discretization.timers, output);
     }
 }
 
@@ -29,15 +34,24 @@ template <template <typename> class DiscretizationType, typename ProblemType>
 void Problem::stage_serial(DiscretizationType<ProblemType>& discretization,
                            typename ProblemType::ProblemGlobalDataType& global_data,
                            ProblemStepperType& stepper) {
+    START_KERNEL_PHASE(discretization.timers, volume);
     discretization.mesh.CallForEachElement([&stepper](auto& elt) { Problem::volume_kernel(stepper, elt); });
+    STOP_KERNEL_PHASE(discretization.timers, volume);
 
+    START_KERNEL_PHASE(discretization.timers, source);
     discretization.mesh.CallForEachElement([&stepper](auto& elt) { Problem::source_kernel(stepper, elt); });
+    STOP_KERNEL_PHASE(discretization.timers, source);
 
+    START_KERNEL_PHASE(discretization.timers, interface);
     discretization.mesh.CallForEachInterface(
         [&stepper](auto& intface) { Problem::interface_kernel(stepper, intface); });
+    STOP_KERNEL_PHASE(discretization.timers, interface);
 
+    START_KERNEL_PHASE(discretization.timers, boundary);
     discretization.mesh.CallForEachBoundary([&stepper](auto& bound) { Problem::boundary_kernel(stepper, bound); });
+    STOP_KERNEL_PHASE(discretization.timers, boundary);
 
+    START_KERNEL_PHASE(discretization.timers, update);
     discretization.mesh.CallForEachElement([&stepper](auto& elt) {
         auto& state = elt.data.state[stepper.GetStage()];
 
@@ -45,17 +59,23 @@ void Problem::stage_serial(DiscretizationType<ProblemType>& discretization,
 
         stepper.UpdateState(elt);
     });
+    STOP_KERNEL_PHASE(discretization.timers, update);
 
     ++stepper;
 
     if (SWE::PostProcessing::wetting_drying) {
+        START_KERNEL_PHASE(discretization.timers, wetting_drying);
         discretization.mesh.CallForEachElement([&stepper](auto& elt) { wetting_drying_kernel(stepper, elt); });
+        STOP_KERNEL_PHASE(discretization.timers, wetting_drying);
     }
 
     if (SWE::PostProcessing::slope_limiting) {
+        START_KERNEL_PHASE(discretization.timers, slope_limiter);
         CS_slope_limiter_serial(stepper, discretization);
+        STOP_KERNEL_PHASE(discretization.timers, slope_limiter);
     }
 
+    START_KERNEL_PHASE(discretization.timers, scrutinize);
     discretization.mesh.CallForEachElement([&stepper](auto& elt) {
         bool nan_found = SWE::scrutinize_solution(stepper, elt);
 
@@ -64,6 +84,7 @@ void Problem::stage_serial(DiscretizationType<ProblemType>& discretization,
             abort();
         }
     });
+    STOP_KERNEL_PHASE(discretization.timers, scrutinize);
 }
 }
 }
@@ -37,6 +37,9 @@ struct Problem {
     using ProblemWriterType  = Writer<Problem>;
     using ProblemParserType  = SWE::Parser;
 
+    using ProblemOutputSnapshotType = SWE::OutputSnapshot;
+    using ProblemExtremaType        = SWE::Extrema;
+
     using ProblemDataType       = SWE::Data;
     using ProblemEdgeDataType   = SWE::EdgeData;
     using ProblemGlobalDataType = SWE::GlobalData;
@@ -77,6 +80,20 @@ struct Problem {
         return offset;
     }
 
+    static uint comm_type_id(const std::string& comm_type_name) {
+        if (comm_type_name == "baryctr_coord") {
+            return CommTypes::baryctr_coord;
+        } else if (comm_type_name == "bound_state") {
+            return CommTypes::bound_state;
+        } else if (comm_type_name == "baryctr_state") {
+            return CommTypes::baryctr_state;
+        } else if (comm_type_name == "ghost_state") {
+            return CommTypes::ghost_state;
+        }
+
+        throw std::logic_error("Fatal Error: unknown communication type " + comm_type_name + "\n");
+    }
+
     template <typename RawBoundaryType>
     static void create_interfaces(std::map<uchar, std::map<std::pair<uint, uint>, RawBoundaryType>>& raw_boundaries,
                                   ProblemMeshType& mesh,
@@ -112,6 +129,11 @@ struct Problem {
         SWE::create_distributed_boundaries<SWE::RKDG::Problem>(raw_boundaries, mesh, input, communicator, writer);
     }
 
+    template <typename Communicator>
+    static void create_ghost_layers(ProblemMeshType& mesh, Communicator& communicator, ProblemWriterType& writer) {
+        SWE::create_ghost_layers<SWE::RKDG::Problem>(mesh, communicator, writer, CommTypes::ghost_state);
+    }
+
     template <template <typename> class DiscretizationType, typename ProblemType>
     static void preprocessor_serial(DiscretizationType<ProblemType>& discretization,
                                     typename ProblemType::ProblemGlobalDataType& global_data,
@@ -176,19 +198,63 @@ struct Problem {
     template <typename DistributedBoundaryType>
     static void distributed_boundary_kernel(const ProblemStepperType& stepper, DistributedBoundaryType& dbound);
 
+    template <typename ElementType>
+    static void ghost_send_kernel(const ProblemStepperType& stepper, ElementType& elt, double* message);
+
+    template <typename ElementType>
+    static void ghost_receive_kernel(const ProblemStepperType& stepper, ElementType& elt, const double* message);
+
     // postprocessor kernels
-    static void write_VTK_data(ProblemMeshType& mesh, std::ofstream& raw_data_file) {
-        SWE::write_VTK_data(mesh, raw_data_file);
+    static void take_output_snapshot(const ProblemStepperType& stepper,
+                                     ProblemMeshType& mesh,
+                                     ProblemOutputSnapshotType& snapshot) {
+        SWE::take_output_snapshot(stepper, mesh, snapshot);
+    }
+
+    static void write_VTK_data(const ProblemOutputSnapshotType& snapshot, std::ofstream& raw_data_file) {
+        SWE::write_VTK_data(snapshot, raw_data_file);
+    }
+
+    static void write_VTU_data(const ProblemOutputSnapshotType& snapshot,
+                               std::ofstream& raw_data_file,
+                               const Utilities::VTUFormat format) {
+        SWE::write_VTU_data(snapshot, raw_data_file, format);
+    }
+
+    static void write_modal_data(const ProblemOutputSnapshotType& snapshot, const std::string& output_path) {
+        SWE::write_modal_data(snapshot, output_path);
+    }
+
+    static void write_station_data(ProblemMeshType& mesh,
+                                   const std::vector<uint>& element_IDs,
+                                   std::vector<double>& station_data) {
+        SWE::write_station_data(mesh, element_IDs, station_data);
+    }
+
+    static void update_extrema(const ProblemStepperType& stepper, ProblemMeshType& mesh, ProblemExtremaType& extrema) {
+        SWE::update_extrema(stepper, mesh, extrema);
+    }
+
+    static void write_extrema_VTU_data(const ProblemExtremaType& extrema,
+                                       std::ofstream& raw_data_file,
+                                       const Utilities::VTUFormat format) {
+        SWE::write_extrema_VTU_data(extrema, raw_data_file, format);
+    }
+
+    static void write_extrema_checkpoint(const ProblemExtremaType& extrema, std::ostream& file) {
+        SWE::write_extrema_checkpoint(extrema, file);
+    }
+
+    static void read_extrema_checkpoint(ProblemMeshType& mesh, ProblemExtremaType& extrema, std::istream& file) {
+        SWE::read_extrema_checkpoint(mesh, extrema, file);
     }
 
-    static void write_VTU_data(ProblemMeshType& mesh, std::ofstream& raw_data_file) {
-        SWE::write_VTU_data(mesh, raw_data_file);
+    static void write_checkpoint_data(ProblemMeshType& mesh, std::ostream& file) {
+        SWE::write_checkpoint_data(mesh, file);
     }
 
-    static void write_modal_data(const ProblemStepperType& stepper,
-                                 ProblemMeshType& mesh,
-                                 const std::string& output_path) {
-        SWE::write_modal_data(stepper, mesh, output_path);
+    static void read_checkpoint_data(ProblemMeshType& mesh, std::istream& file) {
+        SWE::read_checkpoint_data(mesh, file);
     }
 
     template <typename ElementType>
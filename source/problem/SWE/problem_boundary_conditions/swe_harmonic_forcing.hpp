@@ -0,0 +1,207 @@
+#ifndef SWE_HARMONIC_FORCING_HPP
+#define SWE_HARMONIC_FORCING_HPP
+
+namespace SWE {
+/**
+ * Phasors cos(frequency * t), sin(frequency * t) of the constituents of a harmonic forcing, shared by all boundaries
+ * of a submesh forced by the same constituents. Moving the phasors to a new time rotates them by the time increment.
+ * A stepper only produces a handful of distinct increments between stage times, their rotations are cached, so that
+ * no trigonometric function is evaluated in the time loop.
+ */
+class HarmonicPhasors {
+  private:
+    // number of rotations after which the phasors are recomputed from the time to bound the accumulated round-off
+    static constexpr uint resync_interval = 1024;
+    // number of distinct time increments whose rotations are cached
+    static constexpr uint max_rotations = 8;
+
+    struct Rotation {
+        double increment;
+        std::vector<double> cos_increment;
+        std::vector<double> sin_increment;
+    };
+
+    std::vector<double> frequency;
+
+    double time      = 0.0;
+    uint n_rotations = 0;
+
+    // cos(frequency * time) by constituent followed by sin(frequency * time)
+    DynRowVector<double> phasors;
+
+    std::vector<Rotation> rotations;
+
+  public:
+    HarmonicPhasors(const std::vector<double>& frequency);
+
+    uint GetNumberConstituents() const { return this->frequency.size(); }
+
+    /**
+     * @param time time to move the phasors to
+     * @return cos(frequency * time) by constituent followed by sin(frequency * time)
+     */
+    const DynRowVector<double>& AtTime(const double time);
+
+  private:
+    void Synchronize(const double time);
+    const Rotation& GetRotation(const double increment);
+};
+
+inline HarmonicPhasors::HarmonicPhasors(const std::vector<double>& frequency) : frequency(frequency) {
+    this->phasors.resize(2 * this->frequency.size());
+
+    this->Synchronize(0.0);
+}
+
+inline const DynRowVector<double>& HarmonicPhasors::AtTime(const double time) {
+    if (time == this->time) {
+        return this->phasors;
+    }
+
+    if (this->n_rotations == resync_interval) {
+        this->Synchronize(time);
+
+        return this->phasors;
+    }
+
+    const Rotation& rotation = this->GetRotation(time - this->time);
+
+    const uint n_constituents = this->frequency.size();
+
+    for (uint con = 0; con < n_constituents; ++con) {
+        const double cos_con = this->phasors[con];
+        const double sin_con = this->phasors[n_constituents + con];
+
+        this->phasors[con] = cos_con * rotation.cos_increment[con] - sin_con * rotation.sin_increment[con];
+        this->phasors[n_constituents + con] =
+            sin_con * rotation.cos_increment[con] + cos_con * rotation.sin_increment[con];
+    }
+
+    this->time = time;
+    ++this->n_rotations;
+
+    return this->phasors;
+}
+
+inline void HarmonicPhasors::Synchronize(const double time) {
+    const uint n_constituents = this->frequency.size();
+
+    for (uint con = 0; con < n_constituents; ++con) {
+        this->phasors[con]                  = cos(this->frequency[con] * time);
+        this->phasors[n_constituents + con] = sin(this->frequency[con] * time);
+    }
+
+    this->time        = time;
+    this->n_rotations = 0;
+}
+
+inline const HarmonicPhasors::Rotation& HarmonicPhasors::GetRotation(const double increment) {
+    // increments between the same stages differ by the round-off of the stage times
+    const double tolerance = 4 * std::numeric_limits<double>::epsilon() * std::max(std::abs(this->time), 1.0);
+
+    for (const Rotation& rotation : this->rotations) {
+        if (std::abs(rotation.increment - increment) <= tolerance) {
+            return rotation;
+        }
+    }
+
+    // least recently added rotation is dropped if a stepper produces more increments than cached
+    if (this->rotations.size() == max_rotations) {
+        this->rotations.erase(this->rotations.begin());
+    }
+
+    Rotation rotation;
+    rotation.increment = increment;
+
+    for (const double freq : this->frequency) {
+        rotation.cos_increment.push_back(cos(freq * increment));
+        rotation.sin_increment.push_back(sin(freq * increment));
+    }
+
+    this->rotations.push_back(std::move(rotation));
+
+    return this->rotations.back();
+}
+
+/**
+ * Harmonic forcing at the gauss points of a boundary,
+ * sum over constituents of forcing_fact * amplitude * cos(frequency * t + (equilib_arg - phase) * PI / 180),
+ * with amplitude and phase interpolated to the gauss points. Written as the real part of complex amplitudes times the
+ * phasors e^{i frequency t}, the complex amplitudes are precomputed once and evaluating the forcing at a time is a
+ * single product of the shared phasors with the amplitude matrix of the boundary.
+ */
+class HarmonicForcing {
+  private:
+    std::shared_ptr<HarmonicPhasors> phasors;
+
+    std::vector<double> forcing_fact;
+    std::vector<double> equilib_arg;
+
+    std::vector<DynRowVector<double>> amplitude;
+    std::vector<DynRowVector<double>> phase;
+
+    // rows: real part of the complex amplitudes by constituent followed by the negated imaginary part
+    // columns: gauss points
+    DynMatrix<double> amplitudes_gp;
+
+  public:
+    HarmonicForcing() = default;
+    template <typename NodeType>
+    HarmonicForcing(const std::vector<NodeType>& node_input, const std::shared_ptr<HarmonicPhasors>& phasors);
+
+    template <typename BoundaryType>
+    void Initialize(BoundaryType& bound);
+
+    /**
+     * @param time time to evaluate the forcing at
+     * @return forcing by gauss point, without ramp
+     */
+    DynRowVector<double> ComputeForcing(const double time) {
+        return this->phasors->AtTime(time) * this->amplitudes_gp;
+    }
+};
+
+template <typename NodeType>
+HarmonicForcing::HarmonicForcing(const std::vector<NodeType>& node_input,
+                                 const std::shared_ptr<HarmonicPhasors>& phasors)
+    : phasors(phasors), forcing_fact(node_input[0].forcing_fact), equilib_arg(node_input[0].equilib_arg) {
+    uint n_contituents = this->phasors->GetNumberConstituents();
+    uint n_nodes       = node_input.size();
+
+    this->amplitude.resize(n_contituents);
+    this->phase.resize(n_contituents);
+
+    for (uint con = 0; con < n_contituents; ++con) {
+        this->amplitude[con].resize(n_nodes);
+        this->phase[con].resize(n_nodes);
+
+        for (uint node = 0; node < n_nodes; ++node) {
+            this->amplitude[con][node] = node_input[node].amplitude[con];
+            this->phase[con][node]     = node_input[node].phase[con];
+        }
+    }
+}
+
+template <typename BoundaryType>
+void HarmonicForcing::Initialize(BoundaryType& bound) {
+    uint ngp           = bound.data.get_ngp_boundary(bound.bound_id);
+    uint n_contituents = this->phasors->GetNumberConstituents();
+
+    this->amplitudes_gp.resize(2 * n_contituents, ngp);
+
+    for (uint con = 0; con < n_contituents; ++con) {
+        DynRowVector<double> amplitude_gp = bound.ComputeBoundaryNodalUgp(this->amplitude[con]);
+        DynRowVector<double> phase_gp     = bound.ComputeBoundaryNodalUgp(this->phase[con]);
+
+        for (uint gp = 0; gp < ngp; ++gp) {
+            const double amp = this->forcing_fact[con] * amplitude_gp[gp];
+            const double arg = (this->equilib_arg[con] - phase_gp[gp]) * PI / 180;
+
+            this->amplitudes_gp(con, gp)                 = amp * cos(arg);
+            this->amplitudes_gp(n_contituents + con, gp) = -amp * sin(arg);
+        }
+    }
+}
+}
+
+#endif
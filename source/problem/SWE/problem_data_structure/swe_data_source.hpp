@@ -4,22 +4,22 @@
 namespace SWE {
 struct Source {
     Source() = default;
-    Source(const uint nnode)
-        : parsed_meteo_data(nnode), tau_s(nnode), p_atm(nnode), tide_pot(nnode), manning_n(nnode) {}
+    Source(const uint nnode) : tau_s(nnode), p_atm(nnode), tide_pot(nnode), manning_n(nnode) {}
 
     double coriolis_f = 0.0;
 
     bool manning          = false;
     double g_manning_n_sq = 0.0;
 
-    std::vector<std::vector<double>*> parsed_meteo_data;
-
     AlignedVector<StatVector<double, SWE::n_dimensions>> tau_s;
     std::vector<double> p_atm;
 
     std::vector<double> tide_pot;
     std::vector<double> manning_n;
 
+    // function source tabulated at the gauss points, see SWE::SourceFunction
+    HybMatrix<double, SWE::n_variables> function_source_at_gp;
+
 #ifdef HAS_HPX
     template <typename Archive>
     void serialize(Archive& ar, unsigned) {
@@ -30,7 +30,8 @@ struct Source {
             & tau_s
             & p_atm
             & tide_pot
-            & manning_n;
+            & manning_n
+            & function_source_at_gp;
         // clang-format on
     }
 #endif
@@ -0,0 +1,43 @@
+#ifndef SWE_BOUNDARY_CONDITION_FUNCTIONS_HPP
+#define SWE_BOUNDARY_CONDITION_FUNCTIONS_HPP
+
+#include "utilities/ignore.hpp"
+#include "utilities/function_table.hpp"
+#include "swe_initial_condition_functions.hpp"
+
+namespace SWE {
+inline StatVector<double, SWE::n_variables> bc_q(const double t, const Point<2>& pt) {
+    double ze = 0.0;
+    double qx = 0.0;
+    double qy = 0.0;
+
+    Utilities::ignore(ze, qx, qy);
+
+    if (t <= 3.0) {
+        ze = cos(PI * t) - 1.0;
+    } else {
+        ze = -2.0;
+    }
+
+    // StatVector<double, SWE::n_variables> q{ze, qx, qy};
+    StatVector<double, SWE::n_variables> q(SWE::ic_q(t, pt));
+
+    return q;
+}
+
+// Batched bc_q at the gauss points of a function boundary, see Utilities::TimeDependence
+struct BoundaryFunction {
+    static constexpr Utilities::TimeDependence time_dependence = Utilities::TimeDependence::general;
+
+    static double time_factor(const double t) { return 1.0; }
+
+    template <typename ValuesType>
+    static void evaluate(const double t, const AlignedVector<Point<2>>& points, ValuesType& values) {
+        for (uint pt = 0; pt < points.size(); ++pt) {
+            column(values, pt) = SWE::bc_q(t, points[pt]);
+        }
+    }
+};
+}
+
+#endif
@@ -0,0 +1,238 @@
+#ifndef SWE_METEO_FILE_HPP
+#define SWE_METEO_FILE_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "general_definitions.hpp"
+#include "utilities/file_exists.hpp"
+
+namespace SWE {
+/**
+ * Meteorological forcing at the nodes of a submesh, as structure of arrays over the local node indices.
+ */
+struct MeteoRecord {
+    std::vector<double> tau_x;
+    std::vector<double> tau_y;
+    std::vector<double> p_atm;
+
+    MeteoRecord() = default;
+    MeteoRecord(const uint n_nodes) : tau_x(n_nodes), tau_y(n_nodes), p_atm(n_nodes) {}
+
+    uint size() const { return this->tau_x.size(); }
+
+#ifdef HAS_HPX
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned) {
+        // clang-format off
+        ar  & tau_x
+            & tau_y
+            & p_atm;
+        // clang-format on
+    }
+#endif
+};
+
+/**
+ * Binary source of meteorological forcing records, restricted to the nodes of a submesh.
+ */
+class MeteoReader {
+  public:
+    virtual ~MeteoReader() = default;
+
+    virtual uint GetNumberRecords() const = 0;
+    virtual double GetInterval() const = 0;
+
+    /**
+     * Read a record for the selected nodes. Safe to call concurrently, the file offset is never modified.
+     *
+     * @param record index of the record
+     * @return forcing by local node index
+     */
+    virtual MeteoRecord ReadRecord(const uint record) const = 0;
+};
+
+/**
+ * Reader of binary meteorological forcing files, holding all forcing records of a run in one file.
+ * Layout: "DGSWEMET", uint32 number of nodes, uint32 number of records, float64 time between records in seconds,
+ * uint32 node IDs, followed by one record per forcing step made of the float32 arrays tau_x, tau_y, p_atm over all
+ * nodes, in the order of the node IDs. Only the values of the nodes selected by a submesh are read.
+ */
+class MeteoFile : public MeteoReader {
+  private:
+    struct Header {
+        char magic[8];
+        std::uint32_t n_nodes;
+        std::uint32_t n_records;
+        double interval;
+    };
+
+    // contiguous range of node positions read at once, gaps smaller than this are read through
+    static constexpr uint max_gap = 64;
+
+    std::string file_name;
+    int fd = -1;
+
+    Header header;
+    std::vector<uint> file_node_IDs;
+
+    uint n_selected_nodes = 0;
+    // positions of the selected nodes in the file with their local indices, and runs (first position, number of
+    // positions) covering them
+    std::vector<uint> node_positions;
+    std::vector<uint> node_indices;
+    std::vector<std::pair<uint, uint>> runs;
+
+  public:
+    static bool IsMeteoFile(const std::string& file_name);
+
+    MeteoFile(const std::string& file_name);
+    ~MeteoFile() override;
+
+    MeteoFile(const MeteoFile&) = delete;
+    MeteoFile& operator=(const MeteoFile&) = delete;
+
+    uint GetNumberRecords() const override { return this->header.n_records; }
+    double GetInterval() const override { return this->header.interval; }
+
+    /**
+     * Restrict reading to a set of nodes.
+     *
+     * @param node_IDs IDs of the nodes of the submesh by local node index, all of them must be present in the file
+     */
+    void SelectNodes(const std::vector<uint>& node_IDs);
+
+    MeteoRecord ReadRecord(const uint record) const override;
+};
+
+inline bool MeteoFile::IsMeteoFile(const std::string& file_name) {
+    if (!Utilities::file_exists(file_name)) {
+        return false;
+    }
+
+    std::ifstream file(file_name, std::ios_base::binary);
+
+    std::array<char, 8> magic;
+    file.read(magic.data(), 8);
+
+    return file && std::string(magic.data(), 8) == "DGSWEMET";
+}
+
+inline MeteoFile::MeteoFile(const std::string& file_name) : file_name(file_name) {
+    this->fd = open(file_name.c_str(), O_RDONLY);
+
+    if (this->fd < 0) {
+        throw std::logic_error("Fatal Error: unable to open meteo data file " + file_name + "\n");
+    }
+
+    if (pread(this->fd, &this->header, sizeof(Header), 0) != sizeof(Header) ||
+        std::memcmp(this->header.magic, "DGSWEMET", 8) != 0) {
+        close(this->fd);
+        throw std::logic_error("Fatal Error: " + file_name + " is not a binary meteo data file\n");
+    }
+
+    std::vector<std::uint32_t> IDs(this->header.n_nodes);
+
+    const ssize_t n_bytes = this->header.n_nodes * sizeof(std::uint32_t);
+
+    if (pread(this->fd, IDs.data(), n_bytes, sizeof(Header)) != n_bytes) {
+        close(this->fd);
+        throw std::logic_error("Fatal Error: meteo data file " + file_name + " is truncated\n");
+    }
+
+    this->file_node_IDs.assign(IDs.begin(), IDs.end());
+}
+
+inline MeteoFile::~MeteoFile() {
+    if (this->fd >= 0) {
+        close(this->fd);
+    }
+}
+
+inline void MeteoFile::SelectNodes(const std::vector<uint>& node_IDs) {
+    std::unordered_map<uint, uint> file_positions;
+    file_positions.reserve(this->file_node_IDs.size());
+
+    for (uint position = 0; position < this->file_node_IDs.size(); ++position) {
+        file_positions[this->file_node_IDs[position]] = position;
+    }
+
+    std::vector<std::pair<uint, uint>> position_indices;
+    position_indices.reserve(node_IDs.size());
+
+    for (uint index = 0; index < node_IDs.size(); ++index) {
+        if (!file_positions.count(node_IDs[index])) {
+            throw std::logic_error("Fatal Error: node " + std::to_string(node_IDs[index]) +
+                                   " is missing in meteo data file " + this->file_name + "\n");
+        }
+
+        position_indices.emplace_back(file_positions[node_IDs[index]], index);
+    }
+
+    // read in file order
+    std::sort(position_indices.begin(), position_indices.end());
+
+    this->n_selected_nodes = node_IDs.size();
+    this->node_positions.clear();
+    this->node_indices.clear();
+    this->runs.clear();
+
+    for (const auto& position_index : position_indices) {
+        const uint position = position_index.first;
+
+        if (this->runs.empty() || position > this->runs.back().first + this->runs.back().second + max_gap) {
+            this->runs.emplace_back(position, 1);
+        } else {
+            this->runs.back().second = position - this->runs.back().first + 1;
+        }
+
+        this->node_positions.push_back(position);
+        this->node_indices.push_back(position_index.second);
+    }
+}
+
+inline MeteoRecord MeteoFile::ReadRecord(const uint record) const {
+    if (record >= this->header.n_records) {
+        throw std::logic_error("Fatal Error: meteo data file " + this->file_name + " holds " +
+                               std::to_string(this->header.n_records) + " records, record " + std::to_string(record) +
+                               " was requested\n");
+    }
+
+    const std::size_t data_offset = sizeof(Header) + this->header.n_nodes * sizeof(std::uint32_t);
+    const std::size_t field_size  = this->header.n_nodes * sizeof(float);
+
+    MeteoRecord values(this->n_selected_nodes);
+
+    std::vector<float> buffer;
+
+    // fields in the order they are stored in a record
+    const std::array<std::vector<double>*, 3> fields{{&values.tau_x, &values.tau_y, &values.p_atm}};
+
+    for (uint field = 0; field < 3; ++field) {
+        const std::size_t field_offset = data_offset + (3 * (std::size_t)record + field) * field_size;
+
+        uint node = 0;
+
+        for (const std::pair<uint, uint>& run : this->runs) {
+            buffer.resize(run.second);
+
+            const ssize_t n_bytes = run.second * sizeof(float);
+
+            if (pread(this->fd, buffer.data(), n_bytes, field_offset + run.first * sizeof(float)) != n_bytes) {
+                throw std::logic_error("Fatal Error: meteo data file " + this->file_name + " is truncated at record " +
+                                       std::to_string(record) + "\n");
+            }
+
+            for (; node < this->node_positions.size() && this->node_positions[node] < run.first + run.second; ++node) {
+                (*fields[field])[this->node_indices[node]] = buffer[this->node_positions[node] - run.first];
+            }
+        }
+    }
+
+    return values;
+}
+}
+
+#endif
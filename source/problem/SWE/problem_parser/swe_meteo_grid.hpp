@@ -0,0 +1,224 @@
+#ifndef SWE_METEO_GRID_HPP
+#define SWE_METEO_GRID_HPP
+
+#include "swe_meteo_file.hpp"
+
+namespace SWE {
+/**
+ * Reader of gridded binary meteorological forcing files, interpolating the fields bilinearly to the mesh nodes.
+ * Layout: "DGSWEGRD", uint32 nx, ny, number of records, padding, float64 x0, y0, dx, dy (grid origin and spacing in
+ * the coordinate system of the mesh input, i.e. degrees for spherical meshes), float64 time between records in
+ * seconds, followed by one record per forcing step made of the float32 fields tau_x, tau_y, p_atm, each stored row by
+ * row (index j * nx + i). Only the window of the grid covering the selected nodes is read; nodes outside of the grid
+ * take the values of its boundary.
+ */
+class MeteoGrid : public MeteoReader {
+  private:
+    struct Header {
+        char magic[8];
+        std::uint32_t nx;
+        std::uint32_t ny;
+        std::uint32_t n_records;
+        std::uint32_t padding;
+        double x0;
+        double y0;
+        double dx;
+        double dy;
+        double interval;
+    };
+
+    std::string file_name;
+    int fd = -1;
+
+    Header header;
+
+    // window of the grid covering the selected nodes
+    std::array<uint, 2> window_begin{0, 0};
+    std::array<uint, 2> window_size{0, 0};
+
+    // per selected node, offset of the lower left corner of its grid cell in the window and bilinear weights of the
+    // cell corners (i, j), (i + 1, j), (i, j + 1), (i + 1, j + 1)
+    std::vector<uint> node_offsets;
+    std::vector<std::array<double, 4>> node_weights;
+
+  public:
+    static bool IsMeteoGrid(const std::string& file_name);
+
+    MeteoGrid(const std::string& file_name);
+    ~MeteoGrid() override;
+
+    MeteoGrid(const MeteoGrid&) = delete;
+    MeteoGrid& operator=(const MeteoGrid&) = delete;
+
+    uint GetNumberRecords() const override { return this->header.n_records; }
+    double GetInterval() const override { return this->header.interval; }
+
+    /**
+     * Map the grid into the cartesian coordinates a spherical mesh is projected to in the preprocessor.
+     * The projection acts on longitude and latitude separately, so the grid stays regular.
+     *
+     * @param projection spherical projection of the mesh
+     */
+    void ProjectGrid(const SphericalProjection& projection);
+
+    /**
+     * Precompute the grid cells and interpolation weights of a set of nodes.
+     *
+     * @param node_coordinates x, y of the nodes of the submesh by local node index
+     */
+    void SelectNodes(const std::vector<std::array<double, 2>>& node_coordinates);
+
+    MeteoRecord ReadRecord(const uint record) const override;
+};
+
+inline bool MeteoGrid::IsMeteoGrid(const std::string& file_name) {
+    if (!Utilities::file_exists(file_name)) {
+        return false;
+    }
+
+    std::ifstream file(file_name, std::ios_base::binary);
+
+    std::array<char, 8> magic;
+    file.read(magic.data(), 8);
+
+    return file && std::string(magic.data(), 8) == "DGSWEGRD";
+}
+
+inline MeteoGrid::MeteoGrid(const std::string& file_name) : file_name(file_name) {
+    this->fd = open(file_name.c_str(), O_RDONLY);
+
+    if (this->fd < 0) {
+        throw std::logic_error("Fatal Error: unable to open meteo grid file " + file_name + "\n");
+    }
+
+    if (pread(this->fd, &this->header, sizeof(Header), 0) != sizeof(Header) ||
+        std::memcmp(this->header.magic, "DGSWEGRD", 8) != 0) {
+        close(this->fd);
+        throw std::logic_error("Fatal Error: " + file_name + " is not a binary meteo grid file\n");
+    }
+
+    if (this->header.nx < 2 || this->header.ny < 2 || this->header.dx <= 0.0 || this->header.dy <= 0.0) {
+        close(this->fd);
+        throw std::logic_error("Fatal Error: meteo grid file " + file_name + " does not describe a regular grid\n");
+    }
+}
+
+inline MeteoGrid::~MeteoGrid() {
+    if (this->fd >= 0) {
+        close(this->fd);
+    }
+}
+
+inline void MeteoGrid::ProjectGrid(const SphericalProjection& projection) {
+    // as in SWE::preprocess_mesh_data
+    const double R_o = projection.R * cos(projection.latitude_o * PI / 180.0);
+
+    this->header.x0 = R_o * (this->header.x0 - projection.longitude_o) * PI / 180.0;
+    this->header.dx = R_o * this->header.dx * PI / 180.0;
+    this->header.y0 = projection.R * this->header.y0 * PI / 180.0;
+    this->header.dy = projection.R * this->header.dy * PI / 180.0;
+}
+
+inline void MeteoGrid::SelectNodes(const std::vector<std::array<double, 2>>& node_coordinates) {
+    const std::array<uint, 2> n_points{this->header.nx, this->header.ny};
+    const std::array<double, 2> origin{this->header.x0, this->header.y0};
+    const std::array<double, 2> spacing{this->header.dx, this->header.dy};
+
+    // per node and direction, index of the cell and local coordinate in it
+    std::vector<std::array<uint, 2>> cells(node_coordinates.size());
+    std::vector<std::array<double, 2>> local(node_coordinates.size());
+
+    std::array<uint, 2> cell_min{n_points[GlobalCoord::x], n_points[GlobalCoord::y]};
+    std::array<uint, 2> cell_max{0, 0};
+
+    for (uint node = 0; node < node_coordinates.size(); ++node) {
+        for (uint dir = 0; dir < 2; ++dir) {
+            const double grid_coordinate = std::min(std::max((node_coordinates[node][dir] - origin[dir]) / spacing[dir],
+                                                             0.0),
+                                                    (double)(n_points[dir] - 1));
+
+            cells[node][dir] = std::min((uint)grid_coordinate, n_points[dir] - 2);
+            local[node][dir] = grid_coordinate - cells[node][dir];
+
+            cell_min[dir] = std::min(cell_min[dir], cells[node][dir]);
+            cell_max[dir] = std::max(cell_max[dir], cells[node][dir]);
+        }
+    }
+
+    this->node_offsets.resize(node_coordinates.size());
+    this->node_weights.resize(node_coordinates.size());
+
+    if (node_coordinates.empty()) {
+        this->window_size = {0, 0};
+
+        return;
+    }
+
+    for (uint dir = 0; dir < 2; ++dir) {
+        this->window_begin[dir] = cell_min[dir];
+        this->window_size[dir]  = cell_max[dir] - cell_min[dir] + 2;
+    }
+
+    for (uint node = 0; node < node_coordinates.size(); ++node) {
+        this->node_offsets[node] = (cells[node][GlobalCoord::y] - this->window_begin[GlobalCoord::y]) *
+                                       this->window_size[GlobalCoord::x] +
+                                   cells[node][GlobalCoord::x] - this->window_begin[GlobalCoord::x];
+
+        const double wx = local[node][GlobalCoord::x];
+        const double wy = local[node][GlobalCoord::y];
+
+        this->node_weights[node] = {(1.0 - wx) * (1.0 - wy), wx * (1.0 - wy), (1.0 - wx) * wy, wx * wy};
+    }
+}
+
+inline MeteoRecord MeteoGrid::ReadRecord(const uint record) const {
+    if (record >= this->header.n_records) {
+        throw std::logic_error("Fatal Error: meteo grid file " + this->file_name + " holds " +
+                               std::to_string(this->header.n_records) + " records, record " + std::to_string(record) +
+                               " was requested\n");
+    }
+
+    const std::size_t field_size = (std::size_t)this->header.nx * this->header.ny * sizeof(float);
+
+    const uint window_x = this->window_size[GlobalCoord::x];
+
+    MeteoRecord values(this->node_offsets.size());
+
+    std::vector<float> window((std::size_t)window_x * this->window_size[GlobalCoord::y]);
+
+    // fields in the order they are stored in a record
+    const std::array<std::vector<double>*, 3> fields{{&values.tau_x, &values.tau_y, &values.p_atm}};
+
+    for (uint field = 0; field < 3; ++field) {
+        const std::size_t field_offset = sizeof(Header) + (3 * (std::size_t)record + field) * field_size;
+
+        for (uint row = 0; row < this->window_size[GlobalCoord::y]; ++row) {
+            const std::size_t grid_index =
+                (std::size_t)(this->window_begin[GlobalCoord::y] + row) * this->header.nx +
+                this->window_begin[GlobalCoord::x];
+
+            const ssize_t n_bytes = window_x * sizeof(float);
+
+            if (pread(this->fd, &window[row * window_x], n_bytes, field_offset + grid_index * sizeof(float)) !=
+                n_bytes) {
+                throw std::logic_error("Fatal Error: meteo grid file " + this->file_name + " is truncated at record " +
+                                       std::to_string(record) + "\n");
+            }
+        }
+
+        std::vector<double>& field_values = *fields[field];
+
+        for (uint node = 0; node < this->node_offsets.size(); ++node) {
+            const uint offset                   = this->node_offsets[node];
+            const std::array<double, 4>& weight = this->node_weights[node];
+
+            field_values[node] = weight[0] * window[offset] + weight[1] * window[offset + 1] +
+                                 weight[2] * window[offset + window_x] + weight[3] * window[offset + window_x + 1];
+        }
+    }
+
+    return values;
+}
+}
+
+#endif
@@ -3,16 +3,50 @@
 
 #include "utilities/file_exists.hpp"
 #include "preprocessor/input_parameters.hpp"
+#include "swe_meteo_file.hpp"
+#include "swe_meteo_grid.hpp"
+
+#ifdef HAS_HPX
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#else
+#include <future>
+#endif
 
 namespace SWE {
+// one text file per record, one binary file of nodal records, or one binary file of gridded records
+enum class MeteoFileFormat : uchar { text, nodal, gridded };
+
 class Parser {
   private:
     bool parsing_input = false;
 
     uint meteo_parse_frequency;
+    double meteo_frequency;
     std::string meteo_data_file;
-    std::map<uint, std::map<uint, std::vector<double>>> node_meteo_data_step;
-    std::map<uint, std::vector<double>> node_meteo_data_interp;
+
+    // nodes of the submesh by local node index, and per element node in traversal order its local node index
+    std::vector<uint> meteo_node_IDs;
+    std::vector<uint> element_node_indices;
+    std::unordered_map<uint, uint> meteo_node_index;
+
+    std::map<uint, MeteoRecord> meteo_data_step;
+    MeteoRecord meteo_data_interp;
+
+    // binary files hold all records of a run and are opened on the first parse
+    MeteoFileFormat meteo_format = MeteoFileFormat::text;
+    std::shared_ptr<MeteoReader> meteo_file;
+
+    // gridded records are interpolated to the projected mesh nodes
+    bool meteo_spherical = false;
+    SphericalProjection spherical_projection;
+    // the record after the ones in use is read in the background while stepping
+    uint prefetch_step;
+#ifdef HAS_HPX
+    hpx::future<MeteoRecord> prefetch;
+#else
+    std::future<MeteoRecord> prefetch;
+#endif
 
   public:
     Parser() = default;
@@ -27,8 +61,15 @@ class Parser {
     void ParseInput(const StepperType& stepper, MeshType& mesh);
 
   private:
+    template <typename MeshType>
+    void InitializeMeteoNodes(MeshType& mesh);
+    template <typename MeshType>
+    void OpenMeteoFile(MeshType& mesh);
     template <typename StepperType>
     void ParseMeteoInput(const StepperType& stepper);
+    void ReadMeteoData(const uint step);
+    void PrefetchMeteoData(const uint step);
+    void WaitForPrefetch();
     template <typename StepperType>
     void InterpolateMeteoData(const StepperType& stepper);
 
@@ -36,12 +77,21 @@ class Parser {
 #ifdef HAS_HPX
     template <typename Archive>
     void serialize(Archive& ar, unsigned) {
+        // a record being prefetched is migrated along with the parsed ones, the file is reopened after migration
+        this->WaitForPrefetch();
+
         // clang-format off
         ar  & parsing_input
             & meteo_parse_frequency
+            & meteo_frequency
             & meteo_data_file
-            & node_meteo_data_step
-            & node_meteo_data_interp;
+            & meteo_node_IDs
+            & element_node_indices
+            & meteo_data_step
+            & meteo_data_interp
+            & meteo_format
+            & meteo_spherical
+            & spherical_projection;
         // clang-format on
     }
 #endif
@@ -54,7 +104,17 @@ Parser::Parser(const InputParameters<ProblemSpecificInputType>& input) {
 
         this->meteo_parse_frequency =
             (uint)std::ceil(input.problem_input.meteo_forcing.frequency / input.stepper_input.dt);
+        this->meteo_frequency = input.problem_input.meteo_forcing.frequency;
         this->meteo_data_file = input.problem_input.meteo_forcing.meteo_data_file;
+
+        if (MeteoFile::IsMeteoFile(this->meteo_data_file)) {
+            this->meteo_format = MeteoFileFormat::nodal;
+        } else if (MeteoGrid::IsMeteoGrid(this->meteo_data_file)) {
+            this->meteo_format = MeteoFileFormat::gridded;
+        }
+
+        this->meteo_spherical      = input.mesh_input.mesh_coordinate_sys == CoordinateSystem::spherical;
+        this->spherical_projection = input.problem_input.spherical_projection;
     }
 }
 
@@ -65,94 +125,213 @@ Parser::Parser(const InputParameters<ProblemSpecificInputType>& input, const uin
 template <typename StepperType, typename MeshType>
 void Parser::ParseInput(const StepperType& stepper, MeshType& mesh) {
     if (SWE::SourceTerms::meteo_forcing) {
-        if (stepper.GetStep() % this->meteo_parse_frequency == 0 && stepper.GetStage() == 0) {
+        if (this->meteo_node_IDs.empty()) {
+            this->InitializeMeteoNodes(mesh);
+        }
+
+        if (this->meteo_format != MeteoFileFormat::text && !this->meteo_file) {
+            this->OpenMeteoFile(mesh);
+        }
+
+        // a restarted simulation starts parsing in the middle of a parse interval
+        if ((stepper.GetStep() % this->meteo_parse_frequency == 0 && stepper.GetStage() == 0) ||
+            this->meteo_data_step.empty()) {
             this->ParseMeteoInput(stepper);
         }
 
-        // Initialize container to store parsed data and store pointers for fast access
-        if (stepper.GetStep() == 0 && stepper.GetStage() == 0) {
-            mesh.CallForEachElement([this](auto& elt) {
-                const std::vector<uint>& node_ID = elt.GetNodeID();
+        this->InterpolateMeteoData(stepper);
+
+        uint index = 0;
 
-                for (uint node = 0; node < elt.data.get_nnode(); ++node) {
-                    if (this->node_meteo_data_interp.find(node_ID[node]) == this->node_meteo_data_interp.end()) {
-                        this->node_meteo_data_interp[node_ID[node]] = std::vector<double>(3);
-                    }
+        mesh.CallForEachElement([this, &index](auto& elt) {
+            for (uint node = 0; node < elt.data.get_nnode(); ++node, ++index) {
+                const uint node_index = this->element_node_indices[index];
 
-                    elt.data.source.parsed_meteo_data[node] = &this->node_meteo_data_interp[node_ID[node]];
-                }
-            });
+                elt.data.source.tau_s[node][GlobalCoord::x] = this->meteo_data_interp.tau_x[node_index];
+                elt.data.source.tau_s[node][GlobalCoord::y] = this->meteo_data_interp.tau_y[node_index];
+                elt.data.source.p_atm[node]                 = this->meteo_data_interp.p_atm[node_index];
+            }
+        });
+    }
+}
+
+template <typename MeshType>
+void Parser::InitializeMeteoNodes(MeshType& mesh) {
+    this->meteo_node_index.clear();
+    this->element_node_indices.clear();
+
+    mesh.CallForEachElement([this](auto& elt) {
+        const std::vector<uint>& node_ID = elt.GetNodeID();
+
+        for (uint node = 0; node < elt.data.get_nnode(); ++node) {
+            const auto node_index = this->meteo_node_index.emplace(node_ID[node], this->meteo_node_IDs.size());
+
+            if (node_index.second) {
+                this->meteo_node_IDs.push_back(node_ID[node]);
+            }
+
+            this->element_node_indices.push_back(node_index.first->second);
         }
+    });
 
-        this->InterpolateMeteoData(stepper);
+    this->meteo_data_interp = MeteoRecord(this->meteo_node_IDs.size());
+}
+
+template <typename MeshType>
+void Parser::OpenMeteoFile(MeshType& mesh) {
+    if (this->meteo_format == MeteoFileFormat::nodal) {
+        auto meteo_file = std::make_shared<MeteoFile>(this->meteo_data_file);
+
+        meteo_file->SelectNodes(this->meteo_node_IDs);
+
+        this->meteo_file = std::move(meteo_file);
+    } else {
+        auto meteo_grid = std::make_shared<MeteoGrid>(this->meteo_data_file);
+
+        if (this->meteo_spherical) {
+            meteo_grid->ProjectGrid(this->spherical_projection);
+        }
+
+        // coordinates after the preprocessor's projection, placed through the element node indices
+        std::vector<std::array<double, 2>> node_coordinates(this->meteo_node_IDs.size());
+
+        uint index = 0;
 
-        mesh.CallForEachElement([](auto& elt) {
-            for (uint node = 0; node < elt.data.get_nnode(); ++node) {
-                elt.data.source.tau_s[node][GlobalCoord::x] = elt.data.source.parsed_meteo_data[node]->at(0);
-                elt.data.source.tau_s[node][GlobalCoord::y] = elt.data.source.parsed_meteo_data[node]->at(1);
-                elt.data.source.p_atm[node]                 = elt.data.source.parsed_meteo_data[node]->at(2);
+        mesh.CallForEachElement([this, &node_coordinates, &index](auto& elt) {
+            const AlignedVector<Point<3>>& nodal_coordinates = elt.GetShape().nodal_coordinates;
+
+            for (uint node = 0; node < elt.data.get_nnode(); ++node, ++index) {
+                node_coordinates[this->element_node_indices[index]] = {nodal_coordinates[node][GlobalCoord::x],
+                                                                       nodal_coordinates[node][GlobalCoord::y]};
             }
         });
+
+        meteo_grid->SelectNodes(node_coordinates);
+
+        this->meteo_file = std::move(meteo_grid);
+    }
+
+    if (std::abs(this->meteo_file->GetInterval() - this->meteo_frequency) > 1.0e-6 * this->meteo_frequency) {
+        throw std::logic_error("Fatal Error: meteo data file " + this->meteo_data_file + " has records every " +
+                               std::to_string(this->meteo_file->GetInterval()) + " s, the input requests " +
+                               std::to_string(this->meteo_frequency) + " s\n");
     }
 }
 
 template <typename StepperType>
 void Parser::ParseMeteoInput(const StepperType& stepper) {
-    uint step = stepper.GetStep();
+    uint step = stepper.GetStep() - stepper.GetStep() % this->meteo_parse_frequency;
 
-    if (this->node_meteo_data_step.find(step - this->meteo_parse_frequency) != this->node_meteo_data_step.end()) {
-        this->node_meteo_data_step.erase(this->node_meteo_data_step.find(step - this->meteo_parse_frequency));
-    }
+    this->meteo_data_step.erase(step - this->meteo_parse_frequency);
 
-    if (this->node_meteo_data_step.find(step) == this->node_meteo_data_step.end()) {
-        std::string meteo_data_file_name = this->meteo_data_file;
+    this->ReadMeteoData(step);
+    this->ReadMeteoData(step + this->meteo_parse_frequency);
 
-        meteo_data_file_name.insert(meteo_data_file_name.find_last_of("."), '_' + std::to_string(step));
+    if (this->meteo_file) {
+        this->PrefetchMeteoData(step + 2 * this->meteo_parse_frequency);
+    }
+}
 
-        if (!Utilities::file_exists(meteo_data_file_name)) {
-            throw std::logic_error("Fatal Error: meteo data file " + meteo_data_file_name + " was not found!\n");
+inline void Parser::ReadMeteoData(const uint step) {
+    if (this->meteo_data_step.find(step) != this->meteo_data_step.end()) {
+        return;
+    }
+
+    if (this->meteo_file) {
+        if (this->prefetch.valid() && this->prefetch_step == step) {
+            this->WaitForPrefetch();
+        } else {
+            this->meteo_data_step[step] = this->meteo_file->ReadRecord(step / this->meteo_parse_frequency);
         }
 
-        std::ifstream meteo_file(meteo_data_file_name);
+        return;
+    }
 
-        uint node_id;
-        std::vector<double> meteo_data(3);
+    std::string meteo_data_file_name = this->meteo_data_file;
 
-        std::string line;
-        while (std::getline(meteo_file, line)) {
-            std::istringstream input_string(line);
+    meteo_data_file_name.insert(meteo_data_file_name.find_last_of("."), '_' + std::to_string(step));
 
-            if (!(input_string >> node_id >> meteo_data[0] >> meteo_data[1] >> meteo_data[2]))
-                break;
+    if (!Utilities::file_exists(meteo_data_file_name)) {
+        throw std::logic_error("Fatal Error: meteo data file " + meteo_data_file_name + " was not found!\n");
+    }
 
-            this->node_meteo_data_step[step][node_id] = meteo_data;
+    // the node index is not migrated along with the parser
+    if (this->meteo_node_index.empty()) {
+        for (uint index = 0; index < this->meteo_node_IDs.size(); ++index) {
+            this->meteo_node_index[this->meteo_node_IDs[index]] = index;
         }
     }
 
-    if (this->node_meteo_data_step.find(step + this->meteo_parse_frequency) == this->node_meteo_data_step.end()) {
-        std::string meteo_data_file_name = this->meteo_data_file;
+    std::ifstream meteo_file(meteo_data_file_name);
+
+    MeteoRecord meteo_data(this->meteo_node_IDs.size());
+    std::vector<bool> parsed(this->meteo_node_IDs.size(), false);
+
+    uint node_id;
+    double tau_x, tau_y, p_atm;
 
-        meteo_data_file_name.insert(meteo_data_file_name.find_last_of("."),
-                                    '_' + std::to_string(step + this->meteo_parse_frequency));
+    std::string line;
+    while (std::getline(meteo_file, line)) {
+        std::istringstream input_string(line);
 
-        if (!Utilities::file_exists(meteo_data_file_name)) {
-            throw std::logic_error("Fatal Error: meteo data file " + meteo_data_file_name + " was not found!\n");
+        if (!(input_string >> node_id >> tau_x >> tau_y >> p_atm))
+            break;
+
+        const auto node_index = this->meteo_node_index.find(node_id);
+
+        // nodes of other submeshes
+        if (node_index == this->meteo_node_index.end()) {
+            continue;
         }
 
-        std::ifstream meteo_file(meteo_data_file_name);
+        meteo_data.tau_x[node_index->second] = tau_x;
+        meteo_data.tau_y[node_index->second] = tau_y;
+        meteo_data.p_atm[node_index->second] = p_atm;
+
+        parsed[node_index->second] = true;
+    }
+
+    const auto missing = std::find(parsed.begin(), parsed.end(), false);
 
-        uint node_id;
-        std::vector<double> meteo_data(3);
+    if (missing != parsed.end()) {
+        throw std::logic_error("Fatal Error: node " + std::to_string(this->meteo_node_IDs[missing - parsed.begin()]) +
+                               " is missing in meteo data file " + meteo_data_file_name + "\n");
+    }
 
-        std::string line;
-        while (std::getline(meteo_file, line)) {
-            std::istringstream input_string(line);
+    this->meteo_data_step[step] = std::move(meteo_data);
+}
 
-            if (!(input_string >> node_id >> meteo_data[0] >> meteo_data[1] >> meteo_data[2]))
-                break;
+inline void Parser::PrefetchMeteoData(const uint step) {
+    const uint record = step / this->meteo_parse_frequency;
+
+    if (record >= this->meteo_file->GetNumberRecords() ||
+        this->meteo_data_step.find(step) != this->meteo_data_step.end()) {
+        return;
+    }
 
-            this->node_meteo_data_step[step + this->meteo_parse_frequency][node_id] = meteo_data;
+    if (this->prefetch.valid()) {
+        if (this->prefetch_step == step) {
+            return;
         }
+
+        this->WaitForPrefetch();
+    }
+
+    this->prefetch_step = step;
+
+    auto read_record = [meteo_file = this->meteo_file, record]() { return meteo_file->ReadRecord(record); };
+
+#ifdef HAS_HPX
+    this->prefetch = hpx::async(std::move(read_record));
+#else
+    this->prefetch = std::async(std::launch::async, std::move(read_record));
+#endif
+}
+
+inline void Parser::WaitForPrefetch() {
+    if (this->prefetch.valid()) {
+        // rethrows errors raised while reading
+        this->meteo_data_step[this->prefetch_step] = this->prefetch.get();
     }
 }
 
@@ -166,22 +345,28 @@ void Parser::InterpolateMeteoData(const StepperType& stepper) {
     double t_start = step_start * stepper.GetDT();
     double t_end   = step_end * stepper.GetDT();
 
-    double interp_factor = (stepper.GetTimeAtCurrentStage() - t_start) / (t_end - t_start);
+    const double interp_factor = (stepper.GetTimeAtCurrentStage() - t_start) / (t_end - t_start);
 
-    for (auto& it : this->node_meteo_data_interp) {
-        it.second[0] = this->node_meteo_data_step[step_start][it.first][0] +
-                       interp_factor * (this->node_meteo_data_step[step_end][it.first][0] -
-                                        this->node_meteo_data_step[step_start][it.first][0]);
+    const MeteoRecord& data_start = this->meteo_data_step.at(step_start);
+    const MeteoRecord& data_end   = this->meteo_data_step.at(step_end);
 
-        it.second[1] = this->node_meteo_data_step[step_start][it.first][1] +
-                       interp_factor * (this->node_meteo_data_step[step_end][it.first][1] -
-                                        this->node_meteo_data_step[step_start][it.first][1]);
+    const uint n_nodes = this->meteo_data_interp.size();
 
-        it.second[2] = this->node_meteo_data_step[step_start][it.first][2] +
-                       interp_factor * (this->node_meteo_data_step[step_end][it.first][2] -
-                                        this->node_meteo_data_step[step_start][it.first][2]);
+    for (uint node = 0; node < n_nodes; ++node) {
+        this->meteo_data_interp.tau_x[node] =
+            data_start.tau_x[node] + interp_factor * (data_end.tau_x[node] - data_start.tau_x[node]);
+    }
+
+    for (uint node = 0; node < n_nodes; ++node) {
+        this->meteo_data_interp.tau_y[node] =
+            data_start.tau_y[node] + interp_factor * (data_end.tau_y[node] - data_start.tau_y[node]);
+    }
+
+    for (uint node = 0; node < n_nodes; ++node) {
+        this->meteo_data_interp.p_atm[node] =
+            data_start.p_atm[node] + interp_factor * (data_end.p_atm[node] - data_start.p_atm[node]);
     }
 }
 }
 
-#endif
\ No newline at end of file
+#endif
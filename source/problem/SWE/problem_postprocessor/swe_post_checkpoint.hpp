@@ -0,0 +1,99 @@
+#ifndef SWE_POST_CHECKPOINT_HPP
+#define SWE_POST_CHECKPOINT_HPP
+
+#include <cstdint>
+
+namespace SWE {
+/**
+ * Write the element data required to restart the simulation.
+ * Per element: ID, number of degrees of freedom, modal coefficients of the solution (variable-major),
+ * and the wet/dry state. Everything else is either time independent and reconstructed by the
+ * preprocessor, or recomputed at every stage.
+ *
+ * @param mesh mesh of the submesh being checkpointed
+ * @param file binary output stream
+ */
+template <typename MeshType>
+void write_checkpoint_data(MeshType& mesh, std::ostream& file) {
+    const std::uint64_t n_elements = mesh.GetNumberElements();
+    file.write((const char*)&n_elements, sizeof(std::uint64_t));
+
+    mesh.CallForEachElement([&file](auto& elt) {
+        const std::uint64_t ID   = elt.GetID();
+        const std::uint32_t ndof = columns(elt.data.state[0].q);
+
+        file.write((const char*)&ID, sizeof(std::uint64_t));
+        file.write((const char*)&ndof, sizeof(std::uint32_t));
+
+        for (uint var = 0; var < SWE::n_variables; ++var) {
+            for (uint dof = 0; dof < ndof; ++dof) {
+                const double value = elt.data.state[0].q(var, dof);
+                file.write((const char*)&value, sizeof(double));
+            }
+        }
+
+        const std::uint8_t wet                 = elt.data.wet_dry_state.wet;
+        const std::uint8_t went_completely_dry = elt.data.wet_dry_state.went_completely_dry;
+
+        file.write((const char*)&wet, sizeof(std::uint8_t));
+        file.write((const char*)&went_completely_dry, sizeof(std::uint8_t));
+    });
+}
+
+/**
+ * Restore the element data written by write_checkpoint_data.
+ * The mesh must be the one the checkpoint was taken on, i.e. same elements and polynomial order.
+ *
+ * @param mesh mesh of the submesh being restarted, already preprocessed
+ * @param file binary input stream
+ */
+template <typename MeshType>
+void read_checkpoint_data(MeshType& mesh, std::istream& file) {
+    std::uint64_t n_elements;
+    file.read((char*)&n_elements, sizeof(std::uint64_t));
+
+    if (!file || n_elements != mesh.GetNumberElements()) {
+        throw std::logic_error("Fatal Error: checkpoint does not match the number of elements of mesh " +
+                               mesh.GetMeshName() + "\n");
+    }
+
+    // elements are written in the order they are traversed, which is the same on restart
+    mesh.CallForEachElement([&file](auto& elt) {
+        std::uint64_t ID;
+        std::uint32_t ndof;
+
+        file.read((char*)&ID, sizeof(std::uint64_t));
+        file.read((char*)&ndof, sizeof(std::uint32_t));
+
+        if (!file || ID != elt.GetID() || ndof != columns(elt.data.state[0].q)) {
+            throw std::logic_error("Fatal Error: checkpoint does not match element " + std::to_string(elt.GetID()) +
+                                   "\n");
+        }
+
+        for (uint var = 0; var < SWE::n_variables; ++var) {
+            for (uint dof = 0; dof < ndof; ++dof) {
+                double value;
+                file.read((char*)&value, sizeof(double));
+
+                elt.data.state[0].q(var, dof) = value;
+            }
+        }
+
+        std::uint8_t wet;
+        std::uint8_t went_completely_dry;
+
+        file.read((char*)&wet, sizeof(std::uint8_t));
+        file.read((char*)&went_completely_dry, sizeof(std::uint8_t));
+
+        if (!file) {
+            throw std::logic_error("Fatal Error: checkpoint is truncated at element " + std::to_string(elt.GetID()) +
+                                   "\n");
+        }
+
+        elt.data.wet_dry_state.wet                 = wet;
+        elt.data.wet_dry_state.went_completely_dry = went_completely_dry;
+    });
+}
+}
+
+#endif
@@ -0,0 +1,270 @@
+#ifndef SWE_POST_EXTREMA_HPP
+#define SWE_POST_EXTREMA_HPP
+
+#include <cstdint>
+#include "utilities/vtu_data_array.hpp"
+
+namespace SWE {
+// value written for extrema that were never reached, as in ADCIRC's maxele/maxvel files
+constexpr double undefined_extremum = -99999.0;
+
+/**
+ * Running extrema of the solution, accumulated while stepping instead of extracted from field output.
+ * Values are kept at the postprocessor points of the elements, i.e. at the points of the VTU output, in the order
+ * the elements are traversed. Water surface elevation and velocity extrema only account for wet elements, points
+ * that were never wet are written as -99999.
+ */
+struct Extrema {
+    std::vector<uint> element_IDs;
+
+    // per postprocessor point
+    std::vector<double> ze_max;
+    std::vector<double> ze_max_time;
+    std::vector<double> ze_min;
+    std::vector<double> velocity_max;
+    std::vector<double> velocity_max_time;
+
+    // per element, time the element spent wet
+    std::vector<double> wet_duration;
+
+    double last_update_time{0.0};
+
+#ifdef HAS_HPX
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned) {
+        // clang-format off
+        ar  & element_IDs
+            & ze_max
+            & ze_max_time
+            & ze_min
+            & velocity_max
+            & velocity_max_time
+            & wet_duration
+            & last_update_time;
+        // clang-format on
+    }
+#endif
+};
+
+/**
+ * Fold the current solution into the extrema.
+ * The wet duration of an element is increased by the time since the previous update if the element is wet now.
+ *
+ * @param stepper stepper of the submesh
+ * @param mesh mesh of the submesh
+ * @param extrema accumulated extrema, allocated on the first update
+ */
+template <typename StepperType, typename MeshType>
+void update_extrema(const StepperType& stepper, MeshType& mesh, Extrema& extrema) {
+    const double time = stepper.GetTimeAtCurrentStage();
+
+    const bool first_update = extrema.element_IDs.empty();
+    const double elapsed    = first_update ? 0.0 : time - extrema.last_update_time;
+
+    uint elt_index = 0;
+    uint pt_index  = 0;
+
+    mesh.CallForEachOwnedElement([&](auto& elt) {
+        const DynMatrix<double>& phi_point = elt.GetMaster().phi_postprocessor_point;
+
+        if (first_update) {
+            extrema.element_IDs.push_back(elt.GetID());
+            extrema.wet_duration.push_back(0.0);
+
+            for (uint pt = 0; pt < columns(phi_point); ++pt) {
+                extrema.ze_max.push_back(std::numeric_limits<double>::lowest());
+                extrema.ze_max_time.push_back(undefined_extremum);
+                extrema.ze_min.push_back(std::numeric_limits<double>::max());
+                extrema.velocity_max.push_back(std::numeric_limits<double>::lowest());
+                extrema.velocity_max_time.push_back(undefined_extremum);
+            }
+        }
+
+        if (!elt.data.wet_dry_state.wet) {
+            ++elt_index;
+            pt_index += columns(phi_point);
+
+            return;
+        }
+
+        extrema.wet_duration[elt_index++] += elapsed;
+
+        const auto& state = elt.data.state[0];
+
+        for (uint pt = 0; pt < columns(phi_point); ++pt, ++pt_index) {
+            const StatVector<double, SWE::n_variables> q = state.q * column(phi_point, pt);
+            const StatVector<double, 1> aux              = state.aux * column(phi_point, pt);
+
+            const double ze = q[SWE::Variables::ze];
+            const double h  = ze + aux[SWE::Auxiliaries::bath];
+
+            if (ze > extrema.ze_max[pt_index]) {
+                extrema.ze_max[pt_index]      = ze;
+                extrema.ze_max_time[pt_index] = time;
+            }
+
+            extrema.ze_min[pt_index] = std::min(extrema.ze_min[pt_index], ze);
+
+            // velocities in nearly dry points are dominated by the division by the water depth
+            if (h > PostProcessing::h_o) {
+                const double velocity = std::hypot(q[SWE::Variables::qx], q[SWE::Variables::qy]) / h;
+
+                if (velocity > extrema.velocity_max[pt_index]) {
+                    extrema.velocity_max[pt_index]      = velocity;
+                    extrema.velocity_max_time[pt_index] = time;
+                }
+            }
+        }
+    });
+
+    extrema.last_update_time = time;
+}
+
+/**
+ * Write the extrema as VTU point and cell data arrays, to be placed between the geometry of the VTU output.
+ *
+ * @param extrema accumulated extrema
+ * @param raw_data_file output stream
+ * @param format VTU data array format
+ */
+inline void write_extrema_VTU_data(const Extrema& extrema,
+                                   std::ofstream& raw_data_file,
+                                   const Utilities::VTUFormat format) {
+    const auto defined = [](const double value) {
+        return (value == std::numeric_limits<double>::lowest() || value == std::numeric_limits<double>::max())
+                   ? undefined_extremum
+                   : value;
+    };
+
+    std::vector<float> array_data(extrema.ze_max.size());
+
+    raw_data_file << "\t\t\t<PointData>\n";
+
+    for (uint pt = 0; pt < extrema.ze_max.size(); ++pt)
+        array_data[pt] = (float)defined(extrema.ze_max[pt]);
+    Utilities::write_VTU_data_array(raw_data_file, "ze_max", 1, array_data, format);
+
+    for (uint pt = 0; pt < extrema.ze_max.size(); ++pt)
+        array_data[pt] = (float)extrema.ze_max_time[pt];
+    Utilities::write_VTU_data_array(raw_data_file, "ze_max_time", 1, array_data, format);
+
+    for (uint pt = 0; pt < extrema.ze_max.size(); ++pt)
+        array_data[pt] = (float)defined(extrema.ze_min[pt]);
+    Utilities::write_VTU_data_array(raw_data_file, "ze_min", 1, array_data, format);
+
+    for (uint pt = 0; pt < extrema.ze_max.size(); ++pt)
+        array_data[pt] = (float)defined(extrema.velocity_max[pt]);
+    Utilities::write_VTU_data_array(raw_data_file, "velocity_max", 1, array_data, format);
+
+    for (uint pt = 0; pt < extrema.ze_max.size(); ++pt)
+        array_data[pt] = (float)extrema.velocity_max_time[pt];
+    Utilities::write_VTU_data_array(raw_data_file, "velocity_max_time", 1, array_data, format);
+
+    raw_data_file << "\t\t\t</PointData>\n";
+
+    std::vector<std::uint32_t> elt_id_data;
+    std::vector<float> wet_duration_data;
+
+    for (uint elt = 0; elt < extrema.element_IDs.size(); ++elt) {
+        for (uint cell = 0; cell < N_DIV * N_DIV; ++cell) {
+            elt_id_data.push_back(extrema.element_IDs[elt]);
+            wet_duration_data.push_back((float)extrema.wet_duration[elt]);
+        }
+    }
+
+    raw_data_file << "\t\t\t<CellData>\n";
+
+    Utilities::write_VTU_data_array(raw_data_file, "ID", 1, elt_id_data, format);
+    Utilities::write_VTU_data_array(raw_data_file, "wet_duration", 1, wet_duration_data, format);
+
+    raw_data_file << "\t\t\t</CellData>\n";
+}
+
+/**
+ * Write the accumulated extrema, so that a restarted simulation continues accumulating them.
+ *
+ * @param extrema accumulated extrema
+ * @param file binary output stream
+ */
+inline void write_extrema_checkpoint(const Extrema& extrema, std::ostream& file) {
+    const std::uint64_t n_elements = extrema.element_IDs.size();
+    const std::uint64_t n_points   = extrema.ze_max.size();
+
+    file.write((const char*)&n_elements, sizeof(std::uint64_t));
+    file.write((const char*)&n_points, sizeof(std::uint64_t));
+    file.write((const char*)&extrema.last_update_time, sizeof(double));
+
+    for (const uint ID : extrema.element_IDs) {
+        const std::uint64_t ID_out = ID;
+        file.write((const char*)&ID_out, sizeof(std::uint64_t));
+    }
+
+    file.write((const char*)extrema.wet_duration.data(), n_elements * sizeof(double));
+
+    for (const std::vector<double>* values : {&extrema.ze_max,
+                                              &extrema.ze_max_time,
+                                              &extrema.ze_min,
+                                              &extrema.velocity_max,
+                                              &extrema.velocity_max_time}) {
+        file.write((const char*)values->data(), n_points * sizeof(double));
+    }
+}
+
+/**
+ * Restore the extrema written by write_extrema_checkpoint.
+ *
+ * @param mesh mesh of the submesh being restarted, used to check that the extrema belong to it
+ * @param extrema accumulated extrema
+ * @param file binary input stream
+ */
+template <typename MeshType>
+void read_extrema_checkpoint(MeshType& mesh, Extrema& extrema, std::istream& file) {
+    std::uint64_t n_elements;
+    std::uint64_t n_points;
+
+    file.read((char*)&n_elements, sizeof(std::uint64_t));
+    file.read((char*)&n_points, sizeof(std::uint64_t));
+    file.read((char*)&extrema.last_update_time, sizeof(double));
+
+    if (!file || n_elements != mesh.GetNumberOwnedElements()) {
+        throw std::logic_error("Fatal Error: extrema checkpoint does not match the number of elements of mesh " +
+                               mesh.GetMeshName() + "\n");
+    }
+
+    extrema.element_IDs.resize(n_elements);
+
+    for (uint& ID : extrema.element_IDs) {
+        std::uint64_t ID_in;
+        file.read((char*)&ID_in, sizeof(std::uint64_t));
+
+        ID = (uint)ID_in;
+    }
+
+    // elements are written in the order they are traversed, which is the same on restart
+    uint elt_index = 0;
+    mesh.CallForEachOwnedElement([&extrema, &elt_index](auto& elt) {
+        if (extrema.element_IDs[elt_index++] != elt.GetID()) {
+            throw std::logic_error("Fatal Error: extrema checkpoint does not match element " +
+                                   std::to_string(elt.GetID()) + "\n");
+        }
+    });
+
+    extrema.wet_duration.resize(n_elements);
+    file.read((char*)extrema.wet_duration.data(), n_elements * sizeof(double));
+
+    for (std::vector<double>* values : {&extrema.ze_max,
+                                        &extrema.ze_max_time,
+                                        &extrema.ze_min,
+                                        &extrema.velocity_max,
+                                        &extrema.velocity_max_time}) {
+        values->resize(n_points);
+        file.read((char*)values->data(), n_points * sizeof(double));
+    }
+
+    if (!file) {
+        throw std::logic_error("Fatal Error: extrema checkpoint of mesh " + mesh.GetMeshName() + " is truncated\n");
+    }
+}
+}
+
+#endif
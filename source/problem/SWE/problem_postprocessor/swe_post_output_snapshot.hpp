@@ -0,0 +1,82 @@
+#ifndef SWE_POST_OUTPUT_SNAPSHOT_HPP
+#define SWE_POST_OUTPUT_SNAPSHOT_HPP
+
+namespace SWE {
+/**
+ * Copy of the element data required to write output.
+ * A snapshot is taken on the critical path and formatted and written in the background, while the
+ * simulation keeps advancing the element states.
+ */
+struct OutputSnapshot {
+    struct ElementData {
+        uint ID;
+
+        HybMatrix<double, SWE::n_variables> q;
+        HybMatrix<double, 1> aux;
+
+        bool wet;
+        bool went_completely_dry;
+
+        // postprocessor bases live in the master elements and are never modified after construction
+        const DynMatrix<double>* phi_postprocessor_cell;
+        const DynMatrix<double>* phi_postprocessor_point;
+    };
+
+    std::string mesh_name;
+    uint step;
+    double time;
+
+    std::vector<ElementData> elements;
+};
+
+template <typename StepperType, typename MeshType>
+void take_output_snapshot(const StepperType& stepper, MeshType& mesh, OutputSnapshot& snapshot) {
+    snapshot.mesh_name = mesh.GetMeshName();
+    snapshot.step      = stepper.GetStep();
+    snapshot.time      = stepper.GetTimeAtCurrentStage();
+
+    uint elt_index = 0;
+
+    // reuse the allocations of the previous snapshot taken into this buffer
+    mesh.CallForEachOwnedElement([&snapshot, &elt_index](auto& elt) {
+        if (elt_index == snapshot.elements.size()) {
+            snapshot.elements.emplace_back();
+        }
+
+        OutputSnapshot::ElementData& elt_data = snapshot.elements[elt_index++];
+
+        elt_data.ID = elt.GetID();
+
+        elt_data.q   = elt.data.state[0].q;
+        elt_data.aux = elt.data.state[0].aux;
+
+        elt_data.wet                 = elt.data.wet_dry_state.wet;
+        elt_data.went_completely_dry = elt.data.wet_dry_state.went_completely_dry;
+
+        elt_data.phi_postprocessor_cell  = &elt.GetMaster().phi_postprocessor_cell;
+        elt_data.phi_postprocessor_point = &elt.GetMaster().phi_postprocessor_point;
+    });
+
+    snapshot.elements.resize(elt_index);
+}
+
+inline void evaluate_output_snapshot(const OutputSnapshot& snapshot,
+                                     AlignedVector<StatVector<double, SWE::n_variables>>& q_point_data,
+                                     AlignedVector<StatVector<double, SWE::n_variables>>& q_cell_data,
+                                     AlignedVector<StatVector<double, 1>>& aux_point_data,
+                                     AlignedVector<StatVector<double, 1>>& aux_cell_data) {
+    for (const OutputSnapshot::ElementData& elt_data : snapshot.elements) {
+        for (uint pt = 0; pt < columns(*elt_data.phi_postprocessor_point); ++pt) {
+            q_point_data.emplace_back(elt_data.q * column(*elt_data.phi_postprocessor_point, pt));
+            aux_point_data.emplace_back(elt_data.aux * column(*elt_data.phi_postprocessor_point, pt));
+        }
+
+        for (uint cell = 0; cell < columns(*elt_data.phi_postprocessor_cell); ++cell) {
+            q_cell_data.emplace_back(elt_data.q * column(*elt_data.phi_postprocessor_cell, cell));
+            aux_cell_data.emplace_back(elt_data.aux * column(*elt_data.phi_postprocessor_cell, cell));
+        }
+    }
+}
+}
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef SWE_POST_WRITE_STATIONS_HPP
+#define SWE_POST_WRITE_STATIONS_HPP
+
+namespace SWE {
+/**
+ * Evaluate the solution at the survey points of the elements hosting stations.
+ * Per survey point the water surface elevation and the depth averaged velocities are appended to station_data, in
+ * the order of element_IDs and of the survey points set on each element. Velocities are zero in dry elements.
+ *
+ * @param mesh mesh of the submesh
+ * @param element_IDs IDs of the elements hosting stations
+ * @param station_data output values
+ */
+template <typename MeshType>
+void write_station_data(MeshType& mesh, const std::vector<uint>& element_IDs, std::vector<double>& station_data) {
+    AlignedVector<StatVector<double, SWE::n_variables>> q_sp;
+    AlignedVector<StatVector<double, 1>> aux_sp;
+
+    for (const uint element_ID : element_IDs) {
+        mesh.CallForElement(element_ID, [&q_sp, &aux_sp, &station_data](auto& elt) {
+            auto& state = elt.data.state[0];
+
+            q_sp.clear();
+            aux_sp.clear();
+
+            elt.WriteSurveyPointData(state.q, q_sp);
+            elt.WriteSurveyPointData(state.aux, aux_sp);
+
+            for (uint spt = 0; spt < q_sp.size(); ++spt) {
+                const double h = q_sp[spt][SWE::Variables::ze] + aux_sp[spt][SWE::Auxiliaries::bath];
+
+                station_data.push_back(q_sp[spt][SWE::Variables::ze]);
+
+                if (elt.data.wet_dry_state.wet) {
+                    station_data.push_back(q_sp[spt][SWE::Variables::qx] / h);
+                    station_data.push_back(q_sp[spt][SWE::Variables::qy] / h);
+                } else {
+                    station_data.push_back(0.0);
+                    station_data.push_back(0.0);
+                }
+            }
+        });
+    }
+}
+}
+
+#endif
@@ -2,31 +2,24 @@
 #define SWE_POST_WRITE_VTK_HPP
 
 namespace SWE {
-template <typename MeshType>
-void write_VTK_data(MeshType& mesh, std::ofstream& raw_data_file) {
+inline void write_VTK_data(const OutputSnapshot& snapshot, std::ofstream& raw_data_file) {
     AlignedVector<StatVector<double, SWE::n_variables>> q_point_data;
     AlignedVector<StatVector<double, SWE::n_variables>> q_cell_data;
 
     AlignedVector<StatVector<double, 1>> aux_point_data;
     AlignedVector<StatVector<double, 1>> aux_cell_data;
 
-    mesh.CallForEachElement([&q_point_data, &q_cell_data, &aux_point_data, &aux_cell_data](auto& elt) {
-        elt.WritePointDataVTK(elt.data.state[0].q, q_point_data);
-        elt.WriteCellDataVTK(elt.data.state[0].q, q_cell_data);
-
-        elt.WritePointDataVTK(elt.data.state[0].aux, aux_point_data);
-        elt.WriteCellDataVTK(elt.data.state[0].aux, aux_cell_data);
-    });
+    SWE::evaluate_output_snapshot(snapshot, q_point_data, q_cell_data, aux_point_data, aux_cell_data);
 
     std::vector<uint> elt_id_data;
     std::vector<std::array<bool, 2>> wd_data;
 
-    mesh.CallForEachElement([&elt_id_data, &wd_data](auto& elt) {
+    for (const OutputSnapshot::ElementData& elt_data : snapshot.elements) {
         for (uint cell = 0; cell < N_DIV * N_DIV; ++cell) {
-            elt_id_data.push_back(elt.GetID());
-            wd_data.push_back({elt.data.wet_dry_state.wet, elt.data.wet_dry_state.went_completely_dry});
+            elt_id_data.push_back(elt_data.ID);
+            wd_data.push_back({elt_data.wet, elt_data.went_completely_dry});
         }
-    });
+    }
 
     raw_data_file << "CELL_DATA " << q_cell_data.size() << std::endl;
 
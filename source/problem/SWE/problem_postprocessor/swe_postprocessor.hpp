@@ -3,9 +3,13 @@
 
 #include "swe_post_wet_dry.hpp"
 #include "swe_post_scrutinize.hpp"
+#include "swe_post_output_snapshot.hpp"
 #include "swe_post_write_vtk.hpp"
 #include "swe_post_write_vtu.hpp"
 #include "swe_post_write_modal.hpp"
+#include "swe_post_write_stations.hpp"
+#include "swe_post_extrema.hpp"
+#include "swe_post_checkpoint.hpp"
 #include "swe_post_comp_res_l2.hpp"
 
 #endif
\ No newline at end of file
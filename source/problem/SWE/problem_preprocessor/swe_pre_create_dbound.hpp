@@ -140,6 +140,38 @@ void create_distributed_boundaries(std::map<uchar, std::map<std::pair<uint, uint
                             << "Number of distributed levee boundaries: " << n_distr_levee << std::endl;
     }
 }
+
+template <typename ProblemType, typename Communicator>
+void create_ghost_layers(typename ProblemType::ProblemMeshType& mesh,
+                         Communicator& communicator,
+                         typename ProblemType::ProblemWriterType& writer,
+                         const uint comm_type) {
+    uint ndof = 0;
+    mesh.CallForEachElement([&ndof](auto& elt) { ndof = elt.data.get_ndof(); });
+
+    const uint ghost_size = SWE::n_variables * ndof + 1;  // + w/d state
+
+    uint n_ghosts = 0;
+
+    for (uint rank_boundary_id = 0; rank_boundary_id < communicator.GetRankBoundaryNumber(); ++rank_boundary_id) {
+        typename Communicator::RankBoundaryType& rank_boundary = communicator.GetRankBoundary(rank_boundary_id);
+
+        const RankGhostLayerMetaData& gl_data = rank_boundary.gl_data;
+
+        rank_boundary.send_buffer[comm_type].resize(ghost_size * gl_data.elements_send.size());
+        rank_boundary.receive_buffer[comm_type].resize(ghost_size * gl_data.elements_receive.size());
+
+        for (uint ghost_id : gl_data.elements_receive) {
+            mesh.SetGhostElement(ghost_id);
+        }
+
+        n_ghosts += gl_data.elements_receive.size();
+    }
+
+    if (writer.WritingLog()) {
+        writer.GetLogFile() << "Number of ghost elements: " << n_ghosts << std::endl;
+    }
+}
 }
 
 #endif
\ No newline at end of file
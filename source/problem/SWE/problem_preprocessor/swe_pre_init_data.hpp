@@ -3,6 +3,7 @@
 
 #include "utilities/file_exists.hpp"
 #include "problem/SWE/problem_function_files/swe_initial_condition_functions.hpp"
+#include "problem/SWE/problem_function_files/swe_source_functions.hpp"
 
 namespace SWE {
 template <typename MeshType, typename ProblemSpecificInputType>
@@ -62,6 +63,11 @@ void initialize_data_serial(MeshType& mesh, const ProblemSpecificInputType& prob
             const auto q_init = [](Point<2>& pt) { return SWE::ic_q(0, pt); };
             state.q           = elt.L2ProjectionF(q_init);
         }
+
+        if (problem_specific_input.function_source.type != SWE::FunctionSourceType::None) {
+            Utilities::tabulate_function<SWE::SourceFunction>(
+                elt.GetGPGlobalCoordinates(), SWE::n_variables, elt.data.source.function_source_at_gp);
+        }
     });
 
     mesh.CallForEachInterface([&problem_specific_input](auto& intface) {
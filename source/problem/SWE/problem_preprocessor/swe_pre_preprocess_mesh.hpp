@@ -23,6 +23,21 @@ void preprocess_mesh_data(InputType& input) {
                 R_o * (node.second.coordinates[GlobalCoord::x] - longitude_o) * PI / 180.0;
             node.second.coordinates[GlobalCoord::y] = R * node.second.coordinates[GlobalCoord::y] * PI / 180.0;
         }
+
+        if (input.mesh_input.binary_mesh_data) {
+            double* coordinates = input.mesh_input.binary_mesh_data->GetNodeCoordinates();
+
+            for (uint node = 0; node < input.mesh_input.binary_mesh_data->GetNumberNodes(); ++node) {
+                coordinates[3 * node + GlobalCoord::x] =
+                    R_o * (coordinates[3 * node + GlobalCoord::x] - longitude_o) * PI / 180.0;
+                coordinates[3 * node + GlobalCoord::y] = R * coordinates[3 * node + GlobalCoord::y] * PI / 180.0;
+            }
+        }
+
+        for (auto& station : input.writer_input.station_coordinates) {
+            station[GlobalCoord::x] = R_o * (station[GlobalCoord::x] - longitude_o) * PI / 180.0;
+            station[GlobalCoord::y] = R * station[GlobalCoord::y] * PI / 180.0;
+        }
     }
 }
 }
@@ -4,6 +4,7 @@
 // Implementation of Cockburn-Shu slope limiter
 #include "swe_CS_slope_limiter.hpp"
 #include "swe_trouble_check.hpp"
+#include "utilities/kernel_timers.hpp"
 
 namespace SWE {
 template <typename HPXSimUnitType>
@@ -12,7 +13,11 @@ auto CS_slope_limiter_hpx(HPXSimUnitType* sim_unit, uint comm_type) {
         sim_unit->writer.GetLogFile() << "Exchanging slope limiting data" << std::endl;
     }
 
+    START_KERNEL_PHASE(sim_unit->discretization.timers, comm_start);
     hpx::future<void> receive_future = sim_unit->communicator.ReceiveAll(comm_type, sim_unit->stepper.GetTimestamp());
+    STOP_KERNEL_PHASE(sim_unit->discretization.timers, comm_start);
+
+    START_KERNEL_PHASE(sim_unit->discretization.timers, slope_limiter);
 
     sim_unit->discretization.mesh.CallForEachElement(
         [sim_unit](auto& elt) { slope_limiting_prepare_element_kernel(sim_unit->stepper, elt); });
@@ -21,29 +26,46 @@ auto CS_slope_limiter_hpx(HPXSimUnitType* sim_unit, uint comm_type) {
         slope_limiting_distributed_boundary_send_kernel(sim_unit->stepper, dbound, comm_type);
     });
 
+    STOP_KERNEL_PHASE(sim_unit->discretization.timers, slope_limiter);
+
+    START_KERNEL_PHASE(sim_unit->discretization.timers, comm_start);
     sim_unit->communicator.SendAll(comm_type, sim_unit->stepper.GetTimestamp());
+    STOP_KERNEL_PHASE(sim_unit->discretization.timers, comm_start);
 
     if (sim_unit->writer.WritingVerboseLog()) {
         sim_unit->writer.GetLogFile() << "Starting slope limiting work before receive" << std::endl;
     }
 
+    START_KERNEL_PHASE(sim_unit->discretization.timers, slope_limiter);
+
     sim_unit->discretization.mesh.CallForEachInterface(
         [sim_unit](auto& intface) { slope_limiting_prepare_interface_kernel(sim_unit->stepper, intface); });
 
     sim_unit->discretization.mesh.CallForEachBoundary(
         [sim_unit](auto& bound) { slope_limiting_prepare_boundary_kernel(sim_unit->stepper, bound); });
 
+    STOP_KERNEL_PHASE(sim_unit->discretization.timers, slope_limiter);
+
     if (sim_unit->writer.WritingVerboseLog()) {
         sim_unit->writer.GetLogFile() << "Finished slope limiting work before receive" << std::endl
                                       << "Starting to wait on slope limiting receive with timestamp: "
                                       << sim_unit->stepper.GetTimestamp() << std::endl;
     }
 
+    // the wait lasts until the continuation runs
+    START_KERNEL_PHASE(sim_unit->discretization.timers, halo_wait);
+
+    receive_future = sim_unit->communicator.WaitAllReceives(comm_type, std::move(receive_future));
+
     return receive_future.then([sim_unit, comm_type](auto&&) {
+        STOP_KERNEL_PHASE(sim_unit->discretization.timers, halo_wait);
+
         if (sim_unit->writer.WritingVerboseLog()) {
             sim_unit->writer.GetLogFile() << "Starting slope limiting work after receive" << std::endl;
         }
 
+        START_KERNEL_PHASE(sim_unit->discretization.timers, slope_limiter);
+
         sim_unit->discretization.mesh.CallForEachDistributedBoundary([sim_unit, comm_type](auto& dbound) {
             slope_limiting_prepare_distributed_boundary_kernel(sim_unit->stepper, dbound, comm_type);
         });
@@ -53,6 +75,8 @@ auto CS_slope_limiter_hpx(HPXSimUnitType* sim_unit, uint comm_type) {
         sim_unit->discretization.mesh.CallForEachElement(
             [sim_unit](auto& elt) { slope_limiting_kernel(sim_unit->stepper, elt); });
 
+        STOP_KERNEL_PHASE(sim_unit->discretization.timers, slope_limiter);
+
         if (sim_unit->writer.WritingVerboseLog()) {
             sim_unit->writer.GetLogFile() << "Finished slope limiting work after receive" << std::endl << std::endl;
         }
@@ -4,8 +4,12 @@
 // Implementation of Cockburn-Shu slope limiter
 #include "swe_CS_slope_limiter.hpp"
 #include "swe_trouble_check.hpp"
+#include "utilities/kernel_timers.hpp"
 
 namespace SWE {
+// The receives for comm_type have to be posted by the caller, e.g. at the beginning of the stage together with
+// the boundary state receives, and the sends have to be waited on by the caller at the end of the stage.
+// The barycentric states then arrive in posted buffers; the limiter still waits for them as a separate exchange.
 template <typename StepperType, typename OMPISimUnitType>
 void CS_slope_limiter_ompi(StepperType& stepper,
                            std::vector<std::unique_ptr<OMPISimUnitType>>& sim_units,
@@ -17,7 +21,7 @@ void CS_slope_limiter_ompi(StepperType& stepper,
             sim_units[su_id]->writer.GetLogFile() << "Exchanging slope limiting data" << std::endl;
         }
 
-        sim_units[su_id]->communicator.ReceiveAll(comm_type, stepper.GetTimestamp());
+        START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, slope_limiter);
 
         sim_units[su_id]->discretization.mesh.CallForEachElement(
             [&stepper](auto& elt) { slope_limiting_prepare_element_kernel(stepper, elt); });
@@ -26,7 +30,11 @@ void CS_slope_limiter_ompi(StepperType& stepper,
             slope_limiting_distributed_boundary_send_kernel(stepper, dbound, comm_type);
         });
 
+        STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, slope_limiter);
+
+        START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, comm_start);
         sim_units[su_id]->communicator.SendAll(comm_type, stepper.GetTimestamp());
+        STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, comm_start);
     }
 
     for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
@@ -34,12 +42,16 @@ void CS_slope_limiter_ompi(StepperType& stepper,
             sim_units[su_id]->writer.GetLogFile() << "Starting slope limiting work before receive" << std::endl;
         }
 
+        START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, slope_limiter);
+
         sim_units[su_id]->discretization.mesh.CallForEachInterface(
             [&stepper](auto& intface) { slope_limiting_prepare_interface_kernel(stepper, intface); });
 
         sim_units[su_id]->discretization.mesh.CallForEachBoundary(
             [&stepper](auto& bound) { slope_limiting_prepare_boundary_kernel(stepper, bound); });
 
+        STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, slope_limiter);
+
         if (sim_units[su_id]->writer.WritingVerboseLog()) {
             sim_units[su_id]->writer.GetLogFile() << "Finished slope limiting work before receive" << std::endl;
         }
@@ -51,12 +63,16 @@ void CS_slope_limiter_ompi(StepperType& stepper,
                 << "Starting to wait on slope limiting receive with timestamp: " << stepper.GetTimestamp() << std::endl;
         }
 
+        START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, halo_wait);
         sim_units[su_id]->communicator.WaitAllReceives(comm_type, stepper.GetTimestamp());
+        STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, halo_wait);
 
         if (sim_units[su_id]->writer.WritingVerboseLog()) {
             sim_units[su_id]->writer.GetLogFile() << "Starting slope limiting work after receive" << std::endl;
         }
 
+        START_KERNEL_PHASE(sim_units[su_id]->discretization.timers, slope_limiter);
+
         sim_units[su_id]->discretization.mesh.CallForEachDistributedBoundary([&stepper, comm_type](auto& dbound) {
             slope_limiting_prepare_distributed_boundary_kernel(stepper, dbound, comm_type);
         });
@@ -66,15 +82,13 @@ void CS_slope_limiter_ompi(StepperType& stepper,
         sim_units[su_id]->discretization.mesh.CallForEachElement(
             [&stepper](auto& elt) { slope_limiting_kernel(stepper, elt); });
 
+        STOP_KERNEL_PHASE(sim_units[su_id]->discretization.timers, slope_limiter);
+
         if (sim_units[su_id]->writer.WritingVerboseLog()) {
             sim_units[su_id]->writer.GetLogFile() << "Finished slope limiting work after receive" << std::endl
                                                   << std::endl;
         }
     }
-
-    for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
-        sim_units[su_id]->communicator.WaitAllSends(comm_type, stepper.GetTimestamp());
-    }
 }
 }
 
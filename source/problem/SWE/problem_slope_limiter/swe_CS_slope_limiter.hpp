@@ -54,9 +54,9 @@ void slope_limiting_distributed_boundary_send_kernel(const StepperType& stepper,
     auto& wd_state = dbound.data.wet_dry_state;
     auto& sl_state = dbound.data.slope_limit_state;
 
-    const uint ngp = dbound.data.get_ngp_boundary(dbound.bound_id);
-    std::vector<double> message(1 + SWE::n_variables + ngp);
-    message[0] = (double)wd_state.wet;
+    const uint ngp  = dbound.data.get_ngp_boundary(dbound.bound_id);
+    double* message = dbound.boundary_condition.exchanger.GetSendBufferPointer(comm_type);
+    message[0]      = (double)wd_state.wet;
     if (wd_state.wet) {
         boundary.q_at_gp = dbound.ComputeUgp(state.q);
         row(boundary.aux_at_gp, SWE::Auxiliaries::h) =
@@ -67,8 +67,9 @@ void slope_limiting_distributed_boundary_send_kernel(const StepperType& stepper,
         for (uint gp = 0; gp < ngp; ++gp) {
             message[1 + SWE::n_variables + gp] = boundary.aux_at_gp(SWE::Auxiliaries::h, gp);
         }
+    } else {
+        std::fill(message + 1, message + 1 + SWE::n_variables + ngp, 0.0);
     }
-    dbound.boundary_condition.exchanger.SetToSendBuffer(comm_type, message);
 }
 
 template <typename StepperType, typename DistributedBoundaryType>
@@ -77,8 +78,7 @@ void slope_limiting_prepare_distributed_boundary_kernel(const StepperType& stepp
                                                         uint comm_type) {
     auto& sl_state = dbound.data.slope_limit_state;
 
-    std::vector<double> message(1 + SWE::n_variables);
-    dbound.boundary_condition.exchanger.GetFromReceiveBuffer(comm_type, message);
+    const double* message = dbound.boundary_condition.exchanger.GetReceiveBufferPointer(comm_type);
     sl_state.wet_neigh[dbound.bound_id] = (bool)message[0];
     for (uint var = 0; var < SWE::n_variables; ++var) {
         sl_state.q_at_baryctr_neigh[dbound.bound_id][var] = message[1 + var];
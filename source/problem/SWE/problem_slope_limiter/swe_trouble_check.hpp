@@ -72,8 +72,7 @@ void check_trouble(DiscretizationType& discretization, const StepperType& steppe
             if (dbound.Integration(qn) < 0.0) {
                 const uint ngp                       = dbound.data.get_ngp_boundary(dbound.bound_id);
                 sl_state.hdif_at_gp[dbound.bound_id] = row(boundary.aux_at_gp, SWE::Auxiliaries::h);
-                std::vector<double> message(1 + SWE::n_variables + ngp);
-                dbound.boundary_condition.exchanger.GetFromReceiveBuffer(comm_type, message);
+                const double* message = dbound.boundary_condition.exchanger.GetReceiveBufferPointer(comm_type);
                 for (uint gp = 0; gp < ngp; ++gp) {
                     const uint gp_ex = ngp - gp - 1;
                     sl_state.hdif_at_gp[dbound.bound_id][gp] -= message[1 + SWE::n_variables + gp_ex];
@@ -10,22 +10,21 @@ void get_source(const double t, ElementType& elt) {
     auto& internal = elt.data.internal;
     auto& source   = elt.data.source;
 
+    if (SWE::SourceTerms::function_source) {
+        Utilities::evaluate_function<SWE::SourceFunction>(
+            t, elt.GetGPGlobalCoordinates(), source.function_source_at_gp, internal.source_at_gp);
+    } else {
+        set_constant(internal.source_at_gp, 0.0);
+    }
+
     // note we assume that the values at gauss points have already been computed
     // compute contribution of hydrostatic pressure
-    set_constant(row(internal.source_at_gp, SWE::Variables::ze), 0.0);
-
-    row(internal.source_at_gp, SWE::Variables::qx) =
+    row(internal.source_at_gp, SWE::Variables::qx) +=
         Global::g * vec_cw_mult(row(internal.db_at_gp, GlobalCoord::x), row(internal.q_at_gp, SWE::Variables::ze));
 
-    row(internal.source_at_gp, SWE::Variables::qy) =
+    row(internal.source_at_gp, SWE::Variables::qy) +=
         Global::g * vec_cw_mult(row(internal.db_at_gp, GlobalCoord::y), row(internal.q_at_gp, SWE::Variables::ze));
 
-    if (SWE::SourceTerms::function_source) {
-        auto source_q = [t](Point<2>& pt) { return SWE::source_q(t, pt); };
-
-        internal.source_at_gp += elt.ComputeFgp(source_q);
-    }
-
     if (SWE::SourceTerms::bottom_friction) {
         double Cf = SWE::SourceTerms::Cf;
 
@@ -69,8 +69,8 @@ enum BoundaryTypes : uchar {
 };
 
 namespace RKDG {
-constexpr uint n_communications = 3;
-enum CommTypes : uchar { baryctr_coord = 0, bound_state = 1, baryctr_state = 2 };
+constexpr uint n_communications = 4;
+enum CommTypes : uchar { baryctr_coord = 0, bound_state = 1, baryctr_state = 2, ghost_state = 3 };
 }
 
 namespace EHDG {
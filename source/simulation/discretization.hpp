@@ -4,11 +4,14 @@
 #include "general_definitions.hpp"
 #include "preprocessor/initialize_mesh.hpp"
 #include "preprocessor/initialize_mesh_skeleton.hpp"
+#include "utilities/kernel_timers.hpp"
 
 template <typename ProblemType>
 struct DGDiscretization {
     typename ProblemType::ProblemMeshType mesh;
 
+    Utilities::KernelTimers timers;
+
     void initialize(InputParameters<typename ProblemType::ProblemInputType>& input,
                     typename ProblemType::ProblemWriterType& writer) {
         std::tuple<> empty_comm;
@@ -26,7 +29,10 @@ struct DGDiscretization {
 #ifdef HAS_HPX
     template <typename Archive>
     void serialize(Archive& ar, unsigned) {
-        ar& mesh;
+        // clang-format off
+        ar  & mesh
+            & timers;
+        // clang-format on
     }
 #endif
 };
@@ -36,6 +42,8 @@ struct HDGDiscretization {
     typename ProblemType::ProblemMeshType mesh;
     typename ProblemType::ProblemMeshSkeletonType mesh_skeleton;
 
+    Utilities::KernelTimers timers;
+
     void initialize(InputParameters<typename ProblemType::ProblemInputType>& input,
                     typename ProblemType::ProblemWriterType& writer) {
         std::tuple<> empty_comm;
@@ -33,6 +33,8 @@ struct HPXSimulationUnit : public HPXSimulationUnitBase,
 
     typename ProblemType::ProblemInputType problem_input;
 
+    RestartInput restart_input;
+
     //    std::unique_ptr<LoadBalancer::SubmeshModel> submesh_model = nullptr;
 
     HPXSimulationUnit() = default;
@@ -47,8 +49,16 @@ struct HPXSimulationUnit : public HPXSimulationUnitBase,
 
     hpx::future<void> Step() override;
 
+    void WaitForOutput() override { this->writer.WaitForOutput(); }
+
     double ResidualL2() override;
 
+    Utilities::KernelTimers GetKernelTimers() override { return this->discretization.timers; }
+
+    std::vector<Utilities::CommCountersRecord> GetCommCounters() override {
+        return this->communicator.GetCommCounters();
+    }
+
     /*    template <typename Archive>
         void save(Archive& ar, unsigned) const;
 
@@ -66,6 +76,14 @@ HPXSimulationUnit<ProblemType>::HPXSimulationUnit(const std::string& input_strin
                                                   const uint submesh_id) {
     InputParameters<typename ProblemType::ProblemInputType> input(input_string, locality_id, submesh_id);
 
+    if (input.writer_input.modal_shared_file) {
+        throw std::logic_error("Fatal Error: shared file modal output is only supported by the OMPI simulation\n");
+    }
+
+    if (input.communicator_input.ghost_layers) {
+        throw std::logic_error("Fatal Error: ghost layers are only supported by the OMPI simulation\n");
+    }
+
     ProblemType::initialize_problem_parameters(input.problem_input);
 
     input.read_mesh();                         // read mesh meta data
@@ -81,6 +99,7 @@ HPXSimulationUnit<ProblemType>::HPXSimulationUnit(const std::string& input_strin
     this->parser              = typename ProblemType::ProblemParserType(input, locality_id, submesh_id);
 
     this->problem_input = input.problem_input;
+    this->restart_input = input.restart_input;
 
     /*    this->submesh_model = nullptr; LoadBalancer::AbstractFactory::create_submesh_model<ProblemType>(
                                          locality_id, submesh_id, input.load_balancer_input);*/
@@ -94,6 +113,7 @@ HPXSimulationUnit<ProblemType>::HPXSimulationUnit(const std::string& input_strin
     }
 
     this->discretization.initialize(input, this->communicator, this->writer);
+    this->discretization.timers.SetSubmeshID(submesh_id);
 }
 
 template <typename ProblemType>
@@ -103,6 +123,11 @@ hpx::future<void> HPXSimulationUnit<ProblemType>::Preprocessor() {
 
 template <typename ProblemType>
 void HPXSimulationUnit<ProblemType>::Launch() {
+    // the checkpointed state replaces the initial conditions set by the preprocessor
+    if (this->restart_input.restarting) {
+        this->writer.ReadCheckpoint(this->restart_input, this->stepper, this->discretization.mesh);
+    }
+
     if (this->writer.WritingLog()) {
         this->writer.GetLogFile() << std::endl << "Launching Simulation!" << std::endl << std::endl;
     }
@@ -120,7 +145,9 @@ hpx::future<void> HPXSimulationUnit<ProblemType>::Step() {
         step_future = step_future.then([this](auto&& f) {
             f.get();
             if (this->parser.ParsingInput()) {
+                START_KERNEL_PHASE(this->discretization.timers, parse);
                 this->parser.ParseInput(this->stepper, this->discretization.mesh);
+                STOP_KERNEL_PHASE(this->discretization.timers, parse);
             }
             return ProblemType::stage_hpx(this);
         });
@@ -133,7 +160,9 @@ hpx::future<void> HPXSimulationUnit<ProblemType>::Step() {
                     }*/
 
         if (this->writer.WritingOutput()) {
+            START_KERNEL_PHASE(this->discretization.timers, output);
             this->writer.WriteOutput(this->stepper, this->discretization.mesh);
+            STOP_KERNEL_PHASE(this->discretization.timers, output);
         }
     });
 }
@@ -205,7 +234,14 @@ struct HPXEmptySimUnit : HPXSimulationUnitBase, hpx::components::managed_compone
     void Launch() override {}
 
     hpx::future<void> Step() override { return hpx::make_ready_future(); }
+    void WaitForOutput() override {}
     double ResidualL2() override { return 0.; }
+
+    Utilities::KernelTimers GetKernelTimers() override { return Utilities::KernelTimers(); }
+
+    std::vector<Utilities::CommCountersRecord> GetCommCounters() override {
+        return std::vector<Utilities::CommCountersRecord>();
+    }
 };
 
 using RKDG_SWE_SimUnit = std::conditional<Utilities::is_defined<SWE::RKDG::Problem>::value,
@@ -3,6 +3,8 @@
 
 #include "general_definitions.hpp"
 #include "utilities/is_defined.hpp"
+#include "utilities/comm_counters.hpp"
+#include "utilities/kernel_timers.hpp"
 
 #include <hpx/include/components.hpp>
 
@@ -23,9 +25,21 @@ struct HPXSimulationUnitBase
     hpx::future<void> Step_() { return Step(); }
     HPX_DEFINE_COMPONENT_ACTION(HPXSimulationUnitBase, Step_, StepAction);
 
+    virtual void WaitForOutput() = 0;
+    void WaitForOutput_() { WaitForOutput(); }
+    HPX_DEFINE_COMPONENT_ACTION(HPXSimulationUnitBase, WaitForOutput_, WaitForOutputAction);
+
     virtual double ResidualL2() = 0;
     double ResidualL2_() { return ResidualL2(); }
     HPX_DEFINE_COMPONENT_ACTION(HPXSimulationUnitBase, ResidualL2_, ResidualL2Action);
+
+    virtual Utilities::KernelTimers GetKernelTimers() = 0;
+    Utilities::KernelTimers GetKernelTimers_() { return GetKernelTimers(); }
+    HPX_DEFINE_COMPONENT_ACTION(HPXSimulationUnitBase, GetKernelTimers_, GetKernelTimersAction);
+
+    virtual std::vector<Utilities::CommCountersRecord> GetCommCounters() = 0;
+    std::vector<Utilities::CommCountersRecord> GetCommCounters_() { return GetCommCounters(); }
+    HPX_DEFINE_COMPONENT_ACTION(HPXSimulationUnitBase, GetCommCounters_, GetCommCountersAction);
 };
 
 class HPXSimulationUnitClient : public hpx::components::client_base<HPXSimulationUnitClient, HPXSimulationUnitBase> {
@@ -54,10 +68,25 @@ class HPXSimulationUnitClient : public hpx::components::client_base<HPXSimulatio
         return hpx::async<ActionType>(this->get_id());
     }
 
+    hpx::future<void> WaitForOutput() {
+        using ActionType = typename HPXSimulationUnitBase::WaitForOutputAction;
+        return hpx::async<ActionType>(this->get_id());
+    }
+
     hpx::future<double> ResidualL2() {
         using ActionType = typename HPXSimulationUnitBase::ResidualL2Action;
         return hpx::async<ActionType>(this->get_id());
     }
+
+    hpx::future<Utilities::KernelTimers> GetKernelTimers() {
+        using ActionType = typename HPXSimulationUnitBase::GetKernelTimersAction;
+        return hpx::async<ActionType>(this->get_id());
+    }
+
+    hpx::future<std::vector<Utilities::CommCountersRecord>> GetCommCounters() {
+        using ActionType = typename HPXSimulationUnitBase::GetCommCountersAction;
+        return hpx::async<ActionType>(this->get_id());
+    }
 };
 
 template <typename ProblemType>
@@ -45,16 +45,35 @@ class HPXSimulation : public hpx::components::component_base<HPXSimulation> {
 
     hpx::future<double> ResidualL2();
     HPX_DEFINE_COMPONENT_ACTION(HPXSimulation, ResidualL2, ResidualL2Action);
+
+    hpx::future<std::vector<Utilities::KernelTimersRecord>> GetKernelTimers();
+    HPX_DEFINE_COMPONENT_ACTION(HPXSimulation, GetKernelTimers, GetKernelTimersAction);
+
+    hpx::future<std::vector<Utilities::CommCountersRecord>> GetCommCounters();
+    HPX_DEFINE_COMPONENT_ACTION(HPXSimulation, GetCommCounters, GetCommCountersAction);
+
+    void WriteEventTrace(const std::string& output_path);
+    HPX_DEFINE_COMPONENT_ACTION(HPXSimulation, WriteEventTrace, WriteEventTraceAction);
 };
 
 HPXSimulation::HPXSimulation(const std::string& input_string) {
     const uint locality_id          = hpx::get_locality_id();
     const hpx::naming::id_type here = hpx::find_here();
 
+#ifdef HAS_EVENT_TRACER
+    // simulations of all localities are created at once, which roughly aligns the time axes of their traces
+    Utilities::EventTracer::Get().SetEpoch(Utilities::EventTracer::clock_t::now());
+#endif
+
     InputParameters<> input(input_string);
 
     this->n_steps = (uint)std::ceil(input.stepper_input.run_time / input.stepper_input.dt);
 
+    // a restarted simulation only runs the steps left after the checkpoint
+    if (input.restart_input.restarting) {
+        this->n_steps -= std::min(input.restart_input.step, this->n_steps);
+    }
+
     hpx::future<void> lb_future = hpx::make_ready_future();
     //        LoadBalancer::AbstractFactory::initialize_locality_and_world_models<ProblemType>(locality_id,
     //        input_string);
@@ -104,15 +123,78 @@ hpx::future<void> HPXSimulation::Run() {
         }
     }
 
-    return hpx::when_all(simulation_futures); /*.then([](auto&&) {
-        LoadBalancer::AbstractFactory::reset_locality_and_world_models<ProblemType>();
-        });*/
+    // errors of the last asynchronous output are only raised when waiting for it
+    for (uint sim_id = 0; sim_id < this->simulation_unit_clients.size(); ++sim_id) {
+        simulation_futures[sim_id] = simulation_futures[sim_id].then([this, sim_id](auto&& f) {
+            f.get();  // check for exceptions
+            return this->simulation_unit_clients[sim_id].WaitForOutput();
+        });
+    }
+
+    return hpx::when_all(simulation_futures).then([](auto&& futures) {
+        for (auto& simulation_future : futures.get()) {
+            simulation_future.get();  // check for exceptions
+        }
+        /*LoadBalancer::AbstractFactory::reset_locality_and_world_models<ProblemType>();*/
+    });
 }
 
 hpx::future<double> HPXSimulation::ResidualL2() {
     return ComputeL2Residual(this->simulation_unit_clients);
 }
 
+hpx::future<std::vector<Utilities::KernelTimersRecord>> HPXSimulation::GetKernelTimers() {
+    std::vector<hpx::future<Utilities::KernelTimers>> timers_futures;
+
+    for (auto& sim_unit_client : this->simulation_unit_clients) {
+        timers_futures.push_back(sim_unit_client.GetKernelTimers());
+    }
+
+    const uint locality_id = hpx::get_locality_id();
+
+    return hpx::when_all(timers_futures).then([locality_id](auto&& timers_futures) {
+        std::vector<Utilities::KernelTimers> timers = hpx::util::unwrap(timers_futures.get());
+
+        // submeshes are created in order of their IDs
+        std::vector<Utilities::KernelTimersRecord> records;
+
+        for (uint submesh_id = 0; submesh_id < timers.size(); ++submesh_id) {
+            records.push_back(Utilities::KernelTimersRecord{locality_id, submesh_id, timers[submesh_id]});
+        }
+
+        return records;
+    });
+}
+
+hpx::future<std::vector<Utilities::CommCountersRecord>> HPXSimulation::GetCommCounters() {
+    std::vector<hpx::future<std::vector<Utilities::CommCountersRecord>>> counters_futures;
+
+    for (auto& sim_unit_client : this->simulation_unit_clients) {
+        counters_futures.push_back(sim_unit_client.GetCommCounters());
+    }
+
+    return hpx::when_all(counters_futures).then([](auto&& counters_futures) {
+        std::vector<Utilities::CommCountersRecord> records;
+
+        for (auto& counters_future : counters_futures.get()) {
+            std::vector<Utilities::CommCountersRecord> sim_unit_records = counters_future.get();
+
+            records.insert(records.end(), sim_unit_records.begin(), sim_unit_records.end());
+        }
+
+        return records;
+    });
+}
+
+void HPXSimulation::WriteEventTrace(const std::string& output_path) {
+#ifdef HAS_EVENT_TRACER
+    const uint locality_id = hpx::get_locality_id();
+
+    Utilities::EventTracer::Get().WriteChromeTrace(
+        output_path + "trace_" + std::to_string(locality_id) + ".json", locality_id);
+#endif
+}
+
 class HPXSimulationClient : hpx::components::client_base<HPXSimulationClient, HPXSimulation> {
   private:
     using BaseType = hpx::components::client_base<HPXSimulationClient, HPXSimulation>;
@@ -130,6 +212,21 @@ class HPXSimulationClient : hpx::components::client_base<HPXSimulationClient, HP
         using ActionType = typename HPXSimulation::ResidualL2Action;
         return hpx::async<ActionType>(this->get_id());
     }
+
+    hpx::future<std::vector<Utilities::KernelTimersRecord>> GetKernelTimers() {
+        using ActionType = typename HPXSimulation::GetKernelTimersAction;
+        return hpx::async<ActionType>(this->get_id());
+    }
+
+    hpx::future<std::vector<Utilities::CommCountersRecord>> GetCommCounters() {
+        using ActionType = typename HPXSimulation::GetCommCountersAction;
+        return hpx::async<ActionType>(this->get_id());
+    }
+
+    hpx::future<void> WriteEventTrace(const std::string& output_path) {
+        using ActionType = typename HPXSimulation::WriteEventTraceAction;
+        return hpx::async<ActionType>(this->get_id(), output_path);
+    }
 };
 
 using hpx_simulation_swe_component_ = hpx::components::simple_component<HPXSimulation>;
@@ -0,0 +1,446 @@
+#ifndef SHARED_FILE_WRITER_OMPI_HPP
+#define SHARED_FILE_WRITER_OMPI_HPP
+
+#include <mpi.h>
+#include <future>
+#include <sys/stat.h>
+
+#include "general_definitions.hpp"
+#include "preprocessor/input_parameters.hpp"
+
+/**
+ * Writes the modal data of all submeshes of all ranks collectively into a single binary file per output step
+ * using MPI-IO, instead of one set of files per submesh.
+ *
+ * Optionally the last io_ranks ranks of MPI_COMM_WORLD are reserved for I/O. They are not assigned submeshes;
+ * instead compute ranks forward their packed data to them with non-blocking sends and carry on stepping,
+ * while the I/O ranks order the elements they receive by ID and write the file.
+ *
+ * File layout (native byte order):
+ *   header: char[8] "DGSWEMV2", uint64 number of elements, uint64 step, double time
+ *   index:  one entry per element, see IndexEntry, ordered by writing rank
+ *   data:   for every element the q coefficients (n_variables x ndof) followed by the aux coefficients
+ *           (n_auxiliaries x ndof), both row major, located through the offset in the index entry
+ */
+template <typename ProblemType>
+class OMPISharedFileWriter {
+  public:
+    struct Header {
+        char magic[8];
+        std::uint64_t n_elements;
+        std::uint64_t step;
+        double time;
+    };
+
+    struct IndexEntry {
+        std::uint64_t ID;
+        std::uint64_t offset;  // in bytes from the beginning of the file
+        std::uint32_t n_variables;
+        std::uint32_t n_auxiliaries;
+        std::uint32_t ndof;
+        std::uint32_t padding;
+    };
+
+  private:
+    using SnapshotsType = std::vector<typename ProblemType::ProblemOutputSnapshotType>;
+
+    // packed output of a compute rank in flight to its I/O rank
+    struct ForwardBuffer {
+        Header header;
+        std::vector<IndexEntry> index;
+        std::vector<double> data;
+
+        std::array<MPI_Request, 3> requests{{MPI_REQUEST_NULL, MPI_REQUEST_NULL, MPI_REQUEST_NULL}};
+    };
+
+    bool writing_output = false;
+    uint output_frequency;
+    std::string file_name_prefix;
+
+    uint n_io_ranks = 0;
+    uint n_compute_ranks;
+    bool io_rank = false;
+
+    // communicator of the ranks writing the shared file, i.e. all ranks or the I/O ranks
+    // collectives issued from the background task must not interleave with the ones of the simulation
+    MPI_Comm comm = MPI_COMM_NULL;
+    // communicator compute ranks forward their output to the I/O ranks on
+    MPI_Comm forward_comm = MPI_COMM_NULL;
+
+    std::array<std::shared_ptr<SnapshotsType>, 2> output_snapshots;
+    std::array<ForwardBuffer, 2> forward_buffers;
+    uint current_snapshot = 0;
+    std::future<void> pending_output;
+
+    // the collective write only runs on a background thread if MPI allows calls from several threads at once,
+    // otherwise the master thread writes the file synchronously
+    bool background_write = false;
+
+  public:
+    OMPISharedFileWriter() = default;
+    OMPISharedFileWriter(const WriterInput& writer_input, const std::string& mesh_file_name);
+
+    OMPISharedFileWriter(OMPISharedFileWriter&& rhs) = default;
+
+    ~OMPISharedFileWriter();
+
+    OMPISharedFileWriter& operator=(OMPISharedFileWriter&& rhs) = default;
+
+    bool IsIORank() { return this->io_rank; }
+
+    bool WritingOutput(const typename ProblemType::ProblemStepperType& stepper) {
+        return this->writing_output && (stepper.GetStep() % this->output_frequency == 0);
+    }
+
+    template <typename SimUnitType>
+    void WriteOutput(const typename ProblemType::ProblemStepperType& stepper,
+                     std::vector<std::unique_ptr<SimUnitType>>& sim_units);
+    void WaitForOutput();
+    void ServeOutput(const uint begin_step, const uint n_steps);
+    void Finalize();
+
+  private:
+    static void PackSnapshots(const SnapshotsType& snapshots,
+                              std::vector<IndexEntry>& index,
+                              std::vector<double>& data);
+    static void WriteFile(std::vector<IndexEntry>& index,
+                          const std::vector<double>& data,
+                          const uint step,
+                          const double time,
+                          const std::string& file_name,
+                          MPI_Comm comm);
+};
+
+template <typename ProblemType>
+OMPISharedFileWriter<ProblemType>::OMPISharedFileWriter(const WriterInput& writer_input,
+                                                        const std::string& mesh_file_name)
+    : writing_output(writer_input.writing_output && writer_input.writing_modal_output &&
+                     writer_input.modal_shared_file),
+      output_frequency(writer_input.modal_output_freq_step) {
+    std::string mesh_name = mesh_file_name.substr(mesh_file_name.find_last_of('/') + 1);
+    mesh_name             = mesh_name.substr(0, mesh_name.find_last_of('.'));
+
+    this->file_name_prefix = writer_input.output_path + mesh_name + "_modal_";
+
+    if (!this->writing_output) {
+        return;
+    }
+
+    mkdir(writer_input.output_path.c_str(), ACCESSPERMS);
+
+    int locality_id, n_localities;
+    MPI_Comm_rank(MPI_COMM_WORLD, &locality_id);
+    MPI_Comm_size(MPI_COMM_WORLD, &n_localities);
+
+    if (writer_input.modal_io_ranks >= (uint)n_localities) {
+        throw std::logic_error("Fatal Error: no MPI ranks are left for computation after reserving I/O ranks\n");
+    }
+
+    int thread_level;
+    MPI_Query_thread(&thread_level);
+
+    this->background_write = (thread_level == MPI_THREAD_MULTIPLE);
+
+    this->n_io_ranks      = writer_input.modal_io_ranks;
+    this->n_compute_ranks = (uint)n_localities - this->n_io_ranks;
+    this->io_rank         = ((uint)locality_id >= this->n_compute_ranks);
+
+    if (this->n_io_ranks == 0) {
+        MPI_Comm_dup(MPI_COMM_WORLD, &this->comm);
+    } else {
+        MPI_Comm_split(MPI_COMM_WORLD, (int)this->io_rank, locality_id, &this->comm);
+        MPI_Comm_dup(MPI_COMM_WORLD, &this->forward_comm);
+    }
+}
+
+template <typename ProblemType>
+OMPISharedFileWriter<ProblemType>::~OMPISharedFileWriter() {
+    if (this->pending_output.valid()) {
+        this->pending_output.wait();
+    }
+}
+
+template <typename ProblemType>
+template <typename SimUnitType>
+void OMPISharedFileWriter<ProblemType>::WriteOutput(const typename ProblemType::ProblemStepperType& stepper,
+                                                    std::vector<std::unique_ptr<SimUnitType>>& sim_units) {
+    const uint step   = stepper.GetStep();
+    const double time = stepper.GetTimeAtCurrentStage();
+
+    std::shared_ptr<SnapshotsType>& snapshots = this->output_snapshots[this->current_snapshot];
+
+    if (!snapshots) {
+        snapshots = std::make_shared<SnapshotsType>(sim_units.size());
+    }
+
+    if (this->n_io_ranks > 0) {
+        ForwardBuffer& buffer = this->forward_buffers[this->current_snapshot];
+
+        // back-pressure: the buffer may still be in flight from two output steps ago
+        MPI_Waitall(3, buffer.requests.data(), MPI_STATUSES_IGNORE);
+
+        for (uint su_id = 0; su_id < sim_units.size(); ++su_id) {
+            ProblemType::take_output_snapshot(stepper, sim_units[su_id]->discretization.mesh, (*snapshots)[su_id]);
+        }
+
+        OMPISharedFileWriter<ProblemType>::PackSnapshots(*snapshots, buffer.index, buffer.data);
+
+        buffer.header = Header{{'D', 'G', 'S', 'W', 'E', 'M', 'V', '2'}, buffer.index.size(), step, time};
+
+        int locality_id;
+        MPI_Comm_rank(this->forward_comm, &locality_id);
+
+        const int io_locality_id = this->n_compute_ranks + locality_id % this->n_io_ranks;
+
+        MPI_Isend(
+            &buffer.header, sizeof(Header), MPI_BYTE, io_locality_id, 0, this->forward_comm, &buffer.requests[0]);
+        MPI_Isend(buffer.index.data(),
+                  buffer.index.size() * sizeof(IndexEntry),
+                  MPI_BYTE,
+                  io_locality_id,
+                  1,
+                  this->forward_comm,
+                  &buffer.requests[1]);
+        MPI_Isend(buffer.data.data(),
+                  buffer.data.size(),
+                  MPI_DOUBLE,
+                  io_locality_id,
+                  2,
+                  this->forward_comm,
+                  &buffer.requests[2]);
+
+        this->current_snapshot = 1 - this->current_snapshot;
+
+        return;
+    }
+
+    for (uint su_id = 0; su_id < sim_units.size(); ++su_id) {
+        ProblemType::take_output_snapshot(stepper, sim_units[su_id]->discretization.mesh, (*snapshots)[su_id]);
+    }
+
+    // back-pressure: at most one collective write is in flight
+    this->WaitForOutput();
+
+    std::string file_name = this->file_name_prefix + std::to_string(step) + ".bin";
+
+    if (!this->background_write) {
+        std::vector<IndexEntry> index;
+        std::vector<double> data;
+
+        OMPISharedFileWriter<ProblemType>::PackSnapshots(*snapshots, index, data);
+        OMPISharedFileWriter<ProblemType>::WriteFile(index, data, step, time, file_name, this->comm);
+
+        return;
+    }
+
+    this->pending_output = std::async(std::launch::async, [snapshots, step, time, file_name, comm = this->comm]() {
+        std::vector<IndexEntry> index;
+        std::vector<double> data;
+
+        OMPISharedFileWriter<ProblemType>::PackSnapshots(*snapshots, index, data);
+        OMPISharedFileWriter<ProblemType>::WriteFile(index, data, step, time, file_name, comm);
+    });
+
+    this->current_snapshot = 1 - this->current_snapshot;
+}
+
+template <typename ProblemType>
+void OMPISharedFileWriter<ProblemType>::WaitForOutput() {
+    if (this->pending_output.valid()) {
+        this->pending_output.get();
+    }
+
+    for (ForwardBuffer& buffer : this->forward_buffers) {
+        MPI_Waitall(3, buffer.requests.data(), MPI_STATUSES_IGNORE);
+    }
+}
+
+template <typename ProblemType>
+void OMPISharedFileWriter<ProblemType>::ServeOutput(const uint begin_step, const uint n_steps) {
+    int locality_id;
+    MPI_Comm_rank(this->forward_comm, &locality_id);
+
+    const uint io_rank_id = (uint)locality_id - this->n_compute_ranks;
+
+    std::vector<int> sources;
+    for (uint compute_locality_id = io_rank_id; compute_locality_id < this->n_compute_ranks;
+         compute_locality_id += this->n_io_ranks) {
+        sources.push_back((int)compute_locality_id);
+    }
+
+    Header header{};
+    std::vector<std::vector<IndexEntry>> received_index(sources.size());
+    std::vector<std::vector<double>> received_data(sources.size());
+
+    std::vector<std::pair<std::uint64_t, std::pair<uint, uint>>> elements;
+    std::vector<IndexEntry> index;
+    std::vector<double> data;
+
+    // compute ranks forward their output in step order, so the I/O rank only has to replay the output steps
+    for (uint step = begin_step; step <= n_steps; ++step) {
+        if (step % this->output_frequency != 0) {
+            continue;
+        }
+
+        elements.clear();
+
+        for (uint src = 0; src < sources.size(); ++src) {
+            MPI_Recv(&header, sizeof(Header), MPI_BYTE, sources[src], 0, this->forward_comm, MPI_STATUS_IGNORE);
+
+            received_index[src].resize(header.n_elements);
+            MPI_Recv(received_index[src].data(),
+                     header.n_elements * sizeof(IndexEntry),
+                     MPI_BYTE,
+                     sources[src],
+                     1,
+                     this->forward_comm,
+                     MPI_STATUS_IGNORE);
+
+            MPI_Status status;
+            int n_data;
+            MPI_Probe(sources[src], 2, this->forward_comm, &status);
+            MPI_Get_count(&status, MPI_DOUBLE, &n_data);
+
+            received_data[src].resize(n_data);
+            MPI_Recv(received_data[src].data(),
+                     n_data,
+                     MPI_DOUBLE,
+                     sources[src],
+                     2,
+                     this->forward_comm,
+                     MPI_STATUS_IGNORE);
+
+            for (uint elt = 0; elt < received_index[src].size(); ++elt) {
+                elements.push_back(std::make_pair(received_index[src][elt].ID, std::make_pair(src, elt)));
+            }
+        }
+
+        std::sort(elements.begin(), elements.end());
+
+        index.clear();
+        data.clear();
+
+        for (auto& element : elements) {
+            IndexEntry entry = received_index[element.second.first][element.second.second];
+
+            const double* entry_data = received_data[element.second.first].data() + entry.offset / sizeof(double);
+            const uint n_entry_data  = (entry.n_variables + entry.n_auxiliaries) * entry.ndof;
+
+            entry.offset = data.size() * sizeof(double);
+
+            index.push_back(entry);
+            data.insert(data.end(), entry_data, entry_data + n_entry_data);
+        }
+
+        OMPISharedFileWriter<ProblemType>::WriteFile(
+            index, data, step, header.time, this->file_name_prefix + std::to_string(step) + ".bin", this->comm);
+    }
+}
+
+template <typename ProblemType>
+void OMPISharedFileWriter<ProblemType>::Finalize() {
+    this->WaitForOutput();
+
+    if (this->comm != MPI_COMM_NULL) {
+        MPI_Comm_free(&this->comm);
+    }
+
+    if (this->forward_comm != MPI_COMM_NULL) {
+        MPI_Comm_free(&this->forward_comm);
+    }
+}
+
+template <typename ProblemType>
+void OMPISharedFileWriter<ProblemType>::PackSnapshots(const SnapshotsType& snapshots,
+                                                      std::vector<IndexEntry>& index,
+                                                      std::vector<double>& data) {
+    index.clear();
+    data.clear();
+
+    for (auto& snapshot : snapshots) {
+        for (auto& elt_data : snapshot.elements) {
+            IndexEntry entry;
+
+            entry.ID            = elt_data.ID;
+            entry.offset        = data.size() * sizeof(double);  // relative to the local data block
+            entry.n_variables   = rows(elt_data.q);
+            entry.n_auxiliaries = rows(elt_data.aux);
+            entry.ndof          = columns(elt_data.q);
+            entry.padding       = 0;
+
+            index.push_back(entry);
+
+            for (uint var = 0; var < entry.n_variables; ++var) {
+                for (uint dof = 0; dof < entry.ndof; ++dof) {
+                    data.push_back(elt_data.q(var, dof));
+                }
+            }
+
+            for (uint var = 0; var < entry.n_auxiliaries; ++var) {
+                for (uint dof = 0; dof < entry.ndof; ++dof) {
+                    data.push_back(elt_data.aux(var, dof));
+                }
+            }
+        }
+    }
+}
+
+template <typename ProblemType>
+void OMPISharedFileWriter<ProblemType>::WriteFile(std::vector<IndexEntry>& index,
+                                                  const std::vector<double>& data,
+                                                  const uint step,
+                                                  const double time,
+                                                  const std::string& file_name,
+                                                  MPI_Comm comm) {
+    // offsets of this rank into the global index and data blocks
+    std::array<std::uint64_t, 2> local_sizes{{index.size(), data.size()}};
+    std::array<std::uint64_t, 2> offsets{{0, 0}};
+    std::array<std::uint64_t, 2> global_sizes{{0, 0}};
+
+    int locality_id;
+    MPI_Comm_rank(comm, &locality_id);
+
+    MPI_Exscan(local_sizes.data(), offsets.data(), 2, MPI_UINT64_T, MPI_SUM, comm);
+    MPI_Allreduce(local_sizes.data(), global_sizes.data(), 2, MPI_UINT64_T, MPI_SUM, comm);
+
+    if (locality_id == 0) {
+        offsets = {{0, 0}};
+    }
+    const std::uint64_t index_begin = sizeof(Header);
+    const std::uint64_t data_begin  = index_begin + global_sizes[0] * sizeof(IndexEntry);
+
+    for (IndexEntry& entry : index) {
+        entry.offset += data_begin + offsets[1] * sizeof(double);
+    }
+
+    MPI_File file;
+    if (MPI_File_open(comm, file_name.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &file) !=
+        MPI_SUCCESS) {
+        throw std::logic_error("Fatal Error: unable to open shared output file " + file_name + '\n');
+    }
+
+    // discard the tail of a larger file written by a previous run
+    MPI_File_set_size(file, (MPI_Offset)(data_begin + global_sizes[1] * sizeof(double)));
+
+    Header header{{'D', 'G', 'S', 'W', 'E', 'M', 'V', '2'}, global_sizes[0], step, time};
+
+    MPI_File_write_at_all(file, 0, &header, locality_id == 0 ? sizeof(Header) : 0, MPI_BYTE, MPI_STATUS_IGNORE);
+
+    MPI_File_write_at_all(file,
+                          (MPI_Offset)(index_begin + offsets[0] * sizeof(IndexEntry)),
+                          index.data(),
+                          (int)(index.size() * sizeof(IndexEntry)),
+                          MPI_BYTE,
+                          MPI_STATUS_IGNORE);
+
+    MPI_File_write_at_all(file,
+                          (MPI_Offset)(data_begin + offsets[1] * sizeof(double)),
+                          data.data(),
+                          (int)data.size(),
+                          MPI_DOUBLE,
+                          MPI_STATUS_IGNORE);
+
+    MPI_File_close(&file);
+}
+
+#endif
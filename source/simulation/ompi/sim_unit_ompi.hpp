@@ -19,6 +19,8 @@ struct OMPISimulationUnit {
 
     typename ProblemType::ProblemInputType problem_input;
 
+    RestartInput restart_input;
+
     OMPISimulationUnit() = default;
     OMPISimulationUnit(const std::string& input_string, const uint locality_id, const uint submesh_id);
 };
@@ -35,14 +37,27 @@ OMPISimulationUnit<ProblemType>::OMPISimulationUnit(const std::string& input_str
     input.read_bcis();                         // read bc data
     input.read_dbmd(locality_id, submesh_id);  // read distributed boundary meta data
 
+    if (input.communicator_input.ghost_layers) {
+        input.read_ghmd(locality_id, submesh_id);  // read ghost layer meta data
+    }
+
     ProblemType::preprocess_mesh_data(input);
 
+    const bool one_sided = (input.communicator_input.backend == "one_sided");
+
     this->discretization.mesh = typename ProblemType::ProblemMeshType(input.polynomial_order);
-    this->communicator        = OMPICommunicator(input.mesh_input.dbmd_data);
+    this->communicator        = input.communicator_input.ghost_layers
+                             ? OMPICommunicator(input.mesh_input.ghmd_data, one_sided)
+                             : OMPICommunicator(input.mesh_input.dbmd_data, one_sided);
     this->writer              = typename ProblemType::ProblemWriterType(input.writer_input, locality_id, submesh_id);
     this->parser              = typename ProblemType::ProblemParserType(input, locality_id, submesh_id);
 
     this->problem_input = input.problem_input;
+    this->restart_input = input.restart_input;
+
+    for (const std::string& comm_type_name : input.communicator_input.reduced_precision) {
+        this->communicator.SetReducedPrecision(ProblemType::comm_type_id(comm_type_name));
+    }
 
     if (this->writer.WritingLog()) {
         this->writer.StartLog();
@@ -54,6 +69,11 @@ OMPISimulationUnit<ProblemType>::OMPISimulationUnit(const std::string& input_str
 
     this->discretization.initialize(input, this->communicator, this->writer);
 
+    if (this->communicator.UsesGhostLayers()) {
+        ProblemType::create_ghost_layers(this->discretization.mesh, this->communicator, this->writer);
+    }
+    this->discretization.timers.SetSubmeshID(submesh_id);
+
     this->communicator.InitializeCommunication();
 }
 
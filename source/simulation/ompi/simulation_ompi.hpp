@@ -6,7 +6,10 @@
 #include "general_definitions.hpp"
 #include "preprocessor/input_parameters.hpp"
 #include "utilities/file_exists.hpp"
+#include "utilities/comm_counters.hpp"
+#include "utilities/kernel_timers.hpp"
 #include "sim_unit_ompi.hpp"
+#include "shared_file_writer_ompi.hpp"
 
 template <typename ProblemType>
 class OMPISimulation : public OMPISimulationBase {
@@ -18,6 +21,11 @@ class OMPISimulation : public OMPISimulationBase {
 
     typename ProblemType::ProblemStepperType stepper;
 
+    OMPISharedFileWriter<ProblemType> shared_file_writer;
+
+    RestartInput restart_input;
+    WriterInput writer_input;
+
   public:
     OMPISimulation() = default;
     OMPISimulation(const std::string& input_string);
@@ -25,6 +33,12 @@ class OMPISimulation : public OMPISimulationBase {
     void Run() override;
     void ComputeL2Residual() override;
     void Finalize() override;
+
+  private:
+    std::vector<OMPICommunicator*> GetCommunicators();
+    void WriteSharedFileOutput();
+    void WriteKernelTimers();
+    void WriteCommCounters();
 };
 
 template <typename ProblemType>
@@ -38,6 +52,11 @@ OMPISimulation<ProblemType>::OMPISimulation(const std::string& input_string) {
 
     this->stepper = typename ProblemType::ProblemStepperType(input.stepper_input);
 
+    this->restart_input = input.restart_input;
+    this->writer_input  = input.writer_input;
+
+    this->shared_file_writer = OMPISharedFileWriter<ProblemType>(input.writer_input, input.mesh_input.mesh_file_name);
+
     std::string submesh_file_prefix =
         input.mesh_input.mesh_file_name.substr(0, input.mesh_input.mesh_file_name.find_last_of('.')) + "_" +
         std::to_string(locality_id) + '_';
@@ -52,14 +71,29 @@ OMPISimulation<ProblemType>::OMPISimulation(const std::string& input_string) {
         ++submesh_id;
     }
 
-    if (this->sim_units.empty()) {
+    if (this->shared_file_writer.IsIORank()) {
+        if (!this->sim_units.empty()) {
+            throw std::logic_error("Fatal Error: submeshes are assigned to MPI rank " + std::to_string(locality_id) +
+                                   " which is reserved for I/O\n");
+        }
+    } else if (this->sim_units.empty()) {
         std::cerr << "Warning: MPI Rank " << locality_id << " has not been assigned any work. This may inidicate\n"
                   << "         poor partitioning and imply degraded performance." << std::endl;
     }
+
+    OMPICommunicator::InitializeOneSidedCommunication(this->GetCommunicators());
 }
 
 template <typename ProblemType>
 void OMPISimulation<ProblemType>::Run() {
+    if (this->shared_file_writer.IsIORank()) {
+        const uint begin_step = this->restart_input.restarting ? this->restart_input.step + 1 : 0;
+
+        this->shared_file_writer.ServeOutput(begin_step, this->n_steps);
+
+        return;
+    }
+
 #pragma omp parallel
     {
         uint n_threads, thread_id, sim_per_thread, begin_sim_id, end_sim_id;
@@ -74,6 +108,20 @@ void OMPISimulation<ProblemType>::Run() {
 
         ProblemType::preprocessor_ompi(this->sim_units, this->global_data, this->stepper, begin_sim_id, end_sim_id);
 
+        // the checkpointed state replaces the initial conditions set by the preprocessor, every submesh restores
+        // the same shared stepper state
+        if (this->restart_input.restarting) {
+#pragma omp barrier
+#pragma omp master
+            {
+                for (auto& sim_unit : this->sim_units) {
+                    sim_unit->writer.ReadCheckpoint(
+                        sim_unit->restart_input, this->stepper, sim_unit->discretization.mesh);
+                }
+            }
+#pragma omp barrier
+        }
+
         for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
             if (this->sim_units[su_id]->writer.WritingLog()) {
                 this->sim_units[su_id]->writer.GetLogFile() << std::endl
@@ -87,9 +135,23 @@ void OMPISimulation<ProblemType>::Run() {
             }
         }
 
-        for (uint step = 1; step <= this->n_steps; ++step) {
+        // the output of the step a simulation is restarted from was written by the run that checkpointed it
+        if (this->stepper.GetStep() == 0) {
+            this->WriteSharedFileOutput();
+        }
+
+        for (uint step = this->stepper.GetStep() + 1; step <= this->n_steps; ++step) {
             ProblemType::step_ompi(this->sim_units, this->global_data, this->stepper, begin_sim_id, end_sim_id);
+
+            this->WriteSharedFileOutput();
+        }
+
+        for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
+            this->sim_units[su_id]->writer.WaitForOutput();
         }
+
+#pragma omp master
+        { this->shared_file_writer.WaitForOutput(); }
     }  // close omp parallel region
 }
 
@@ -102,7 +164,7 @@ void OMPISimulation<ProblemType>::ComputeL2Residual() {
     double residual_l2{0};
 
     for (auto& sim_unit : this->sim_units) {
-        sim_unit->discretization.mesh.CallForEachElement(
+        sim_unit->discretization.mesh.CallForEachOwnedElement(
             [this, &residual_l2](auto& elt) { residual_l2 += ProblemType::compute_residual_L2(this->stepper, elt); });
     }
 
@@ -116,6 +178,222 @@ void OMPISimulation<ProblemType>::ComputeL2Residual() {
 template <typename ProblemType>
 void OMPISimulation<ProblemType>::Finalize() {
     ProblemType::finalize_simulation(this->global_data);
+
+    OMPICommunicator::FinalizeOneSidedCommunication(this->GetCommunicators());
+
+    this->shared_file_writer.Finalize();
+
+    // station files of all ranks are complete once every rank has returned from Run
+    if (this->writer_input.writing_station_output) {
+        int locality_id;
+        MPI_Comm_rank(MPI_COMM_WORLD, &locality_id);
+
+        MPI_Barrier(MPI_COMM_WORLD);
+
+        if (locality_id == 0) {
+            merge_station_output(this->writer_input);
+        }
+    }
+
+#ifdef HAS_KERNEL_TIMERS
+    this->WriteKernelTimers();
+#endif
+
+#ifdef HAS_COMM_PROFILER
+    this->WriteCommCounters();
+#endif
+
+#ifdef HAS_EVENT_TRACER
+    int locality_id;
+    MPI_Comm_rank(MPI_COMM_WORLD, &locality_id);
+
+    Utilities::EventTracer::Get().WriteChromeTrace(
+        this->writer_input.output_path + "trace_" + std::to_string(locality_id) + ".json", locality_id);
+#endif
+}
+
+template <typename ProblemType>
+void OMPISimulation<ProblemType>::WriteSharedFileOutput() {
+    // all submeshes of the rank go into the shared file at once, so every thread must be done stepping
+    if (this->shared_file_writer.WritingOutput(this->stepper)) {
+#pragma omp barrier
+#pragma omp master
+        { this->shared_file_writer.WriteOutput(this->stepper, this->sim_units); }
+#pragma omp barrier
+    }
+}
+
+template <typename ProblemType>
+void OMPISimulation<ProblemType>::WriteKernelTimers() {
+    int locality_id;
+    int n_localities;
+    MPI_Comm_rank(MPI_COMM_WORLD, &locality_id);
+    MPI_Comm_size(MPI_COMM_WORLD, &n_localities);
+
+    // per simulation unit: submesh ID, seconds by phase, number of calls by phase
+    constexpr uint record_size = 1 + 2 * Utilities::n_kernel_phases;
+
+    std::vector<double> send_buffer;
+
+    for (uint submesh_id = 0; submesh_id < this->sim_units.size(); ++submesh_id) {
+        const Utilities::KernelTimers& timers = this->sim_units[submesh_id]->discretization.timers;
+
+        send_buffer.push_back(submesh_id);
+
+        for (uint phase = 0; phase < Utilities::n_kernel_phases; ++phase) {
+            send_buffer.push_back(timers.GetSeconds(phase));
+        }
+
+        for (uint phase = 0; phase < Utilities::n_kernel_phases; ++phase) {
+            send_buffer.push_back((double)timers.GetCalls(phase));
+        }
+    }
+
+    int send_size = send_buffer.size();
+
+    std::vector<int> receive_sizes(n_localities);
+    std::vector<int> receive_offsets(n_localities, 0);
+
+    MPI_Gather(&send_size, 1, MPI_INT, receive_sizes.data(), 1, MPI_INT, 0, MPI_COMM_WORLD);
+
+    std::partial_sum(receive_sizes.begin(), receive_sizes.end() - 1, receive_offsets.begin() + 1);
+
+    std::vector<double> receive_buffer(locality_id == 0 ? receive_offsets.back() + receive_sizes.back() : 0);
+
+    MPI_Gatherv(send_buffer.data(),
+                send_size,
+                MPI_DOUBLE,
+                receive_buffer.data(),
+                receive_sizes.data(),
+                receive_offsets.data(),
+                MPI_DOUBLE,
+                0,
+                MPI_COMM_WORLD);
+
+    if (locality_id != 0) {
+        return;
+    }
+
+    std::vector<Utilities::KernelTimersRecord> timers_records;
+
+    for (int rank = 0; rank < n_localities; ++rank) {
+        for (int offset = receive_offsets[rank]; offset < receive_offsets[rank] + receive_sizes[rank];
+             offset += record_size) {
+            Utilities::KernelTimersRecord record{(uint)rank, (uint)receive_buffer[offset], Utilities::KernelTimers()};
+
+            for (uint phase = 0; phase < Utilities::n_kernel_phases; ++phase) {
+                record.timers.Set(phase,
+                                  receive_buffer[offset + 1 + phase],
+                                  (std::uint64_t)receive_buffer[offset + 1 + Utilities::n_kernel_phases + phase]);
+            }
+
+            timers_records.push_back(record);
+        }
+    }
+
+    Utilities::write_kernel_timers_summary(std::cout, timers_records);
+    Utilities::write_kernel_timers_json(this->writer_input.output_path + "kernel_timers.json", timers_records);
+}
+
+template <typename ProblemType>
+void OMPISimulation<ProblemType>::WriteCommCounters() {
+    int locality_id;
+    int n_localities;
+    MPI_Comm_rank(MPI_COMM_WORLD, &locality_id);
+    MPI_Comm_size(MPI_COMM_WORLD, &n_localities);
+
+    // per rank boundary: submesh ID, neighbor rank and submesh ID, number of communication types, counters by type
+    constexpr uint n_counters = 6;
+
+    std::vector<double> send_buffer;
+
+    for (OMPICommunicator* communicator : this->GetCommunicators()) {
+        for (const Utilities::CommCountersRecord& record : communicator->GetCommCounters()) {
+            send_buffer.push_back(record.submesh_in);
+            send_buffer.push_back(record.locality_ex);
+            send_buffer.push_back(record.submesh_ex);
+            send_buffer.push_back(record.counters.size());
+
+            for (const Utilities::CommCounters& counters : record.counters) {
+                send_buffer.push_back((double)counters.messages_sent);
+                send_buffer.push_back((double)counters.bytes_sent);
+                send_buffer.push_back((double)counters.messages_received);
+                send_buffer.push_back((double)counters.bytes_received);
+                send_buffer.push_back(counters.send_wait_seconds);
+                send_buffer.push_back(counters.receive_wait_seconds);
+            }
+        }
+    }
+
+    int send_size = send_buffer.size();
+
+    std::vector<int> receive_sizes(n_localities);
+    std::vector<int> receive_offsets(n_localities, 0);
+
+    MPI_Gather(&send_size, 1, MPI_INT, receive_sizes.data(), 1, MPI_INT, 0, MPI_COMM_WORLD);
+
+    std::partial_sum(receive_sizes.begin(), receive_sizes.end() - 1, receive_offsets.begin() + 1);
+
+    std::vector<double> receive_buffer(locality_id == 0 ? receive_offsets.back() + receive_sizes.back() : 0);
+
+    MPI_Gatherv(send_buffer.data(),
+                send_size,
+                MPI_DOUBLE,
+                receive_buffer.data(),
+                receive_sizes.data(),
+                receive_offsets.data(),
+                MPI_DOUBLE,
+                0,
+                MPI_COMM_WORLD);
+
+    if (locality_id != 0) {
+        return;
+    }
+
+    std::vector<Utilities::CommCountersRecord> counters_records;
+
+    for (int rank = 0; rank < n_localities; ++rank) {
+        int offset = receive_offsets[rank];
+
+        while (offset < receive_offsets[rank] + receive_sizes[rank]) {
+            const uint n_comm_types = (uint)receive_buffer[offset + 3];
+
+            Utilities::CommCountersRecord record{(uint)rank,
+                                                 (uint)receive_buffer[offset],
+                                                 (uint)receive_buffer[offset + 1],
+                                                 (uint)receive_buffer[offset + 2],
+                                                 std::vector<Utilities::CommCounters>(n_comm_types)};
+
+            offset += 4;
+
+            for (Utilities::CommCounters& counters : record.counters) {
+                counters.messages_sent        = (std::uint64_t)receive_buffer[offset];
+                counters.bytes_sent           = (std::uint64_t)receive_buffer[offset + 1];
+                counters.messages_received    = (std::uint64_t)receive_buffer[offset + 2];
+                counters.bytes_received       = (std::uint64_t)receive_buffer[offset + 3];
+                counters.send_wait_seconds    = receive_buffer[offset + 4];
+                counters.receive_wait_seconds = receive_buffer[offset + 5];
+
+                offset += n_counters;
+            }
+
+            counters_records.push_back(std::move(record));
+        }
+    }
+
+    Utilities::write_comm_counters_summary(std::cout, counters_records);
+    Utilities::write_comm_counters_json(this->writer_input.output_path + "comm_counters.json", counters_records);
+}
+
+template <typename ProblemType>
+std::vector<OMPICommunicator*> OMPISimulation<ProblemType>::GetCommunicators() {
+    std::vector<OMPICommunicator*> communicators;
+
+    for (auto& sim_unit : this->sim_units) {
+        communicators.push_back(&sim_unit->communicator);
+    }
+
+    return communicators;
 }
 
 #endif
\ No newline at end of file
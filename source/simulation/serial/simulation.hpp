@@ -3,6 +3,7 @@
 
 #include "general_definitions.hpp"
 #include "preprocessor/input_parameters.hpp"
+#include "utilities/kernel_timers.hpp"
 
 #include "simulation/serial/simulation_base.hpp"
 
@@ -24,6 +25,9 @@ class Simulation : public SimulationBase {
 
     typename ProblemType::ProblemInputType problem_input;
 
+    RestartInput restart_input;
+    WriterInput writer_input;
+
   public:
     Simulation() = default;
     Simulation(const std::string& input_string);
@@ -37,6 +41,10 @@ template <typename ProblemType>
 Simulation<ProblemType>::Simulation(const std::string& input_string) {
     InputParameters<typename ProblemType::ProblemInputType> input(input_string);
 
+    if (input.writer_input.modal_shared_file) {
+        throw std::logic_error("Fatal Error: shared file modal output is only supported by the OMPI simulation\n");
+    }
+
     ProblemType::initialize_problem_parameters(input.problem_input);
 
     input.read_mesh();  // read mesh meta data
@@ -52,6 +60,8 @@ Simulation<ProblemType>::Simulation(const std::string& input_string) {
     this->parser              = typename ProblemType::ProblemParserType(input);
 
     this->problem_input = input.problem_input;
+    this->restart_input = input.restart_input;
+    this->writer_input  = input.writer_input;
 
     if (this->writer.WritingLog()) {
         this->writer.StartLog();
@@ -68,6 +78,11 @@ template <typename ProblemType>
 void Simulation<ProblemType>::Run() {
     ProblemType::preprocessor_serial(this->discretization, this->global_data, this->stepper, this->problem_input);
 
+    // the checkpointed state replaces the initial conditions set by the preprocessor
+    if (this->restart_input.restarting) {
+        this->writer.ReadCheckpoint(this->restart_input, this->stepper, this->discretization.mesh);
+    }
+
     if (this->writer.WritingLog()) {
         this->writer.GetLogFile() << std::endl << "Launching Simulation!" << std::endl << std::endl;
     }
@@ -76,9 +91,15 @@ void Simulation<ProblemType>::Run() {
         this->writer.WriteFirstStep(this->stepper, this->discretization.mesh);
     }
 
-    for (uint step = 1; step <= this->n_steps; ++step) {
+    for (uint step = this->stepper.GetStep() + 1; step <= this->n_steps; ++step) {
         ProblemType::step_serial(this->discretization, this->global_data, this->stepper, this->writer, this->parser);
     }
+
+    this->writer.WaitForOutput();
+
+    if (this->writer_input.writing_station_output) {
+        merge_station_output(this->writer_input);
+    }
 }
 
 template <typename ProblemType>
@@ -94,6 +115,18 @@ void Simulation<ProblemType>::ComputeL2Residual() {
 template <typename ProblemType>
 void Simulation<ProblemType>::Finalize() {
     ProblemType::finalize_simulation(this->global_data);
+
+#ifdef HAS_KERNEL_TIMERS
+    std::vector<Utilities::KernelTimersRecord> timers_records{
+        Utilities::KernelTimersRecord{0, 0, this->discretization.timers}};
+
+    Utilities::write_kernel_timers_summary(std::cout, timers_records);
+    Utilities::write_kernel_timers_json(this->writer_input.output_path + "kernel_timers.json", timers_records);
+#endif
+
+#ifdef HAS_EVENT_TRACER
+    Utilities::EventTracer::Get().WriteChromeTrace(this->writer_input.output_path + "trace_0.json", 0);
+#endif
 }
 }
 #endif
@@ -13,6 +13,44 @@ ESSPRKStepper::ESSPRKStepper(const StepperInput& stepper_input)
     this->InitializeCoefficients();
 }
 
+void ESSPRKStepper::WriteCheckpoint(std::ostream& file) const {
+    file.write((const char*)&this->order, sizeof(uint));
+    file.write((const char*)&this->nstages, sizeof(uint));
+    file.write((const char*)&this->dt, sizeof(double));
+
+    file.write((const char*)&this->step, sizeof(uint));
+    file.write((const char*)&this->stage, sizeof(uint));
+    file.write((const char*)&this->timestamp, sizeof(uint));
+
+    file.write((const char*)&this->t, sizeof(double));
+    file.write((const char*)&this->ramp, sizeof(double));
+}
+
+void ESSPRKStepper::ReadCheckpoint(std::istream& file) {
+    uint order;
+    uint nstages;
+    double dt;
+
+    file.read((char*)&order, sizeof(uint));
+    file.read((char*)&nstages, sizeof(uint));
+    file.read((char*)&dt, sizeof(double));
+
+    if (!file || order != this->order || nstages != this->nstages || !Utilities::almost_equal(dt, this->dt)) {
+        throw std::logic_error("Fatal Error: checkpoint was written with a different time stepping method\n");
+    }
+
+    file.read((char*)&this->step, sizeof(uint));
+    file.read((char*)&this->stage, sizeof(uint));
+    file.read((char*)&this->timestamp, sizeof(uint));
+
+    file.read((char*)&this->t, sizeof(double));
+    file.read((char*)&this->ramp, sizeof(double));
+
+    if (!file) {
+        throw std::logic_error("Fatal Error: checkpoint is truncated\n");
+    }
+}
+
 void ESSPRKStepper::InitializeCoefficients() {
     // Allocate the time stepping arrays
     this->ark.reserve(this->nstages);
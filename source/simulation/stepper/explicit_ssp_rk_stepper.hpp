@@ -79,6 +79,9 @@ class ESSPRKStepper {
             std::swap(state[0].q, state[this->nstages].q);
     }
 
+    void WriteCheckpoint(std::ostream& file) const;
+    void ReadCheckpoint(std::istream& file);
+
 #ifdef HAS_HPX
     template <typename Archive>
     void save(Archive& ar, unsigned) const;
@@ -29,6 +29,16 @@ class SecondStrangStepper {
     uint GetStep() const { return this->second.GetStep(); }
     double GetTimeAtCurrentStage() const { return this->second.GetTimeAtCurrentStage(); }
 
+    void WriteCheckpoint(std::ostream& file) const {
+        this->first.WriteCheckpoint(file);
+        this->second.WriteCheckpoint(file);
+    }
+
+    void ReadCheckpoint(std::istream& file) {
+        this->first.ReadCheckpoint(file);
+        this->second.ReadCheckpoint(file);
+    }
+
     SecondStrangStepper<First, Second>& operator=(SecondStrangStepper<First, Second>&& rhs) {
         this->first  = std::move(rhs.first);
         this->second = std::move(rhs.second);
@@ -1,9 +1,19 @@
 #ifndef WRITER_HPP
 #define WRITER_HPP
 
+#include <dirent.h>
 #include <sys/stat.h>
 #include "general_definitions.hpp"
 #include "preprocessor/input_parameters.hpp"
+#include "geometry/element_index.hpp"
+#include "utilities/vtu_data_array.hpp"
+
+#ifdef HAS_HPX
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#else
+#include <future>
+#endif
 
 template <typename ProblemType>
 class Writer {
@@ -23,15 +33,42 @@ class Writer {
 
     bool writing_vtu_output;
     uint vtu_output_frequency;
-    std::string vtu_file_name_geom_head;
-    std::string vtu_file_name_geom_foot;
-    std::string vtu_file_name_raw;
+    Utilities::VTUFormat vtu_format;
+    // geometry is formatted once and written around the data arrays of every snapshot
+    std::shared_ptr<const std::string> vtu_geom_head;
+    std::shared_ptr<const std::string> vtu_geom_foot;
 
     bool writing_modal_output;
     uint modal_output_frequency;
 
+    bool writing_checkpoint;
+    uint checkpoint_frequency;
+
+    bool writing_station_output;
+    uint station_output_frequency;
+    AlignedVector<Point<2>> station_coordinates;
+    // elements of this submesh hosting stations, and the stations in the order they are evaluated in
+    std::vector<uint> station_element_IDs;
+    std::vector<uint> station_IDs;
+    std::vector<double> station_data;
+    std::ofstream station_file;
+
+    bool writing_extrema_output;
+    uint extrema_frequency;
+    uint last_step;
+    typename ProblemType::ProblemExtremaType extrema;
+
     uint version;
 
+    // output is double buffered: a snapshot is taken into one buffer while the other one is being written
+    std::array<std::shared_ptr<typename ProblemType::ProblemOutputSnapshotType>, 2> output_snapshots;
+    uint current_snapshot = 0;
+#ifdef HAS_HPX
+    hpx::future<void> pending_output;
+#else
+    std::future<void> pending_output;
+#endif
+
   public:
     Writer() = default;
     Writer(const WriterInput& writer_input);
@@ -39,6 +76,8 @@ class Writer {
 
     Writer(Writer&& rhs) = default;
 
+    ~Writer();
+
     Writer& operator=(Writer&& rhs) = default;
 
     bool WritingLog() { return this->writing_log_file; }
@@ -51,15 +90,32 @@ class Writer {
                         typename ProblemType::ProblemMeshType& mesh);
     void WriteOutput(const typename ProblemType::ProblemStepperType& stepper,
                      typename ProblemType::ProblemMeshType& mesh);
+    void WaitForOutput();
+
+    void WriteCheckpoint(const typename ProblemType::ProblemStepperType& stepper,
+                         typename ProblemType::ProblemMeshType& mesh);
+    void ReadCheckpoint(const RestartInput& restart_input,
+                        typename ProblemType::ProblemStepperType& stepper,
+                        typename ProblemType::ProblemMeshType& mesh);
 
   private:
     void InitializeMeshGeometryVTK(typename ProblemType::ProblemMeshType& mesh);
     void InitializeMeshGeometryVTU(typename ProblemType::ProblemMeshType& mesh);
 
+    void InitializeStations(const typename ProblemType::ProblemStepperType& stepper,
+                            typename ProblemType::ProblemMeshType& mesh);
+    void WriteStationOutput(const typename ProblemType::ProblemStepperType& stepper,
+                            typename ProblemType::ProblemMeshType& mesh);
+
+    void WriteExtrema(typename ProblemType::ProblemMeshType& mesh);
+
   public:
 #ifdef HAS_HPX
     template <typename Archive>
     void serialize(Archive& ar, unsigned) {
+        // the snapshot in flight points into the master elements of the mesh being migrated
+        this->WaitForOutput();
+
         // clang-format off
         ar  & writing_output
             & output_path
@@ -72,6 +128,16 @@ class Writer {
             & vtk_file_name_raw
             & writing_modal_output
             & modal_output_frequency
+            & writing_checkpoint
+            & checkpoint_frequency
+            & writing_station_output
+            & station_output_frequency
+            & station_element_IDs
+            & station_IDs
+            & writing_extrema_output
+            & extrema_frequency
+            & last_step
+            & extrema
             & version;
         // clang-format on
     }
@@ -88,13 +154,32 @@ Writer<ProblemType>::Writer(const WriterInput& writer_input)
       vtk_output_frequency(writer_input.vtk_output_freq_step),
       writing_vtu_output(writer_input.writing_vtu_output),
       vtu_output_frequency(writer_input.vtu_output_freq_step),
-      writing_modal_output(writer_input.writing_modal_output),
+      vtu_format(Utilities::VTUFormat::ascii),
+      // shared file modal output is written for all submeshes of a rank by the OMPI simulation
+      writing_modal_output(writer_input.writing_modal_output && !writer_input.modal_shared_file),
       modal_output_frequency(writer_input.modal_output_freq_step),
+      writing_checkpoint(writer_input.writing_checkpoint),
+      checkpoint_frequency(writer_input.checkpoint_freq_step),
+      writing_station_output(writer_input.writing_station_output),
+      station_output_frequency(writer_input.station_output_freq_step),
+      station_coordinates(writer_input.station_coordinates),
+      writing_extrema_output(writer_input.writing_extrema_output),
+      extrema_frequency(writer_input.extrema_freq_step),
+      last_step(writer_input.last_step),
       version(0) {
     mkdir(this->output_path.c_str(), ACCESSPERMS);
     if (this->writing_log_file) {
         this->log_file_name = this->output_path + writer_input.log_file_name;
     }
+
+    if (writer_input.vtu_output_format == "binary") {
+        this->vtu_format = Utilities::VTUFormat::binary;
+    } else if (writer_input.vtu_output_format == "compressed") {
+#ifndef HAS_ZLIB
+        throw std::logic_error("Fatal Error: compressed vtu output requires zlib support\n");
+#endif
+        this->vtu_format = Utilities::VTUFormat::compressed;
+    }
 }
 
 template <typename ProblemType>
@@ -108,6 +193,18 @@ Writer<ProblemType>::Writer(const WriterInput& writer_input, const uint locality
     }
 }
 
+template <typename ProblemType>
+Writer<ProblemType>::~Writer() {
+    // the last snapshot must not be lost, a destructor can only report errors raised while writing it
+    if (this->pending_output.valid()) {
+        try {
+            this->pending_output.get();
+        } catch (const std::exception& e) {
+            std::cerr << e.what();
+        }
+    }
+}
+
 template <typename ProblemType>
 void Writer<ProblemType>::StartLog() {
     this->log_file = std::ofstream(this->log_file_name + '_' + std::to_string(version++));
@@ -127,89 +224,336 @@ void Writer<ProblemType>::WriteFirstStep(const typename ProblemType::ProblemStep
         this->InitializeMeshGeometryVTK(mesh);
     }
 
-    if (this->writing_vtu_output) {
-        this->vtu_file_name_geom_head = this->output_path + mesh.GetMeshName() + "_geom_head.vtu";
-        this->vtu_file_name_geom_foot = this->output_path + mesh.GetMeshName() + "_geom_foot.vtu";
-        this->vtu_file_name_raw       = this->output_path + mesh.GetMeshName() + "_raw_data.vtu";
-
+    // extrema are written on the geometry of the VTU output
+    if (this->writing_vtu_output || this->writing_extrema_output) {
         this->InitializeMeshGeometryVTU(mesh);
     }
 
-    this->WriteOutput(stepper, mesh);
+    if (this->writing_station_output) {
+        this->InitializeStations(stepper, mesh);
+    }
+
+    // the output of the step a simulation is restarted from was written by the run that checkpointed it
+    if (stepper.GetStep() == 0) {
+        this->WriteOutput(stepper, mesh);
+    }
 }
 
 template <typename ProblemType>
 void Writer<ProblemType>::WriteOutput(const typename ProblemType::ProblemStepperType& stepper,
                                       typename ProblemType::ProblemMeshType& mesh) {
-    if (this->writing_vtk_output && (stepper.GetStep() % this->vtk_output_frequency == 0)) {
-        std::ofstream raw_data_file(this->vtk_file_name_raw);
+    const uint step = stepper.GetStep();
+
+    if (this->writing_extrema_output && (step % this->extrema_frequency == 0)) {
+        ProblemType::update_extrema(stepper, mesh, this->extrema);
+    }
+
+    if (this->writing_checkpoint && step != 0 && (step % this->checkpoint_frequency == 0)) {
+        this->WriteCheckpoint(stepper, mesh);
+    }
+
+    if (this->writing_extrema_output && step != 0 &&
+        (step == this->last_step || (this->writing_checkpoint && step % this->checkpoint_frequency == 0))) {
+        this->WriteExtrema(mesh);
+    }
+
+    if (this->writing_station_output && (step % this->station_output_frequency == 0)) {
+        this->WriteStationOutput(stepper, mesh);
+    }
+
+    const bool write_vtk   = this->writing_vtk_output && (step % this->vtk_output_frequency == 0);
+    const bool write_vtu   = this->writing_vtu_output && (step % this->vtu_output_frequency == 0);
+    const bool write_modal = this->writing_modal_output && (step % this->modal_output_frequency == 0);
+
+    if (!write_vtk && !write_vtu && !write_modal) {
+        return;
+    }
+
+    std::shared_ptr<typename ProblemType::ProblemOutputSnapshotType>& snapshot =
+        this->output_snapshots[this->current_snapshot];
+
+    if (!snapshot) {
+        snapshot = std::make_shared<typename ProblemType::ProblemOutputSnapshotType>();
+    }
+
+    // the only output work on the critical path is copying the solution into the free buffer
+    ProblemType::take_output_snapshot(stepper, mesh, *snapshot);
+
+    // back-pressure: if the previous snapshot is still being written, wait for it to finish
+    this->WaitForOutput();
+
+    auto write_snapshot = [snapshot,
+                           write_vtk,
+                           write_vtu,
+                           write_modal,
+                           output_path        = this->output_path,
+                           vtk_file_name_geom = this->vtk_file_name_geom,
+                           vtk_file_name_raw  = this->vtk_file_name_raw,
+                           vtu_format         = this->vtu_format,
+                           vtu_geom_head      = this->vtu_geom_head,
+                           vtu_geom_foot      = this->vtu_geom_foot]() {
+        const std::string file_name_data =
+            output_path + snapshot->mesh_name + "_data_" + std::to_string(snapshot->step);
+
+        if (write_vtk) {
+            std::ofstream raw_data_file(vtk_file_name_raw);
+
+            ProblemType::write_VTK_data(*snapshot, raw_data_file);
+
+            raw_data_file.close();
+
+            if (!Utilities::file_exists(vtk_file_name_geom)) {
+                throw std::logic_error("Fatal Error: vtk geometry data file " + vtk_file_name_geom +
+                                       " was not found!\n");
+            }
+
+            if (!Utilities::file_exists(vtk_file_name_raw)) {
+                throw std::logic_error("Fatal Error: vtk raw data file " + vtk_file_name_raw + " was not found!\n");
+            }
+
+            std::ifstream file_geom(vtk_file_name_geom, std::ios_base::binary);
+            std::ifstream file_data(vtk_file_name_raw, std::ios_base::binary);
 
-        ProblemType::write_VTK_data(mesh, raw_data_file);
+            std::ofstream file_merge(file_name_data + ".vtk", std::ios_base::binary);
 
-        raw_data_file.close();
+            file_merge << file_geom.rdbuf() << file_data.rdbuf();
 
-        if (!Utilities::file_exists(this->vtk_file_name_geom)) {
-            throw std::logic_error("Fatal Error: vtk geometry data file " + this->vtk_file_name_geom +
-                                   " was not found!\n");
+            file_merge.close();
+            file_geom.close();
+            file_data.close();
         }
 
-        if (!Utilities::file_exists(this->vtk_file_name_raw)) {
-            throw std::logic_error("Fatal Error: vtk raw data file " + this->vtk_file_name_raw + " was not found!\n");
+        if (write_vtu) {
+            std::ofstream file(file_name_data + ".vtu", std::ios_base::binary);
+
+            file << *vtu_geom_head;
+
+            ProblemType::write_VTU_data(*snapshot, file, vtu_format);
+
+            file << *vtu_geom_foot;
+
+            file.close();
         }
 
-        std::ifstream file_geom(this->vtk_file_name_geom, std::ios_base::binary);
-        std::ifstream file_data(this->vtk_file_name_raw, std::ios_base::binary);
+        if (write_modal) {
+            ProblemType::write_modal_data(*snapshot, output_path);
+        }
+    };
 
-        uint step                   = stepper.GetStep();
-        std::string file_name_merge = this->output_path + mesh.GetMeshName() + "_data_" + std::to_string(step) + ".vtk";
-        std::ofstream file_merge(file_name_merge, std::ios_base::binary);
+#ifdef HAS_HPX
+    this->pending_output = hpx::async(std::move(write_snapshot));
+#else
+    this->pending_output = std::async(std::launch::async, std::move(write_snapshot));
+#endif
 
-        file_merge << file_geom.rdbuf() << file_data.rdbuf();
+    this->current_snapshot = 1 - this->current_snapshot;
+}
 
-        file_merge.close();
-        file_geom.close();
-        file_data.close();
+template <typename ProblemType>
+void Writer<ProblemType>::WaitForOutput() {
+    if (this->pending_output.valid()) {
+        // rethrows errors raised while writing
+        this->pending_output.get();
     }
+}
 
-    if (this->writing_vtu_output && (stepper.GetStep() % this->vtu_output_frequency == 0)) {
-        std::ofstream raw_data_file(this->vtu_file_name_raw);
+template <typename ProblemType>
+void Writer<ProblemType>::WriteCheckpoint(const typename ProblemType::ProblemStepperType& stepper,
+                                          typename ProblemType::ProblemMeshType& mesh) {
+    const std::string file_name =
+        this->output_path + mesh.GetMeshName() + "_checkpoint_" + std::to_string(stepper.GetStep()) + ".bin";
+
+    // write to a temporary file first so that a failure while writing never leaves a truncated checkpoint
+    std::ofstream file(file_name + ".tmp", std::ios_base::binary);
 
-        ProblemType::write_VTU_data(mesh, raw_data_file);
+    file.write("DGSWECHK", 8);
 
-        raw_data_file.close();
+    stepper.WriteCheckpoint(file);
+    ProblemType::write_checkpoint_data(mesh, file);
 
-        if (!Utilities::file_exists(this->vtu_file_name_geom_head)) {
-            throw std::logic_error("Fatal Error: vtu geometry head data file " + this->vtu_file_name_geom_head +
-                                   " was not found!\n");
+    file.close();
+
+    if (!file || std::rename((file_name + ".tmp").c_str(), file_name.c_str()) != 0) {
+        throw std::logic_error("Fatal Error: unable to write checkpoint " + file_name + "\n");
+    }
+
+    if (!this->writing_extrema_output) {
+        return;
+    }
+
+    const std::string extrema_file_name = this->output_path + mesh.GetMeshName() + "_extrema_checkpoint_" +
+                                          std::to_string(stepper.GetStep()) + ".bin";
+
+    std::ofstream extrema_file(extrema_file_name + ".tmp", std::ios_base::binary);
+
+    extrema_file.write("DGSWEEXT", 8);
+
+    ProblemType::write_extrema_checkpoint(this->extrema, extrema_file);
+
+    extrema_file.close();
+
+    if (!extrema_file || std::rename((extrema_file_name + ".tmp").c_str(), extrema_file_name.c_str()) != 0) {
+        throw std::logic_error("Fatal Error: unable to write checkpoint " + extrema_file_name + "\n");
+    }
+}
+
+template <typename ProblemType>
+void Writer<ProblemType>::ReadCheckpoint(const RestartInput& restart_input,
+                                         typename ProblemType::ProblemStepperType& stepper,
+                                         typename ProblemType::ProblemMeshType& mesh) {
+    const std::string file_name =
+        restart_input.path + mesh.GetMeshName() + "_checkpoint_" + std::to_string(restart_input.step) + ".bin";
+
+    if (!Utilities::file_exists(file_name)) {
+        throw std::logic_error("Fatal Error: checkpoint " + file_name + " was not found!\n");
+    }
+
+    std::ifstream file(file_name, std::ios_base::binary);
+
+    std::array<char, 8> magic;
+    file.read(magic.data(), 8);
+
+    if (!file || std::string(magic.data(), 8) != "DGSWECHK") {
+        throw std::logic_error("Fatal Error: " + file_name + " is not a checkpoint file\n");
+    }
+
+    stepper.ReadCheckpoint(file);
+    ProblemType::read_checkpoint_data(mesh, file);
+
+    if (this->writing_log_file) {
+        this->log_file << "Restarted from " << file_name << " at step " << stepper.GetStep() << std::endl;
+    }
+
+    if (!this->writing_extrema_output) {
+        return;
+    }
+
+    const std::string extrema_file_name = restart_input.path + mesh.GetMeshName() + "_extrema_checkpoint_" +
+                                          std::to_string(restart_input.step) + ".bin";
+
+    // the checkpointed run may not have accumulated extrema, in which case they start over from the restart
+    if (!Utilities::file_exists(extrema_file_name)) {
+        if (this->writing_log_file) {
+            this->log_file << "No extrema checkpoint " << extrema_file_name << ", accumulating extrema from step "
+                           << stepper.GetStep() << std::endl;
         }
 
-        if (!Utilities::file_exists(this->vtu_file_name_geom_foot)) {
-            throw std::logic_error("Fatal Error: vtu geometry foot data file " + this->vtu_file_name_geom_foot +
-                                   " was not found!\n");
+        return;
+    }
+
+    std::ifstream extrema_file(extrema_file_name, std::ios_base::binary);
+
+    extrema_file.read(magic.data(), 8);
+
+    if (!extrema_file || std::string(magic.data(), 8) != "DGSWEEXT") {
+        throw std::logic_error("Fatal Error: " + extrema_file_name + " is not an extrema checkpoint file\n");
+    }
+
+    ProblemType::read_extrema_checkpoint(mesh, this->extrema, extrema_file);
+}
+
+template <typename ProblemType>
+void Writer<ProblemType>::InitializeStations(const typename ProblemType::ProblemStepperType& stepper,
+                                             typename ProblemType::ProblemMeshType& mesh) {
+    const std::vector<uint> host_element_IDs = Geometry::ElementIndex(mesh).LocatePoints(this->station_coordinates);
+
+    // stations grouped by host element, a station on an edge goes to the first element found
+    std::map<uint, std::vector<uint>> element_stations;
+
+    for (uint station = 0; station < this->station_coordinates.size(); ++station) {
+        if (host_element_IDs[station] != DEFAULT_ID) {
+            element_stations[host_element_IDs[station]].push_back(station);
         }
+    }
+
+    this->station_element_IDs.clear();
+    this->station_IDs.clear();
+
+    for (const auto& elt_stations : element_stations) {
+        AlignedVector<Point<2>> survey_points;
 
-        if (!Utilities::file_exists(this->vtu_file_name_raw)) {
-            throw std::logic_error("Fatal Error: vtu raw data file " + this->vtu_file_name_raw + " was not found!\n");
+        for (const uint station : elt_stations.second) {
+            survey_points.push_back(this->station_coordinates[station]);
+            this->station_IDs.push_back(station);
         }
 
-        std::ifstream file_geom_head(this->vtu_file_name_geom_head, std::ios_base::binary);
-        std::ifstream file_geom_foot(this->vtu_file_name_geom_foot, std::ios_base::binary);
-        std::ifstream file_data(this->vtu_file_name_raw, std::ios_base::binary);
+        this->station_element_IDs.push_back(elt_stations.first);
 
-        uint step                   = stepper.GetStep();
-        std::string file_name_merge = this->output_path + mesh.GetMeshName() + "_data_" + std::to_string(step) + ".vtu";
-        std::ofstream file_merge(file_name_merge, std::ios_base::binary);
+        mesh.CallForElement(elt_stations.first, [&survey_points](auto& elt) { elt.SetSurveyPoints(survey_points); });
+    }
 
-        file_merge << file_geom_head.rdbuf() << file_data.rdbuf() << file_geom_foot.rdbuf();
+    if (this->writing_log_file) {
+        this->log_file << "Located " << this->station_IDs.size() << " of " << this->station_coordinates.size()
+                       << " stations in " << mesh.GetMeshName() << " mesh" << std::endl;
+    }
 
-        file_merge.close();
-        file_geom_head.close();
-        file_geom_foot.close();
-        file_data.close();
+    if (this->station_IDs.empty()) {
+        return;
     }
 
-    if (this->writing_modal_output && (stepper.GetStep() % this->modal_output_frequency == 0)) {
-        ProblemType::write_modal_data(stepper, mesh, this->output_path);
+    const std::string file_name = this->output_path + mesh.GetMeshName() + "_stations.bin";
+
+    // a restarted simulation continues the series written into the same output directory before the checkpoint
+    if (stepper.GetStep() != 0 && Utilities::file_exists(file_name)) {
+        this->station_file = std::ofstream(file_name, std::ios::binary | std::ios::app);
+
+        return;
+    }
+
+    // header: number of stations located in this submesh followed by their indices in the station file,
+    // then one record per output step: time followed by ze, u, v of every station
+    this->station_file = std::ofstream(file_name, std::ios::binary);
+
+    const std::uint32_t n_stations = this->station_IDs.size();
+
+    this->station_file.write("DGSWESTA", 8);
+    this->station_file.write((const char*)&n_stations, sizeof(std::uint32_t));
+
+    for (const uint station : this->station_IDs) {
+        const std::uint32_t station_ID = station;
+        this->station_file.write((const char*)&station_ID, sizeof(std::uint32_t));
+    }
+}
+
+template <typename ProblemType>
+void Writer<ProblemType>::WriteStationOutput(const typename ProblemType::ProblemStepperType& stepper,
+                                             typename ProblemType::ProblemMeshType& mesh) {
+    if (this->station_IDs.empty()) {
+        return;
+    }
+
+    this->station_data.clear();
+    this->station_data.push_back(stepper.GetTimeAtCurrentStage());
+
+    ProblemType::write_station_data(mesh, this->station_element_IDs, this->station_data);
+
+    this->station_file.write((const char*)this->station_data.data(), this->station_data.size() * sizeof(double));
+
+    // records are small, flushing each one keeps the series complete up to the last output if the run aborts
+    this->station_file.flush();
+
+    if (!this->station_file) {
+        throw std::logic_error("Fatal Error: unable to write station output of " + mesh.GetMeshName() + "\n");
+    }
+}
+
+template <typename ProblemType>
+void Writer<ProblemType>::WriteExtrema(typename ProblemType::ProblemMeshType& mesh) {
+    const std::string file_name = this->output_path + mesh.GetMeshName() + "_extrema.vtu";
+
+    // replaced at every checkpoint, write to a temporary file first so that the previous one survives a failure
+    std::ofstream file(file_name + ".tmp", std::ios_base::binary);
+
+    file << *this->vtu_geom_head;
+
+    ProblemType::write_extrema_VTU_data(this->extrema, file, this->vtu_format);
+
+    file << *this->vtu_geom_foot;
+
+    file.close();
+
+    if (!file || std::rename((file_name + ".tmp").c_str(), file_name.c_str()) != 0) {
+        throw std::logic_error("Fatal Error: unable to write extrema " + file_name + "\n");
     }
 }
 
@@ -218,7 +562,7 @@ void Writer<ProblemType>::InitializeMeshGeometryVTK(typename ProblemType::Proble
     AlignedVector<Point<3>> points;
     Array2D<uint> cells;
 
-    mesh.CallForEachElement([&points, &cells](auto& elem) { elem.InitializeVTK(points, cells); });
+    mesh.CallForEachOwnedElement([&points, &cells](auto& elem) { elem.InitializeVTK(points, cells); });
 
     std::ofstream file(this->vtk_file_name_geom);
 
@@ -283,34 +627,42 @@ void Writer<ProblemType>::InitializeMeshGeometryVTU(typename ProblemType::Proble
     AlignedVector<Point<3>> points;
     Array2D<uint> cells;
 
-    mesh.CallForEachElement([&points, &cells](auto& elem) { elem.InitializeVTK(points, cells); });
+    mesh.CallForEachOwnedElement([&points, &cells](auto& elem) { elem.InitializeVTK(points, cells); });
 
-    std::ofstream file(this->vtu_file_name_geom_head);
+    std::ostringstream file;
 
     file << "<?xml version=\"1.0\"?>\n";
-    file << "<VTKFile type=\"UnstructuredGrid\">\n";
+    file << "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" byte_order=\"LittleEndian\"";
+    if (this->vtu_format == Utilities::VTUFormat::compressed) {
+        file << " compressor=\"vtkZLibDataCompressor\"";
+    }
+    file << ">\n";
     file << "\t<UnstructuredGrid>\n";
     file << "\t\t<Piece NumberOfPoints=\"" << points.size() << "\" NumberOfCells=\"" << cells.size() << "\">\n";
 
-    file.close();
+    this->vtu_geom_head = std::make_shared<const std::string>(file.str());
 
-    file = std::ofstream(this->vtu_file_name_geom_foot);
+    file.str(std::string());
 
-    file << "\t\t\t<Points>\n";
-    file << "\t\t\t\t<DataArray type=\"Float64\" NumberOfComponents=\"3\" format=\"ascii\">\n\t\t\t\t\t";
+    std::vector<double> point_coordinates;
+    point_coordinates.reserve(3 * points.size());
 
     for (auto& point : points) {
-        file << point[0] << ' ' << point[1] << ' ' << point[2] << ' ';
+        point_coordinates.push_back(point[0]);
+        point_coordinates.push_back(point[1]);
+        point_coordinates.push_back(point[2]);
     }
 
-    file << "\n\t\t\t\t</DataArray>\n";
+    file << "\t\t\t<Points>\n";
+    Utilities::write_VTU_data_array(file, "", 3, point_coordinates, this->vtu_format);
     file << "\t\t\t</Points>\n";
 
-    file << "\t\t\t<Cells>\n";
-
-    file << "\t\t\t\t<DataArray type=\"Int32\" Name=\"connectivity\" format=\"ascii\">\n\t\t\t\t\t";
+    std::vector<std::int32_t> connectivity;
+    std::vector<std::int32_t> offsets;
+    std::vector<std::uint8_t> types;
 
     uint n_nodes;
+    uint offset = 0;
 
     for (auto& cell : cells) {
         switch (cell[0]) {
@@ -325,47 +677,144 @@ void Writer<ProblemType>::InitializeMeshGeometryVTU(typename ProblemType::Proble
         }
 
         for (uint i = 1; i <= n_nodes; ++i) {
-            file << cell[i] << ' ';
+            connectivity.push_back(cell[i]);
         }
+
+        offset += n_nodes;
+        offsets.push_back(offset);
+
+        types.push_back(cell[0]);
     }
 
-    file << "\n\t\t\t\t</DataArray>\n";
+    file << "\t\t\t<Cells>\n";
+    Utilities::write_VTU_data_array(file, "connectivity", 1, connectivity, this->vtu_format);
+    Utilities::write_VTU_data_array(file, "offsets", 1, offsets, this->vtu_format);
+    Utilities::write_VTU_data_array(file, "types", 1, types, this->vtu_format);
+    file << "\t\t\t</Cells>\n";
+
+    file << "\t\t</Piece>\n";
+    file << "\t</UnstructuredGrid>\n";
+    file << "</VTKFile>\n";
 
-    file << "\t\t\t\t<DataArray type=\"Int32\" Name=\"offsets\" format=\"ascii\">\n\t\t\t\t\t";
+    this->vtu_geom_foot = std::make_shared<const std::string>(file.str());
+}
 
-    uint offset = 0;
+/**
+ * Merge the station output of all submeshes into a single CSV file in the output directory.
+ * Submeshes write their stations into their own output directory, which is a subdirectory of the output path in
+ * parallel runs. A station found by more than one submesh is taken from the first file in alphabetical order.
+ * Must be called once all writers have finished.
+ *
+ * @param writer_input writer input of the simulation
+ */
+inline void merge_station_output(const WriterInput& writer_input) {
+    std::vector<std::string> file_names;
+
+    const auto find_station_files = [&file_names](const std::string& path, const bool recurse, const auto& find) {
+        DIR* dir = opendir(path.c_str());
+
+        if (!dir) {
+            return;
+        }
 
-    for (auto& cell : cells) {
-        switch (cell[0]) {
-            case VTKElementTypes::straight_triangle:
-                offset += 3;
-                file << offset << ' ';
-                break;
-            default:
-                printf("\n");
-                printf("MESH InitializeVTK - Fatal error!\n");
-                printf("Undefined cell type = %d\n", cell[0]);
-                exit(1);
+        const std::string postfix("_stations.bin");
+
+        while (dirent* entry = readdir(dir)) {
+            const std::string name(entry->d_name);
+
+            if (name == "." || name == "..") {
+                continue;
+            }
+
+            const bool is_station_file = name.size() > postfix.size() &&
+                                         name.compare(name.size() - postfix.size(), postfix.size(), postfix) == 0;
+
+            if (is_station_file) {
+                file_names.push_back(path + name);
+            } else if (recurse) {
+                find(path + name + '/', false, find);
+            }
         }
-    }
 
-    file << "\n\t\t\t\t</DataArray>\n";
+        closedir(dir);
+    };
 
-    file << "\t\t\t\t<DataArray type=\"UInt8\" Name=\"types\" format=\"ascii\">\n\t\t\t\t\t";
+    find_station_files(writer_input.output_path, true, find_station_files);
 
-    for (auto& cell : cells) {
-        file << cell[0] << ' ';
+    std::sort(file_names.begin(), file_names.end());
+
+    const uint n_stations = writer_input.station_names.size();
+
+    // per station: time, ze, u, v of every record
+    std::vector<std::vector<double>> station_series(n_stations);
+    std::vector<bool> station_found(n_stations, false);
+
+    for (const std::string& file_name : file_names) {
+        std::ifstream file(file_name, std::ios::binary);
+
+        std::array<char, 8> magic;
+        std::uint32_t n_file_stations = 0;
+
+        file.read(magic.data(), 8);
+        file.read((char*)&n_file_stations, sizeof(std::uint32_t));
+
+        if (!file || std::string(magic.data(), 8) != "DGSWESTA") {
+            throw std::logic_error("Fatal Error: " + file_name + " is not a station output file\n");
+        }
+
+        std::vector<std::uint32_t> file_station_IDs(n_file_stations);
+        file.read((char*)file_station_IDs.data(), n_file_stations * sizeof(std::uint32_t));
+
+        std::vector<bool> taken(n_file_stations);
+
+        for (uint spt = 0; spt < n_file_stations; ++spt) {
+            if (file_station_IDs[spt] >= n_stations) {
+                throw std::logic_error("Fatal Error: " + file_name + " does not match the station file\n");
+            }
+
+            taken[spt] = !station_found[file_station_IDs[spt]];
+
+            station_found[file_station_IDs[spt]] = true;
+        }
+
+        std::vector<double> record(1 + 3 * n_file_stations);
+
+        // a record cut short by an aborted run is dropped
+        while (file.read((char*)record.data(), record.size() * sizeof(double))) {
+            for (uint spt = 0; spt < n_file_stations; ++spt) {
+                if (taken[spt]) {
+                    std::vector<double>& series = station_series[file_station_IDs[spt]];
+
+                    // records written after the checkpoint a simulation was restarted from are superseded
+                    while (!series.empty() && series[series.size() - 4] >= record[0]) {
+                        series.resize(series.size() - 4);
+                    }
+
+                    series.push_back(record[0]);
+                    series.insert(series.end(), &record[1 + 3 * spt], &record[1 + 3 * spt] + 3);
+                }
+            }
+        }
     }
 
-    file << "\n\t\t\t\t</DataArray>\n";
+    std::ofstream file(writer_input.output_path + "stations.csv");
 
-    file << "\t\t\t</Cells>\n";
+    file << "station,time,ze,u,v\n";
+    file << std::setprecision(12);
 
-    file << "\t\t</Piece>\n";
-    file << "\t</UnstructuredGrid>\n";
-    file << "</VTKFile>\n";
+    for (uint station = 0; station < n_stations; ++station) {
+        if (!station_found[station]) {
+            std::cerr << "Warning: station " << writer_input.station_names[station]
+                      << " is not located in any element of the mesh\n";
+        }
 
-    file.close();
+        const std::vector<double>& series = station_series[station];
+
+        for (uint rec = 0; rec < series.size(); rec += 4) {
+            file << writer_input.station_names[station] << ',' << series[rec] << ',' << series[rec + 1] << ','
+                 << series[rec + 2] << ',' << series[rec + 3] << '\n';
+        }
+    }
 }
 
 #endif
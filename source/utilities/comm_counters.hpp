@@ -0,0 +1,268 @@
+#ifndef COMM_COUNTERS_HPP
+#define COMM_COUNTERS_HPP
+
+#include "general_definitions.hpp"
+
+namespace Utilities {
+/**
+ * Traffic and wait time of one communication type over one rank boundary.
+ * The communicators only count when HAS_COMM_PROFILER is defined (cmake option COMM_PROFILER). Wait times are the
+ * time the simulation unit was blocked on this boundary, as charged by a WaitCharger.
+ */
+struct CommCounters {
+    std::uint64_t messages_sent     = 0;
+    std::uint64_t bytes_sent        = 0;
+    std::uint64_t messages_received = 0;
+    std::uint64_t bytes_received    = 0;
+
+    double send_wait_seconds    = 0.0;
+    double receive_wait_seconds = 0.0;
+
+    void CountSend(const std::uint64_t n_bytes) {
+        ++this->messages_sent;
+        this->bytes_sent += n_bytes;
+    }
+
+    void CountReceive(const std::uint64_t n_bytes) {
+        ++this->messages_received;
+        this->bytes_received += n_bytes;
+    }
+
+    CommCounters& operator+=(const CommCounters& rhs) {
+        this->messages_sent += rhs.messages_sent;
+        this->bytes_sent += rhs.bytes_sent;
+        this->messages_received += rhs.messages_received;
+        this->bytes_received += rhs.bytes_received;
+        this->send_wait_seconds += rhs.send_wait_seconds;
+        this->receive_wait_seconds += rhs.receive_wait_seconds;
+
+        return *this;
+    }
+
+#ifdef HAS_HPX
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned) {
+        // clang-format off
+        ar  & messages_sent
+            & bytes_sent
+            & messages_received
+            & bytes_received
+            & send_wait_seconds
+            & receive_wait_seconds;
+        // clang-format on
+    }
+#endif
+};
+
+/**
+ * Splits the time blocked in a wait on several messages among their rank boundaries. Each arrival is charged the
+ * time since the previous arrival, or since the start of the wait, so that the charges add up to the time blocked
+ * and a slow neighbor is charged the time it alone held up the wait. Arrivals must be charged in order.
+ */
+class WaitCharger {
+  public:
+    using clock_t = std::chrono::steady_clock;
+
+  private:
+    clock_t::time_point last;
+
+  public:
+    explicit WaitCharger(const clock_t::time_point wait_begin) : last(wait_begin) {}
+
+    double Charge(const clock_t::time_point arrival) {
+        if (arrival <= this->last) {
+            return 0.0;
+        }
+
+        const double seconds = std::chrono::duration<double>(arrival - this->last).count();
+
+        this->last = arrival;
+
+        return seconds;
+    }
+};
+
+/**
+ * Communication counters of one rank boundary, by communication type (CommTypes of the problem).
+ */
+struct CommCountersRecord {
+    uint locality_in;
+    uint submesh_in;
+    uint locality_ex;
+    uint submesh_ex;
+
+    std::vector<CommCounters> counters;
+
+#ifdef HAS_HPX
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned) {
+        // clang-format off
+        ar  & locality_in
+            & submesh_in
+            & locality_ex
+            & submesh_ex
+            & counters;
+        // clang-format on
+    }
+#endif
+};
+
+/**
+ * Sum the counters of all rank boundaries and communication types by pair of ranks.
+ *
+ * @param records communication counters of all rank boundaries
+ * @return counters indexed by [rank][neighbor rank], submesh boundaries within a rank fall on the diagonal
+ */
+inline std::vector<std::vector<CommCounters>> get_neighbor_matrix(const std::vector<CommCountersRecord>& records) {
+    uint n_localities = 0;
+
+    for (const CommCountersRecord& record : records) {
+        n_localities = std::max(n_localities, std::max(record.locality_in, record.locality_ex) + 1);
+    }
+
+    std::vector<std::vector<CommCounters>> matrix(n_localities, std::vector<CommCounters>(n_localities));
+
+    for (const CommCountersRecord& record : records) {
+        for (const CommCounters& counters : record.counters) {
+            matrix[record.locality_in][record.locality_ex] += counters;
+        }
+    }
+
+    return matrix;
+}
+
+/**
+ * Print the traffic and wait times between each pair of ranks that communicate, and totals by communication type.
+ *
+ * @param out stream to print the tables to
+ * @param records communication counters of all rank boundaries
+ */
+inline void write_comm_counters_summary(std::ostream& out, const std::vector<CommCountersRecord>& records) {
+    const std::vector<std::vector<CommCounters>> matrix = get_neighbor_matrix(records);
+
+    const auto write_row = [&out](const CommCounters& counters) {
+        out << std::right << std::setw(12) << counters.messages_sent << std::fixed << std::setprecision(3)
+            << std::setw(14) << 1.0e-6 * counters.bytes_sent << std::setw(14) << 1.0e-6 * counters.bytes_received
+            << std::setprecision(4) << std::setw(15) << counters.receive_wait_seconds << std::setw(15)
+            << counters.send_wait_seconds << std::defaultfloat << std::endl;
+    };
+
+    out << std::endl
+        << "Communication of " << records.size() << " rank boundaries on " << matrix.size() << " ranks" << std::endl
+        << std::left << std::setw(10) << "rank" << std::setw(10) << "neighbor" << std::right << std::setw(12)
+        << "messages" << std::setw(14) << "sent (MB)" << std::setw(14) << "received (MB)" << std::setw(15)
+        << "recv wait (s)" << std::setw(15) << "send wait (s)" << std::endl;
+
+    for (uint rank = 0; rank < matrix.size(); ++rank) {
+        for (uint neighbor = 0; neighbor < matrix.size(); ++neighbor) {
+            const CommCounters& counters = matrix[rank][neighbor];
+
+            if (counters.messages_sent == 0 && counters.messages_received == 0) {
+                continue;
+            }
+
+            out << std::left << std::setw(10) << rank << std::setw(10) << neighbor;
+            write_row(counters);
+        }
+    }
+
+    std::vector<CommCounters> comm_type_totals;
+
+    for (const CommCountersRecord& record : records) {
+        comm_type_totals.resize(std::max(comm_type_totals.size(), record.counters.size()));
+
+        for (uint comm_type = 0; comm_type < record.counters.size(); ++comm_type) {
+            comm_type_totals[comm_type] += record.counters[comm_type];
+        }
+    }
+
+    out << std::left << std::setw(20) << "comm type" << std::right << std::setw(12) << "messages" << std::setw(14)
+        << "sent (MB)" << std::setw(14) << "received (MB)" << std::setw(15) << "recv wait (s)" << std::setw(15)
+        << "send wait (s)" << std::endl;
+
+    for (uint comm_type = 0; comm_type < comm_type_totals.size(); ++comm_type) {
+        out << std::left << std::setw(20) << comm_type;
+        write_row(comm_type_totals[comm_type]);
+    }
+
+    out << std::endl;
+}
+
+/**
+ * Write the communication counters as a neighbor matrix of ranks together with the counters of every rank boundary.
+ * Layout: {"ranks": n, "matrix": {"<counter>": [[value by neighbor rank] by rank]}, "boundaries": [{"rank": id,
+ * "submesh": id, "neighbor_rank": id, "neighbor_submesh": id, "counters": [counters by comm type]}]} with counters
+ * {"messages_sent": n, "bytes_sent": n, "messages_received": n, "bytes_received": n, "send_wait_seconds": s,
+ * "receive_wait_seconds": s}. The matrix sums over submeshes and communication types.
+ *
+ * @param file_name name of the JSON file
+ * @param records communication counters of all rank boundaries
+ */
+inline void write_comm_counters_json(const std::string& file_name, const std::vector<CommCountersRecord>& records) {
+    std::ofstream file(file_name);
+
+    if (!file) {
+        throw std::logic_error("Fatal Error: unable to open communication counters file " + file_name + "\n");
+    }
+
+    file << std::setprecision(9);
+
+    const std::vector<std::vector<CommCounters>> matrix = get_neighbor_matrix(records);
+
+    const auto write_matrix = [&file, &matrix](const std::string& name, const auto& get_value) {
+        file << "    \"" << name << "\": [";
+
+        for (uint rank = 0; rank < matrix.size(); ++rank) {
+            file << (rank ? ", [" : "[");
+
+            for (uint neighbor = 0; neighbor < matrix.size(); ++neighbor) {
+                file << (neighbor ? ", " : "") << get_value(matrix[rank][neighbor]);
+            }
+
+            file << ']';
+        }
+
+        file << ']';
+    };
+
+    file << "{\n  \"ranks\": " << matrix.size() << ",\n  \"matrix\": {\n";
+
+    write_matrix("messages_sent", [](const CommCounters& counters) { return counters.messages_sent; });
+    file << ",\n";
+    write_matrix("bytes_sent", [](const CommCounters& counters) { return counters.bytes_sent; });
+    file << ",\n";
+    write_matrix("messages_received", [](const CommCounters& counters) { return counters.messages_received; });
+    file << ",\n";
+    write_matrix("bytes_received", [](const CommCounters& counters) { return counters.bytes_received; });
+    file << ",\n";
+    write_matrix("send_wait_seconds", [](const CommCounters& counters) { return counters.send_wait_seconds; });
+    file << ",\n";
+    write_matrix("receive_wait_seconds", [](const CommCounters& counters) { return counters.receive_wait_seconds; });
+
+    file << "\n  },\n  \"boundaries\": [";
+
+    for (uint id = 0; id < records.size(); ++id) {
+        const CommCountersRecord& record = records[id];
+
+        file << (id ? ",\n" : "\n") << "    {\"rank\": " << record.locality_in << ", \"submesh\": " << record.submesh_in
+             << ", \"neighbor_rank\": " << record.locality_ex << ", \"neighbor_submesh\": " << record.submesh_ex
+             << ", \"counters\": [";
+
+        for (uint comm_type = 0; comm_type < record.counters.size(); ++comm_type) {
+            const CommCounters& counters = record.counters[comm_type];
+
+            file << (comm_type ? ", " : "") << "{\"messages_sent\": " << counters.messages_sent
+                 << ", \"bytes_sent\": " << counters.bytes_sent << ", \"messages_received\": "
+                 << counters.messages_received << ", \"bytes_received\": " << counters.bytes_received
+                 << ", \"send_wait_seconds\": " << counters.send_wait_seconds
+                 << ", \"receive_wait_seconds\": " << counters.receive_wait_seconds << '}';
+        }
+
+        file << "]}";
+    }
+
+    file << "\n  ]\n}\n";
+}
+}
+
+#endif
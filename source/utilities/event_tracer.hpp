@@ -0,0 +1,170 @@
+#ifndef EVENT_TRACER_HPP
+#define EVENT_TRACER_HPP
+
+#include <atomic>
+#include <mutex>
+
+#include "general_definitions.hpp"
+
+namespace Utilities {
+/**
+ * Timed event of a simulation unit, optionally tied to a neighboring submesh.
+ */
+struct TraceEvent {
+    using clock_t = std::chrono::steady_clock;
+
+    // names and categories are string literals
+    const char* name;
+    const char* category;
+
+    clock_t::time_point begin;
+    clock_t::time_point end;
+
+    uint submesh_id;
+
+    int neighbor_locality;
+    int neighbor_submesh;
+};
+
+/**
+ * Ring buffer of the events recorded by one thread. Only the owning thread pushes, so recording takes no lock; once
+ * full, the oldest events are overwritten.
+ */
+class TraceBuffer {
+  public:
+    static constexpr std::uint64_t capacity = 1 << 16;
+
+  private:
+    std::vector<TraceEvent> events;
+    std::atomic<std::uint64_t> n_pushed{0};
+
+  public:
+    TraceBuffer() : events(capacity) {}
+
+    void Push(const TraceEvent& event) {
+        const std::uint64_t position = this->n_pushed.load(std::memory_order_relaxed);
+
+        this->events[position % capacity] = event;
+
+        this->n_pushed.store(position + 1, std::memory_order_release);
+    }
+
+    std::uint64_t GetNumberPushed() const { return this->n_pushed.load(std::memory_order_acquire); }
+    const TraceEvent& GetEvent(const std::uint64_t position) const { return this->events[position % capacity]; }
+};
+
+/**
+ * Process wide recorder of timeline events, written as Chrome trace JSON (chrome://tracing, ui.perfetto.dev).
+ * Every thread records into its own TraceBuffer. Timestamps are taken relative to an epoch, which each rank sets
+ * right after a barrier following MPI_Init, so that the traces of all ranks share a time axis and can be merged
+ * with scripts/trace/merge_traces.py. In a trace the process is the rank and the thread is the submesh.
+ * Events are recorded by the STOP_KERNEL_PHASE macro when HAS_EVENT_TRACER is defined (cmake option EVENT_TRACER).
+ */
+class EventTracer {
+  public:
+    using clock_t = TraceEvent::clock_t;
+
+  private:
+    clock_t::time_point epoch = clock_t::now();
+
+    std::mutex buffers_mutex;
+    std::vector<std::unique_ptr<TraceBuffer>> buffers;
+
+  public:
+    static EventTracer& Get() {
+        static EventTracer tracer;
+
+        return tracer;
+    }
+
+    void SetEpoch(const clock_t::time_point epoch) { this->epoch = epoch; }
+
+    void Record(const char* name,
+                const char* category,
+                const clock_t::time_point begin,
+                const clock_t::time_point end,
+                const uint submesh_id,
+                const int neighbor_locality = -1,
+                const int neighbor_submesh  = -1) {
+        thread_local TraceBuffer& buffer = this->AddBuffer();
+
+        buffer.Push(TraceEvent{name, category, begin, end, submesh_id, neighbor_locality, neighbor_submesh});
+    }
+
+    /**
+     * Write the events recorded so far. Events still being recorded by other threads may be missing.
+     *
+     * @param file_name name of the Chrome trace JSON file
+     * @param locality_id rank the trace belongs to, used as the process ID
+     */
+    void WriteChromeTrace(const std::string& file_name, const uint locality_id);
+
+  private:
+    TraceBuffer& AddBuffer() {
+        std::lock_guard<std::mutex> lock(this->buffers_mutex);
+
+        this->buffers.emplace_back(new TraceBuffer());
+
+        return *this->buffers.back();
+    }
+};
+
+inline void EventTracer::WriteChromeTrace(const std::string& file_name, const uint locality_id) {
+    std::ofstream file(file_name);
+
+    if (!file) {
+        throw std::logic_error("Fatal Error: unable to open trace file " + file_name + "\n");
+    }
+
+    std::lock_guard<std::mutex> lock(this->buffers_mutex);
+
+    const auto microseconds = [this](const clock_t::time_point time) {
+        return std::chrono::duration<double, std::micro>(time - this->epoch).count();
+    };
+
+    file << std::fixed << std::setprecision(3) << "{\"traceEvents\": [\n"
+         << "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": " << locality_id
+         << ", \"args\": {\"name\": \"rank " << locality_id << "\"}}";
+
+    std::set<uint> submesh_ids;
+    std::uint64_t n_dropped = 0;
+
+    for (uint thread = 0; thread < this->buffers.size(); ++thread) {
+        const TraceBuffer& buffer = *this->buffers[thread];
+
+        const std::uint64_t n_pushed = buffer.GetNumberPushed();
+        const std::uint64_t first    = n_pushed > TraceBuffer::capacity ? n_pushed - TraceBuffer::capacity : 0;
+
+        n_dropped += first;
+
+        for (std::uint64_t position = first; position < n_pushed; ++position) {
+            const TraceEvent& event = buffer.GetEvent(position);
+
+            submesh_ids.insert(event.submesh_id);
+
+            file << ",\n{\"name\": \"" << event.name << "\", \"cat\": \"" << event.category
+                 << "\", \"ph\": \"X\", \"pid\": " << locality_id << ", \"tid\": " << event.submesh_id
+                 << ", \"ts\": " << microseconds(event.begin) << ", \"dur\": " << microseconds(event.end) -
+                                                                                     microseconds(event.begin)
+                 << ", \"args\": {\"thread\": " << thread;
+
+            if (event.neighbor_locality >= 0) {
+                file << ", \"neighbor_rank\": " << event.neighbor_locality
+                     << ", \"neighbor_submesh\": " << event.neighbor_submesh;
+            }
+
+            file << "}}";
+        }
+    }
+
+    for (const uint submesh_id : submesh_ids) {
+        file << ",\n{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": " << locality_id << ", \"tid\": " << submesh_id
+             << ", \"args\": {\"name\": \"submesh " << submesh_id << "\"}}";
+    }
+
+    file << "\n],\n\"displayTimeUnit\": \"ms\",\n\"otherData\": {\"rank\": " << locality_id
+         << ", \"dropped_events\": " << n_dropped << "}}\n";
+}
+}
+
+#endif
@@ -0,0 +1,65 @@
+#ifndef FUNCTION_TABLE_HPP
+#define FUNCTION_TABLE_HPP
+
+#include "general_definitions.hpp"
+
+namespace Utilities {
+/**
+ * Time dependence declared by a batched space-time function.
+ * A function type FunctionType provides
+ *     static constexpr TimeDependence time_dependence;
+ *     static double time_factor(const double t);
+ *     template <typename ValuesType>
+ *     static void evaluate(const double t, const AlignedVector<Point<2>>& points, ValuesType& values);
+ * where evaluate fills values(variable, point) at all points of an element or boundary at once.
+ * - independent: f(t, x) = f(x), evaluate is called once and t is meaningless.
+ * - separable: f(t, x) = time_factor(t) * g(x), evaluate returns g(x) and is called once, t is meaningless.
+ * - general: evaluate is called at every time, time_factor is unused.
+ */
+enum class TimeDependence : uchar { independent, separable, general };
+
+/**
+ * Tabulate a function at a set of points, if it is not time dependent in general.
+ *
+ * @param points points to tabulate the function at
+ * @param n_variables number of variables of the function
+ * @param table values(variable, point), without points for general functions
+ */
+template <typename FunctionType, typename PointArrayType, typename TableType>
+void tabulate_function(const PointArrayType& points, const uint n_variables, TableType& table) {
+    if (FunctionType::time_dependence == TimeDependence::general) {
+        table.resize(n_variables, 0);
+
+        return;
+    }
+
+    table.resize(n_variables, points.size());
+
+    FunctionType::evaluate(0.0, points, table);
+}
+
+/**
+ * Evaluate a function at a set of points, from its table unless it is time dependent in general.
+ *
+ * @param t time
+ * @param points points to evaluate the function at
+ * @param table values created by tabulate_function at the same points
+ * @param values values(variable, point), sized for the number of variables and points
+ */
+template <typename FunctionType, typename PointArrayType, typename TableType, typename ValuesType>
+void evaluate_function(const double t, const PointArrayType& points, const TableType& table, ValuesType& values) {
+    switch (FunctionType::time_dependence) {
+        case TimeDependence::independent:
+            values = table;
+            break;
+        case TimeDependence::separable:
+            values = FunctionType::time_factor(t) * table;
+            break;
+        case TimeDependence::general:
+            FunctionType::evaluate(t, points, values);
+            break;
+    }
+}
+}
+
+#endif
@@ -0,0 +1,138 @@
+#ifndef ID_MAP_HPP
+#define ID_MAP_HPP
+
+#include "general_definitions.hpp"
+
+namespace Utilities {
+/**
+ * Read-only map from IDs to values, assembled at once from parallel arrays.
+ * If the IDs are contiguous and ascending, which is the usual case for mesh files, values are stored in a dense
+ * array and looked up by offset. Otherwise they are stored in a hash map.
+ * Iteration yields std::pair<uint, const T&>, in ascending ID order for dense storage.
+ */
+template <typename T>
+class IDMap {
+  private:
+    bool dense = true;
+
+    uint first_ID = 0;
+    std::vector<T> dense_values;
+
+    std::unordered_map<uint, T> sparse_values;
+
+  public:
+    class const_iterator {
+      private:
+        const IDMap* id_map;
+        std::size_t index;
+        typename std::unordered_map<uint, T>::const_iterator sparse_it;
+
+      public:
+        const_iterator(const IDMap* id_map,
+                       const std::size_t index,
+                       typename std::unordered_map<uint, T>::const_iterator sparse_it)
+            : id_map(id_map), index(index), sparse_it(sparse_it) {}
+
+        std::pair<uint, const T&> operator*() const {
+            if (this->id_map->dense) {
+                return {this->id_map->first_ID + (uint)this->index, this->id_map->dense_values[this->index]};
+            }
+
+            return {this->sparse_it->first, this->sparse_it->second};
+        }
+
+        const_iterator& operator++() {
+            if (this->id_map->dense) {
+                ++(this->index);
+            } else {
+                ++(this->sparse_it);
+            }
+
+            return *this;
+        }
+
+        bool operator!=(const const_iterator& rhs) const {
+            return this->index != rhs.index || this->sparse_it != rhs.sparse_it;
+        }
+    };
+
+    IDMap() = default;
+
+    /**
+     * Assemble the map.
+     *
+     * @param IDs IDs of the values
+     * @param values values, in the order of IDs
+     */
+    void assign(const std::vector<uint>& IDs, std::vector<T>&& values) {
+        this->dense = true;
+        for (std::size_t i = 1; i < IDs.size(); ++i) {
+            if (IDs[i] != IDs[0] + i) {
+                this->dense = false;
+                break;
+            }
+        }
+
+        this->dense_values.clear();
+        this->sparse_values.clear();
+
+        if (this->dense) {
+            this->first_ID     = IDs.empty() ? 0 : IDs.front();
+            this->dense_values = std::move(values);
+
+            return;
+        }
+
+        this->sparse_values.reserve(IDs.size());
+
+        for (std::size_t i = 0; i < IDs.size(); ++i) {
+            if (!this->sparse_values.insert({IDs[i], std::move(values[i])}).second) {
+                throw std::logic_error("Fatal Error: ID " + std::to_string(IDs[i]) + " is defined twice!\n");
+            }
+        }
+    }
+
+    std::size_t size() const { return this->dense ? this->dense_values.size() : this->sparse_values.size(); }
+
+    std::size_t count(const uint ID) const {
+        if (this->dense) {
+            return (ID >= this->first_ID && ID - this->first_ID < this->dense_values.size()) ? 1 : 0;
+        }
+
+        return this->sparse_values.count(ID);
+    }
+
+    const T& at(const uint ID) const {
+        if (this->dense) {
+            if (!this->count(ID)) {
+                throw std::out_of_range("Fatal Error: ID " + std::to_string(ID) + " is not defined!\n");
+            }
+
+            return this->dense_values[ID - this->first_ID];
+        }
+
+        return this->sparse_values.at(ID);
+    }
+
+    const_iterator begin() const { return const_iterator(this, 0, this->sparse_values.cbegin()); }
+    const_iterator end() const {
+        return const_iterator(this, this->dense ? this->dense_values.size() : 0, this->sparse_values.cend());
+    }
+
+    friend bool operator==(const IDMap& lhs, const IDMap& rhs) {
+        if (lhs.size() != rhs.size()) {
+            return false;
+        }
+
+        for (const auto& id_value : lhs) {
+            if (!rhs.count(id_value.first) || !(rhs.at(id_value.first) == id_value.second)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+};
+}
+
+#endif
@@ -0,0 +1,291 @@
+#ifndef KERNEL_TIMERS_HPP
+#define KERNEL_TIMERS_HPP
+
+#include "general_definitions.hpp"
+
+#ifdef HAS_EVENT_TRACER
+#include "event_tracer.hpp"
+#endif
+
+namespace Utilities {
+/**
+ * Phases of a time step timed by KernelTimers.
+ * - update: application of the inverse mass matrix and stepper update
+ * - comm_start: posting receives and starting sends
+ * - halo_wait: waiting for distributed boundary data
+ * - comm_complete: waiting for sends to complete
+ */
+enum class KernelPhase : uchar {
+    volume,
+    source,
+    interface,
+    boundary,
+    distributed_boundary,
+    update,
+    wetting_drying,
+    slope_limiter,
+    scrutinize,
+    comm_start,
+    halo_wait,
+    comm_complete,
+    output,
+    parse
+};
+
+constexpr uint n_kernel_phases = (uint)KernelPhase::parse + 1;
+
+/**
+ * Wall time spent and number of timed spans in each kernel phase of a simulation unit.
+ * The timers are only started and stopped by the START_KERNEL_PHASE and STOP_KERNEL_PHASE macros, which expand to
+ * nothing unless HAS_KERNEL_TIMERS or HAS_EVENT_TRACER is defined (cmake options KERNEL_TIMERS, EVENT_TRACER). With
+ * HAS_EVENT_TRACER every timed span is also recorded as a trace event. A simulation unit is stepped by one thread at
+ * a time, so the timers are not synchronized.
+ */
+class KernelTimers {
+  public:
+    using clock_t = std::chrono::steady_clock;
+
+  private:
+    std::array<double, n_kernel_phases> seconds{};
+    std::array<std::uint64_t, n_kernel_phases> calls{};
+
+    std::array<clock_t::time_point, n_kernel_phases> starts;
+
+    uint submesh_id = 0;
+
+  public:
+    static const char* GetPhaseName(const uint phase);
+    static const char* GetPhaseCategory(const uint phase);
+
+    void SetSubmeshID(const uint submesh_id) { this->submesh_id = submesh_id; }
+
+    void Start(const KernelPhase phase) { this->starts[(uint)phase] = clock_t::now(); }
+    void Stop(const KernelPhase phase) {
+        const uint id                  = (uint)phase;
+        const clock_t::time_point stop = clock_t::now();
+
+        this->seconds[id] += std::chrono::duration<double>(stop - this->starts[id]).count();
+        ++this->calls[id];
+
+#ifdef HAS_EVENT_TRACER
+        EventTracer::Get().Record(GetPhaseName(id), GetPhaseCategory(id), this->starts[id], stop, this->submesh_id);
+#endif
+    }
+
+    double GetSeconds(const uint phase) const { return this->seconds[phase]; }
+    double GetSeconds(const KernelPhase phase) const { return this->seconds[(uint)phase]; }
+    std::uint64_t GetCalls(const uint phase) const { return this->calls[phase]; }
+    std::uint64_t GetCalls(const KernelPhase phase) const { return this->calls[(uint)phase]; }
+    double GetTotalSeconds() const { return std::accumulate(this->seconds.begin(), this->seconds.end(), 0.0); }
+
+    void Set(const uint phase, const double seconds, const std::uint64_t calls) {
+        this->seconds[phase] = seconds;
+        this->calls[phase]   = calls;
+    }
+
+    KernelTimers& operator+=(const KernelTimers& rhs);
+
+#ifdef HAS_HPX
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned) {
+        // clang-format off
+        ar  & seconds
+            & calls
+            & submesh_id;
+        // clang-format on
+    }
+#endif
+};
+
+inline const char* KernelTimers::GetPhaseName(const uint phase) {
+    static constexpr std::array<const char*, n_kernel_phases> names{{"volume",
+                                                                     "source",
+                                                                     "interface",
+                                                                     "boundary",
+                                                                     "distributed_boundary",
+                                                                     "update",
+                                                                     "wetting_drying",
+                                                                     "slope_limiter",
+                                                                     "scrutinize",
+                                                                     "comm_start",
+                                                                     "halo_wait",
+                                                                     "comm_complete",
+                                                                     "output",
+                                                                     "parse"}};
+
+    return names[phase];
+}
+
+inline const char* KernelTimers::GetPhaseCategory(const uint phase) {
+    switch ((KernelPhase)phase) {
+        case KernelPhase::comm_start:
+        case KernelPhase::halo_wait:
+        case KernelPhase::comm_complete:
+            return "communication";
+        case KernelPhase::output:
+        case KernelPhase::parse:
+            return "io";
+        default:
+            return "kernel";
+    }
+}
+
+inline KernelTimers& KernelTimers::operator+=(const KernelTimers& rhs) {
+    for (uint phase = 0; phase < n_kernel_phases; ++phase) {
+        this->seconds[phase] += rhs.seconds[phase];
+        this->calls[phase] += rhs.calls[phase];
+    }
+
+    return *this;
+}
+
+/**
+ * Kernel timers of one simulation unit, identified by its rank (locality) and submesh.
+ */
+struct KernelTimersRecord {
+    uint locality_id;
+    uint submesh_id;
+    KernelTimers timers;
+
+#ifdef HAS_HPX
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned) {
+        // clang-format off
+        ar  & locality_id
+            & submesh_id
+            & timers;
+        // clang-format on
+    }
+#endif
+};
+
+/**
+ * Print the time of each phase summed over all simulation units, together with the minimum and maximum over ranks
+ * and the imbalance max / mean over ranks.
+ *
+ * @param out stream to print the table to
+ * @param records kernel timers of all simulation units
+ */
+inline void write_kernel_timers_summary(std::ostream& out, const std::vector<KernelTimersRecord>& records) {
+    std::map<uint, KernelTimers> rank_timers;
+    KernelTimers total;
+
+    for (const KernelTimersRecord& record : records) {
+        rank_timers[record.locality_id] += record.timers;
+        total += record.timers;
+    }
+
+    const double total_seconds = total.GetTotalSeconds();
+
+    out << std::endl
+        << "Kernel timers of " << records.size() << " simulation units on " << rank_timers.size() << " ranks"
+        << std::endl
+        << std::left << std::setw(22) << "phase" << std::right << std::setw(12) << "calls" << std::setw(14)
+        << "total (s)" << std::setw(9) << "share" << std::setw(14) << "rank min (s)" << std::setw(14) << "rank max (s)"
+        << std::setw(11) << "imbalance" << std::endl;
+
+    for (uint phase = 0; phase < n_kernel_phases; ++phase) {
+        double rank_min = std::numeric_limits<double>::max();
+        double rank_max = 0.0;
+
+        for (const auto& rank : rank_timers) {
+            rank_min = std::min(rank_min, rank.second.GetSeconds(phase));
+            rank_max = std::max(rank_max, rank.second.GetSeconds(phase));
+        }
+
+        if (rank_timers.empty()) {
+            rank_min = 0.0;
+        }
+
+        const double seconds   = total.GetSeconds(phase);
+        const double rank_mean = rank_timers.empty() ? 0.0 : seconds / rank_timers.size();
+
+        out << std::left << std::setw(22) << KernelTimers::GetPhaseName(phase) << std::right << std::setw(12)
+            << total.GetCalls(phase) << std::fixed << std::setprecision(4) << std::setw(14) << seconds
+            << std::setprecision(1) << std::setw(8) << (total_seconds > 0.0 ? 100.0 * seconds / total_seconds : 0.0)
+            << '%' << std::setprecision(4) << std::setw(14) << rank_min << std::setw(14) << rank_max
+            << std::setprecision(2) << std::setw(11) << (rank_mean > 0.0 ? rank_max / rank_mean : 1.0)
+            << std::defaultfloat << std::endl;
+    }
+
+    out << std::left << std::setw(22) << "total" << std::right << std::setw(12) << "" << std::fixed
+        << std::setprecision(4) << std::setw(14) << total_seconds << std::defaultfloat << std::endl
+        << std::endl;
+}
+
+/**
+ * Write the kernel timers of all simulation units, and their sums by rank and over all ranks, as JSON.
+ * Layout: {"phases": [names], "total": timers, "ranks": [{"rank": id, "timers": timers}],
+ * "units": [{"rank": id, "submesh": id, "timers": timers}]} with timers {"<phase>": {"seconds": s, "calls": n}}.
+ *
+ * @param file_name name of the JSON file
+ * @param records kernel timers of all simulation units
+ */
+inline void write_kernel_timers_json(const std::string& file_name, const std::vector<KernelTimersRecord>& records) {
+    std::ofstream file(file_name);
+
+    if (!file) {
+        throw std::logic_error("Fatal Error: unable to open kernel timers file " + file_name + "\n");
+    }
+
+    file << std::setprecision(9);
+
+    const auto write_timers = [&file](const KernelTimers& timers) {
+        file << '{';
+
+        for (uint phase = 0; phase < n_kernel_phases; ++phase) {
+            file << (phase ? ", " : "") << '"' << KernelTimers::GetPhaseName(phase)
+                 << "\": {\"seconds\": " << timers.GetSeconds(phase) << ", \"calls\": " << timers.GetCalls(phase)
+                 << '}';
+        }
+
+        file << '}';
+    };
+
+    std::map<uint, KernelTimers> rank_timers;
+    KernelTimers total;
+
+    for (const KernelTimersRecord& record : records) {
+        rank_timers[record.locality_id] += record.timers;
+        total += record.timers;
+    }
+
+    file << "{\n  \"phases\": [";
+
+    for (uint phase = 0; phase < n_kernel_phases; ++phase) {
+        file << (phase ? ", " : "") << '"' << KernelTimers::GetPhaseName(phase) << '"';
+    }
+
+    file << "],\n  \"total\": ";
+    write_timers(total);
+
+    file << ",\n  \"ranks\": [";
+
+    for (auto rank = rank_timers.begin(); rank != rank_timers.end(); ++rank) {
+        file << (rank == rank_timers.begin() ? "\n" : ",\n") << "    {\"rank\": " << rank->first << ", \"timers\": ";
+        write_timers(rank->second);
+        file << '}';
+    }
+
+    file << "\n  ],\n  \"units\": [";
+
+    for (uint id = 0; id < records.size(); ++id) {
+        file << (id ? ",\n" : "\n") << "    {\"rank\": " << records[id].locality_id
+             << ", \"submesh\": " << records[id].submesh_id << ", \"timers\": ";
+        write_timers(records[id].timers);
+        file << '}';
+    }
+
+    file << "\n  ]\n}\n";
+}
+}
+
+#if defined(HAS_KERNEL_TIMERS) || defined(HAS_EVENT_TRACER)
+#define START_KERNEL_PHASE(timers, phase) (timers).Start(Utilities::KernelPhase::phase)
+#define STOP_KERNEL_PHASE(timers, phase) (timers).Stop(Utilities::KernelPhase::phase)
+#else
+#define START_KERNEL_PHASE(timers, phase)
+#define STOP_KERNEL_PHASE(timers, phase)
+#endif
+
+#endif
@@ -0,0 +1,154 @@
+#ifndef VTU_DATA_ARRAY_HPP
+#define VTU_DATA_ARRAY_HPP
+
+#include "general_definitions.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+#ifdef HAS_ZLIB
+#include <zlib.h>
+#endif
+
+namespace Utilities {
+enum class VTUFormat : uchar { ascii, binary, compressed };
+
+template <typename T>
+struct VTUTypeName;
+
+template <>
+struct VTUTypeName<float> {
+    static const char* name() { return "Float32"; }
+};
+
+template <>
+struct VTUTypeName<double> {
+    static const char* name() { return "Float64"; }
+};
+
+template <>
+struct VTUTypeName<std::int8_t> {
+    static const char* name() { return "Int8"; }
+};
+
+template <>
+struct VTUTypeName<std::uint8_t> {
+    static const char* name() { return "UInt8"; }
+};
+
+template <>
+struct VTUTypeName<std::int32_t> {
+    static const char* name() { return "Int32"; }
+};
+
+template <>
+struct VTUTypeName<std::uint32_t> {
+    static const char* name() { return "UInt32"; }
+};
+
+/**
+ * Encode a byte sequence in base64 as required by inline binary VTK XML data arrays.
+ *
+ * @param data pointer to the first byte
+ * @param n_bytes number of bytes to encode
+ * @return base64 string (padded with '=')
+ */
+inline std::string base64_encode(const unsigned char* data, const std::size_t n_bytes) {
+    static const char table[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    std::string encoded;
+    encoded.reserve(4 * ((n_bytes + 2) / 3));
+
+    std::size_t i = 0;
+    for (; i + 2 < n_bytes; i += 3) {
+        const uint triple = (uint)data[i] << 16 | (uint)data[i + 1] << 8 | (uint)data[i + 2];
+
+        encoded.push_back(table[(triple >> 18) & 0x3F]);
+        encoded.push_back(table[(triple >> 12) & 0x3F]);
+        encoded.push_back(table[(triple >> 6) & 0x3F]);
+        encoded.push_back(table[triple & 0x3F]);
+    }
+
+    if (i < n_bytes) {
+        const uint triple = (uint)data[i] << 16 | (i + 1 < n_bytes ? (uint)data[i + 1] << 8 : 0);
+
+        encoded.push_back(table[(triple >> 18) & 0x3F]);
+        encoded.push_back(table[(triple >> 12) & 0x3F]);
+        encoded.push_back(i + 1 < n_bytes ? table[(triple >> 6) & 0x3F] : '=');
+        encoded.push_back('=');
+    }
+
+    return encoded;
+}
+
+/**
+ * Write a VTK XML DataArray element.
+ * Binary formats are written inline in base64 with UInt32 headers, so the VTKFile element must declare
+ * byte_order="LittleEndian" and, for the compressed format, compressor="vtkZLibDataCompressor".
+ *
+ * @param file output stream
+ * @param name value of the Name attribute, omitted if empty
+ * @param n_components number of components per tuple, omitted if 1
+ * @param data array values, tuples stored contiguously
+ * @param format ascii, base64 encoded binary, or base64 encoded zlib compressed binary
+ */
+template <typename T>
+void write_VTU_data_array(std::ostream& file,
+                          const std::string& name,
+                          const uint n_components,
+                          const std::vector<T>& data,
+                          const VTUFormat format) {
+    file << "\t\t\t\t<DataArray type=\"" << VTUTypeName<T>::name() << '"';
+    if (!name.empty()) {
+        file << " Name=\"" << name << '"';
+    }
+    if (n_components != 1) {
+        file << " NumberOfComponents=\"" << n_components << '"';
+    }
+    file << " format=\"" << (format == VTUFormat::ascii ? "ascii" : "binary") << "\">\n\t\t\t\t\t";
+
+    const std::uint32_t n_bytes = (std::uint32_t)(data.size() * sizeof(T));
+
+    if (format == VTUFormat::ascii) {
+        for (const T& value : data) {
+            // promote so that 8 bit integers are not written as characters
+            file << +value << ' ';
+        }
+    } else if (format == VTUFormat::binary) {
+        std::vector<unsigned char> bytes(sizeof(std::uint32_t) + n_bytes);
+
+        std::memcpy(bytes.data(), &n_bytes, sizeof(std::uint32_t));
+        std::memcpy(bytes.data() + sizeof(std::uint32_t), data.data(), n_bytes);
+
+        file << base64_encode(bytes.data(), bytes.size());
+    } else if (format == VTUFormat::compressed) {
+#ifdef HAS_ZLIB
+        uLongf n_compressed_bytes = compressBound(n_bytes);
+        std::vector<unsigned char> compressed(n_compressed_bytes);
+
+        const int status = compress(compressed.data(), &n_compressed_bytes, (const Bytef*)data.data(), n_bytes);
+
+        if (status != Z_OK) {
+            throw std::logic_error("Fatal Error: zlib compression of vtu data array " + name + " failed with error " +
+                                   std::to_string(status) + "\n");
+        }
+
+        // single block: number of blocks, block size, last block size, compressed block size
+        std::array<std::uint32_t, 4> header{1, n_bytes, n_bytes, (std::uint32_t)n_compressed_bytes};
+        if (n_bytes == 0) {
+            header = {0, 0, 0, 0};
+            n_compressed_bytes = 0;
+        }
+
+        file << base64_encode((const unsigned char*)header.data(), (header[0] + 3) * sizeof(std::uint32_t))
+             << base64_encode(compressed.data(), n_compressed_bytes);
+#else
+        throw std::logic_error("Fatal Error: compressed vtu output requires zlib support\n");
+#endif
+    }
+
+    file << "\n\t\t\t\t</DataArray>\n";
+}
+}
+
+#endif
@@ -1,5 +1,6 @@
 #include "preprocessor/ADCIRC_reader/adcirc_format.hpp"
 
+#include <fstream>
 #include <iostream>
 
 const static auto compare = [](AdcircFormat meshA, AdcircFormat meshB) -> bool {
@@ -15,6 +16,26 @@ const static auto compare = [](AdcircFormat meshA, AdcircFormat meshB) -> bool {
     return false;
 };
 
+// copy of in_name with CRLF line endings and blank lines between the lines of the node and element tables
+void write_with_blank_lines(const std::string& in_name, const std::string& out_name, const std::size_t n_table_lines) {
+    std::ifstream in_file(in_name);
+    std::ofstream out_file(out_name, std::ios::binary);
+
+    std::string line;
+    for (std::size_t line_number = 0; std::getline(in_file, line); ++line_number) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+
+        out_file << line << "\r\n";
+
+        // line 0 is the mesh name, line 1 holds the table sizes
+        if (line_number >= 1 && line_number < 1 + n_table_lines && line_number % 5 == 1) {
+            out_file << (line_number % 2 ? "\r\n" : " \t\r\n");
+        }
+    }
+}
+
 int main(int argc, char** argv) {
     bool error_found{false};
 
@@ -32,6 +53,32 @@ int main(int argc, char** argv) {
             std::cerr << "Error: in writing and reading mesh " << out_name << '\n';
             error_found = true;
         }
+
+        // the test meshes are smaller than the default chunk size, so mesh1 is parsed sequentially in a single chunk
+        for (std::size_t min_chunk_size : {64, 1000}) {
+            AdcircFormat mesh_chunked(argv[i], min_chunk_size);
+
+            if (!compare(mesh1, mesh_chunked)) {
+                std::cerr << "Error: parsing mesh " << argv[i] << " in chunks of " << min_chunk_size
+                          << " bytes differs from the sequential parse\n";
+                error_found = true;
+            }
+        }
+
+        std::string crlf_name = argv[i];
+        crlf_name             = crlf_name + ".crlf.out";
+
+        write_with_blank_lines(argv[i], crlf_name, mesh1.nodes.size() + mesh1.elements.size());
+
+        for (std::size_t min_chunk_size : {(std::size_t)64, AdcircFormat::default_min_chunk_size}) {
+            AdcircFormat mesh_crlf(crlf_name, min_chunk_size);
+
+            if (!compare(mesh1, mesh_crlf)) {
+                std::cerr << "Error: parsing mesh " << crlf_name << " with blank lines in chunks of " << min_chunk_size
+                          << " bytes differs from the sequential parse\n";
+                error_found = true;
+            }
+        }
     }
 
     return error_found;
@@ -0,0 +1,87 @@
+#include "utilities/comm_counters.hpp"
+#include "test_output_reader.hpp"
+
+int main() {
+    bool error_found = false;
+
+    using clock_t = Utilities::WaitCharger::clock_t;
+
+    const clock_t::time_point wait_begin = clock_t::now();
+
+    // arrivals after 2 ms and 5 ms are charged 2 ms and 3 ms, an arrival before the wait is charged nothing
+    Utilities::WaitCharger charger(wait_begin);
+
+    const double early  = charger.Charge(wait_begin - std::chrono::milliseconds(1));
+    const double first  = charger.Charge(wait_begin + std::chrono::milliseconds(2));
+    const double second = charger.Charge(wait_begin + std::chrono::milliseconds(5));
+
+    if (early != 0.0 || std::abs(first - 0.002) > 1.0e-9 || std::abs(second - 0.003) > 1.0e-9) {
+        std::cerr << "Error in charged wait times" << std::endl;
+        error_found = true;
+    }
+
+    Utilities::CommCounters counters;
+    counters.CountSend(800);
+    counters.CountSend(800);
+    counters.CountReceive(400);
+    counters.receive_wait_seconds = 0.5;
+
+    if (counters.messages_sent != 2 || counters.bytes_sent != 1600 || counters.messages_received != 1 ||
+        counters.bytes_received != 400) {
+        std::cerr << "Error in counting messages" << std::endl;
+        error_found = true;
+    }
+
+    // rank 0 submesh 0 talks to rank 1 submesh 0 and to rank 0 submesh 1, with two communication types
+    std::vector<Utilities::CommCountersRecord> records{
+        Utilities::CommCountersRecord{0, 0, 1, 0, {counters, counters}},
+        Utilities::CommCountersRecord{0, 0, 0, 1, {counters, Utilities::CommCounters()}},
+        Utilities::CommCountersRecord{1, 0, 0, 0, {counters, counters}}};
+
+    const std::vector<std::vector<Utilities::CommCounters>> matrix = Utilities::get_neighbor_matrix(records);
+
+    if (matrix.size() != 2 || matrix[0][1].messages_sent != 4 || matrix[0][1].bytes_sent != 3200 ||
+        matrix[0][0].messages_sent != 2 || matrix[1][0].receive_wait_seconds != 1.0 ||
+        matrix[1][1].messages_sent != 0) {
+        std::cerr << "Error in neighbor matrix" << std::endl;
+        error_found = true;
+    }
+
+    std::stringstream summary;
+    Utilities::write_comm_counters_summary(summary, records);
+
+    // rank rows start with rank and neighbor rank, followed by messages, MB sent and received, and wait seconds
+    const std::vector<std::vector<std::string>> rows = read_rows(summary.str());
+    const std::vector<double> rank_1_row             = find_row_values(rows, {"1", "0"});
+
+    if (find_row_values(rows, {"Communication", "of"}) != std::vector<double>{3, 2} || rank_1_row.size() != 5 ||
+        rank_1_row[0] != 4 || std::abs(rank_1_row[1] - 0.0032) > 1e-3 || rank_1_row[3] != 1.0) {
+        std::cerr << "Error in summary:\n" << summary.str() << std::endl;
+        error_found = true;
+    }
+
+    Utilities::write_comm_counters_json("comm_counters_test.json", records);
+
+    const YAML::Node json                 = read_json("comm_counters_test.json");
+    const YAML::Node bytes_sent           = json["matrix"]["bytes_sent"];
+    const YAML::Node boundary             = json["boundaries"][2];
+    const YAML::Node counters_by_commtype = boundary["counters"];
+
+    if (json["ranks"].as<uint>() != 2 || bytes_sent[0][0].as<uint>() != 1600 || bytes_sent[0][1].as<uint>() != 3200 ||
+        bytes_sent[1][0].as<uint>() != 3200 || bytes_sent[1][1].as<uint>() != 0 || json["boundaries"].size() != 3 ||
+        boundary["rank"].as<uint>() != 1 || boundary["neighbor_rank"].as<uint>() != 0 ||
+        counters_by_commtype.size() != 2 || counters_by_commtype[1]["messages_sent"].as<uint>() != 2 ||
+        counters_by_commtype[1]["bytes_sent"].as<uint>() != 1600 ||
+        counters_by_commtype[1]["receive_wait_seconds"].as<double>() != 0.5) {
+        std::cerr << "Error in JSON output:\n" << json << std::endl;
+        error_found = true;
+    }
+
+    std::remove("comm_counters_test.json");
+
+    if (error_found) {
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,153 @@
+#include "preprocessor/ADCIRC_reader/adcirc_format.hpp"
+#include "preprocessor/mesh_metadata.hpp"
+#include "geometry/element_index.hpp"
+
+// brute force reference: distance from point to the triangle of element
+double distance_to_element(const MeshMetaData& mesh, const uint elt_id, const Point<2>& point) {
+    AlignedVector<Point<3>> nodes = mesh.get_nodal_coordinates(elt_id);
+
+    const double det = (nodes[1][0] - nodes[0][0]) * (nodes[2][1] - nodes[0][1]) -
+                       (nodes[2][0] - nodes[0][0]) * (nodes[1][1] - nodes[0][1]);
+
+    bool inside = true;
+    for (uint edge = 0; edge < 3; ++edge) {
+        const Point<3>& a = nodes[edge];
+        const Point<3>& b = nodes[(edge + 1) % 3];
+
+        const double cross = (b[0] - a[0]) * (point[1] - a[1]) - (b[1] - a[1]) * (point[0] - a[0]);
+        inside &= (det > 0 ? cross >= 0 : cross <= 0);
+    }
+
+    if (inside) {
+        return 0.0;
+    }
+
+    double distance = std::numeric_limits<double>::max();
+    for (uint edge = 0; edge < 3; ++edge) {
+        const Point<3>& a = nodes[edge];
+        const Point<3>& b = nodes[(edge + 1) % 3];
+
+        const double ab_x = b[0] - a[0];
+        const double ab_y = b[1] - a[1];
+        const double t    = std::min(
+            std::max(((point[0] - a[0]) * ab_x + (point[1] - a[1]) * ab_y) / (ab_x * ab_x + ab_y * ab_y), 0.0), 1.0);
+
+        distance = std::min(distance, std::hypot(point[0] - a[0] - t * ab_x, point[1] - a[1] - t * ab_y));
+    }
+
+    return distance;
+}
+
+int main(int argc, char** argv) {
+    bool error_found{false};
+
+    for (int i = 1; i < argc; ++i) {
+        AdcircFormat adcirc_file(argv[i]);
+        MeshMetaData mesh(adcirc_file);
+
+        Geometry::ElementIndex element_index(mesh);
+
+        if (element_index.GetNumberElements() != mesh.elements.size()) {
+            std::cerr << "Error: element index of " << argv[i] << " does not hold all elements\n";
+            error_found = true;
+        }
+
+        // the barycenter of every element is located in that element
+        AlignedVector<Point<2>> barycenters;
+        std::vector<uint> element_IDs;
+
+        double x_min = std::numeric_limits<double>::max();
+        double x_max = std::numeric_limits<double>::lowest();
+        double y_min = std::numeric_limits<double>::max();
+        double y_max = std::numeric_limits<double>::lowest();
+
+        for (const auto& elt : mesh.elements) {
+            AlignedVector<Point<3>> nodes = mesh.get_nodal_coordinates(elt.first);
+
+            Point<2> barycenter;
+            barycenter[0] = (nodes[0][0] + nodes[1][0] + nodes[2][0]) / 3.0;
+            barycenter[1] = (nodes[0][1] + nodes[1][1] + nodes[2][1]) / 3.0;
+
+            barycenters.push_back(barycenter);
+            element_IDs.push_back(elt.first);
+
+            for (const Point<3>& node : nodes) {
+                x_min = std::min(x_min, node[0]);
+                x_max = std::max(x_max, node[0]);
+                y_min = std::min(y_min, node[1]);
+                y_max = std::max(y_max, node[1]);
+            }
+        }
+
+        std::vector<uint> located_IDs = element_index.LocatePoints(barycenters);
+
+        for (uint pt = 0; pt < barycenters.size(); ++pt) {
+            if (located_IDs[pt] != element_IDs[pt] || element_index.LocatePoint(barycenters[pt]) != element_IDs[pt]) {
+                std::cerr << "Error: barycenter of element " << element_IDs[pt] << " of " << argv[i]
+                          << " located in element " << located_IDs[pt] << '\n';
+                error_found = true;
+            }
+        }
+
+        // a binary mesh is indexed through its mapping, its meta data only holds the mesh name
+        std::string binary_out_name = argv[i];
+        binary_out_name             = binary_out_name + ".index.dgm.out";
+
+        BinaryMeshData::write_to(binary_out_name, mesh, DistributedBoundaryMetaData());
+
+        BinaryMeshData binary_mesh(binary_out_name);
+        Geometry::ElementIndex binary_element_index(binary_mesh);
+
+        if (binary_element_index.LocatePoints(barycenters) != located_IDs) {
+            std::cerr << "Error: element index of binary mesh of " << argv[i] << " locates barycenters differently\n";
+            error_found = true;
+        }
+
+        try {
+            MeshMetaData binary_mesh_data;
+            binary_mesh_data.mesh_name = binary_mesh.GetMeshName();
+
+            Geometry::ElementIndex empty_element_index(binary_mesh_data);
+
+            std::cerr << "Error: element index accepted the empty meta data of a binary mesh\n";
+            error_found = true;
+        } catch (const std::logic_error&) {
+        }
+
+        // points around and outside of the mesh: nearest element matches brute force
+        const double dx = x_max - x_min;
+        const double dy = y_max - y_min;
+
+        for (uint j = 0; j <= 20; ++j) {
+            for (uint k = 0; k <= 20; ++k) {
+                Point<2> point;
+                point[0] = x_min - 0.25 * dx + 1.5 * dx * j / 20.0;
+                point[1] = y_min - 0.25 * dy + 1.5 * dy * k / 20.0;
+
+                double min_distance = std::numeric_limits<double>::max();
+                for (const auto& elt : mesh.elements) {
+                    min_distance = std::min(min_distance, distance_to_element(mesh, elt.first, point));
+                }
+
+                const uint nearest_ID = element_index.FindNearestElement(point);
+
+                if (std::abs(distance_to_element(mesh, nearest_ID, point) - min_distance) > 1e-9 * (dx + dy)) {
+                    std::cerr << "Error: nearest element to (" << point[0] << ", " << point[1] << ") of " << argv[i]
+                              << " is not element " << nearest_ID << '\n';
+                    error_found = true;
+                }
+
+                const uint located_ID = element_index.LocatePoint(point);
+
+                if ((min_distance > 0.0 && located_ID != DEFAULT_ID) ||
+                    (located_ID != DEFAULT_ID && distance_to_element(mesh, located_ID, point) != 0.0)) {
+                    std::cerr << "Error: point (" << point[0] << ", " << point[1] << ") of " << argv[i]
+                              << " located in element " << located_ID << '\n';
+                    error_found = true;
+                }
+            }
+        }
+    }
+
+    return error_found;
+}
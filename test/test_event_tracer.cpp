@@ -0,0 +1,96 @@
+#include "utilities/kernel_timers.hpp"
+#include "test_output_reader.hpp"
+
+#include <thread>
+
+int main() {
+    bool error_found = false;
+
+    Utilities::EventTracer& tracer = Utilities::EventTracer::Get();
+    tracer.SetEpoch(Utilities::EventTracer::clock_t::now());
+
+    // two submeshes stepped by separate threads, each recording into its own buffer
+    std::vector<std::thread> threads;
+
+    for (uint submesh_id = 0; submesh_id < 2; ++submesh_id) {
+        threads.emplace_back([submesh_id]() {
+            Utilities::KernelTimers timers;
+            timers.SetSubmeshID(submesh_id);
+
+            START_KERNEL_PHASE(timers, volume);
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            STOP_KERNEL_PHASE(timers, volume);
+
+            START_KERNEL_PHASE(timers, halo_wait);
+            STOP_KERNEL_PHASE(timers, halo_wait);
+        });
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    const Utilities::EventTracer::clock_t::time_point now = Utilities::EventTracer::clock_t::now();
+    tracer.Record("receive", "communication", now, now, 1, 3, 7);
+
+    // overflow the buffer of this thread to drop its oldest events
+    for (std::uint64_t event = 0; event < Utilities::TraceBuffer::capacity + 5; ++event) {
+        tracer.Record("update", "kernel", now, now, 1);
+    }
+
+    tracer.WriteChromeTrace("event_tracer_test.json", 2);
+
+    const YAML::Node json = read_json("event_tracer_test.json");
+
+    uint n_volume = 0, n_halo_wait = 0, n_neighbor = 0;
+    bool submesh_named = false, rank_named = false;
+
+    for (const YAML::Node& event : json["traceEvents"]) {
+        const std::string name = event["name"].as<std::string>();
+        const std::string ph   = event["ph"].as<std::string>();
+
+        if (event["pid"].as<uint>() != 2) {
+            continue;
+        }
+
+        if (ph == "X" && name == "volume" && event["cat"].as<std::string>() == "kernel" &&
+            event["tid"].as<uint>() == 1) {
+            ++n_volume;
+        } else if (ph == "X" && name == "halo_wait" && event["cat"].as<std::string>() == "communication" &&
+                   event["tid"].as<uint>() == 0) {
+            ++n_halo_wait;
+        } else if (ph == "M" && name == "thread_name" && event["tid"].as<uint>() == 1) {
+            submesh_named = event["args"]["name"].as<std::string>() == "submesh 1";
+        } else if (ph == "M" && name == "process_name") {
+            rank_named = event["args"]["name"].as<std::string>() == "rank 2";
+        }
+
+        if (event["args"] && event["args"]["neighbor_rank"]) {
+            ++n_neighbor;
+        }
+    }
+
+    if (n_volume != 1 || n_halo_wait != 1) {
+        std::cerr << "Error in kernel phase events" << std::endl;
+        error_found = true;
+    }
+
+    if (!submesh_named || !rank_named) {
+        std::cerr << "Error in trace metadata" << std::endl;
+        error_found = true;
+    }
+
+    // the receive event was the oldest event of its buffer and has been overwritten
+    if (n_neighbor != 0 || json["otherData"]["dropped_events"].as<uint>() != 6) {
+        std::cerr << "Error in dropping events of a full buffer" << std::endl;
+        error_found = true;
+    }
+
+    std::remove("event_tracer_test.json");
+
+    if (error_found) {
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,235 @@
+#include "general_definitions.hpp"
+#include "problem/SWE/swe_definitions.hpp"
+#include "problem/SWE/problem_data_structure/swe_data_state.hpp"
+#include "problem/SWE/problem_postprocessor/swe_post_extrema.hpp"
+
+// This test checks the extrema accumulated over a sequence of states against extrema taken directly, and that
+// writing and reading an extrema checkpoint in the middle of the sequence continues the accumulation unchanged.
+
+// two degrees of freedom interpolating the two postprocessor points of an element
+constexpr uint n_points = 2;
+
+struct MockMaster {
+    DynMatrix<double> phi_postprocessor_point;
+
+    MockMaster() : phi_postprocessor_point(n_points, n_points) {
+        for (uint dof = 0; dof < n_points; ++dof) {
+            for (uint pt = 0; pt < n_points; ++pt) {
+                phi_postprocessor_point(dof, pt) = (dof == pt) ? 1.0 : 0.0;
+            }
+        }
+    }
+};
+
+// all that update_extrema and read_extrema_checkpoint use of an element
+struct MockElement {
+    uint ID;
+    const MockMaster* master;
+
+    struct Data {
+        struct {
+            bool wet = true;
+        } wet_dry_state;
+
+        std::vector<SWE::State> state{SWE::State(n_points)};
+    } data;
+
+    uint GetID() const { return this->ID; }
+    const MockMaster& GetMaster() const { return *this->master; }
+};
+
+struct MockMesh {
+    MockMaster master;
+    std::vector<MockElement> elements;
+
+    MockMesh(const uint n_elements) {
+        for (uint elt = 0; elt < n_elements; ++elt) {
+            this->elements.push_back(MockElement{10 + elt, &this->master, MockElement::Data()});
+        }
+    }
+
+    uint GetNumberOwnedElements() const { return this->elements.size(); }
+    std::string GetMeshName() const { return "mock_mesh"; }
+
+    template <typename F>
+    void CallForEachOwnedElement(const F& f) {
+        for (auto& elt : this->elements) {
+            f(elt);
+        }
+    }
+};
+
+struct MockStepper {
+    double time;
+
+    double GetTimeAtCurrentStage() const { return this->time; }
+};
+
+constexpr uint n_elements = 3;
+constexpr uint n_updates  = 6;
+
+// state of the sequence at an update: element 1 is dry at update 2, element 2 is never wet, the depth at point 1 of
+// element 0 is below h_o at update 3
+void set_state(const uint update, MockMesh& mesh) {
+    for (uint elt = 0; elt < n_elements; ++elt) {
+        MockElement& element = mesh.elements[elt];
+
+        element.data.wet_dry_state.wet = (elt != 2) && !(elt == 1 && update == 2);
+
+        for (uint pt = 0; pt < n_points; ++pt) {
+            const double ze = std::sin(1.3 * update + 0.7 * pt + elt);
+
+            element.data.state[0].q(SWE::Variables::ze, pt) = ze;
+            element.data.state[0].q(SWE::Variables::qx, pt) = std::cos(0.9 * update + pt - elt);
+            element.data.state[0].q(SWE::Variables::qy, pt) = 0.5 * std::sin(2.1 * update - pt);
+
+            const bool shallow = (elt == 0 && pt == 1 && update == 3);
+
+            element.data.state[0].aux(SWE::Auxiliaries::bath, pt) = shallow ? 0.05 - ze : 2.0;
+        }
+    }
+}
+
+double update_time(const uint update) {
+    return 30.0 * update + (update > 3 ? 7.5 : 0.0);
+}
+
+bool check_extrema(const std::string& name, const SWE::Extrema& extrema) {
+    bool error_found = false;
+
+    const auto report = [&name, &error_found](const std::string& what, const uint index, const double value,
+                                              const double expected) {
+        if (value != expected) {
+            std::cerr << "Error in " << what << " of " << name << " at " << index << ": " << value
+                      << " != " << expected << std::endl;
+            error_found = true;
+        }
+    };
+
+    if (extrema.element_IDs.size() != n_elements || extrema.ze_max.size() != n_elements * n_points) {
+        std::cerr << "Error in size of " << name << std::endl;
+        return true;
+    }
+
+    MockMesh mesh(n_elements);
+
+    for (uint elt = 0; elt < n_elements; ++elt) {
+        report("element ID", elt, extrema.element_IDs[elt], mesh.elements[elt].GetID());
+
+        double wet_duration = 0.0;
+
+        for (uint pt = 0; pt < n_points; ++pt) {
+            double ze_max            = std::numeric_limits<double>::lowest();
+            double ze_max_time       = SWE::undefined_extremum;
+            double ze_min            = std::numeric_limits<double>::max();
+            double velocity_max      = std::numeric_limits<double>::lowest();
+            double velocity_max_time = SWE::undefined_extremum;
+
+            for (uint update = 0; update < n_updates; ++update) {
+                set_state(update, mesh);
+
+                const MockElement& element = mesh.elements[elt];
+
+                if (!element.data.wet_dry_state.wet) {
+                    continue;
+                }
+
+                if (pt == 0 && update > 0) {
+                    wet_duration += update_time(update) - update_time(update - 1);
+                }
+
+                const double ze = element.data.state[0].q(SWE::Variables::ze, pt);
+                const double h  = ze + element.data.state[0].aux(SWE::Auxiliaries::bath, pt);
+
+                if (ze > ze_max) {
+                    ze_max      = ze;
+                    ze_max_time = update_time(update);
+                }
+
+                ze_min = std::min(ze_min, ze);
+
+                const double velocity = std::hypot(element.data.state[0].q(SWE::Variables::qx, pt),
+                                                   element.data.state[0].q(SWE::Variables::qy, pt)) /
+                                        h;
+
+                if (h > SWE::PostProcessing::h_o && velocity > velocity_max) {
+                    velocity_max      = velocity;
+                    velocity_max_time = update_time(update);
+                }
+            }
+
+            const uint pt_index = elt * n_points + pt;
+
+            report("ze_max", pt_index, extrema.ze_max[pt_index], ze_max);
+            report("ze_max_time", pt_index, extrema.ze_max_time[pt_index], ze_max_time);
+            report("ze_min", pt_index, extrema.ze_min[pt_index], ze_min);
+            report("velocity_max", pt_index, extrema.velocity_max[pt_index], velocity_max);
+            report("velocity_max_time", pt_index, extrema.velocity_max_time[pt_index], velocity_max_time);
+        }
+
+        report("wet_duration", elt, extrema.wet_duration[elt], wet_duration);
+    }
+
+    return error_found;
+}
+
+int main() {
+    bool error_found = false;
+
+    MockMesh mesh(n_elements);
+
+    // uninterrupted sequence
+    SWE::Extrema extrema;
+
+    for (uint update = 0; update < n_updates; ++update) {
+        set_state(update, mesh);
+        SWE::update_extrema(MockStepper{update_time(update)}, mesh, extrema);
+    }
+
+    error_found |= check_extrema("uninterrupted extrema", extrema);
+
+    // checkpointed after update 2 and restarted
+    SWE::Extrema checkpointed_extrema;
+
+    std::stringstream checkpoint;
+
+    for (uint update = 0; update <= 2; ++update) {
+        set_state(update, mesh);
+        SWE::update_extrema(MockStepper{update_time(update)}, mesh, checkpointed_extrema);
+    }
+
+    SWE::write_extrema_checkpoint(checkpointed_extrema, checkpoint);
+
+    MockMesh restarted_mesh(n_elements);
+    SWE::Extrema restarted_extrema;
+
+    SWE::read_extrema_checkpoint(restarted_mesh, restarted_extrema, checkpoint);
+
+    for (uint update = 3; update < n_updates; ++update) {
+        set_state(update, restarted_mesh);
+        SWE::update_extrema(MockStepper{update_time(update)}, restarted_mesh, restarted_extrema);
+    }
+
+    error_found |= check_extrema("restarted extrema", restarted_extrema);
+
+    // a checkpoint of another mesh is rejected
+    std::stringstream other_checkpoint;
+    SWE::write_extrema_checkpoint(checkpointed_extrema, other_checkpoint);
+
+    MockMesh other_mesh(n_elements + 1);
+    SWE::Extrema other_extrema;
+
+    try {
+        SWE::read_extrema_checkpoint(other_mesh, other_extrema, other_checkpoint);
+
+        std::cerr << "Error: extrema checkpoint of another mesh was accepted" << std::endl;
+        error_found = true;
+    } catch (const std::logic_error&) {
+    }
+
+    if (error_found) {
+        return 1;
+    }
+
+    return 0;
+}
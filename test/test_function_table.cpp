@@ -0,0 +1,120 @@
+#include "general_definitions.hpp"
+#include "utilities/almost_equal.hpp"
+#include "utilities/function_table.hpp"
+
+// This test checks that functions evaluated from their tables match evaluating them pointwise, for all time
+// dependences, and that only general functions are evaluated again in time.
+
+constexpr uint n_variables = 3;
+
+// pointwise reference f(t, x) of the test functions
+double pointwise_value(const Utilities::TimeDependence time_dependence,
+                       const double t,
+                       const uint var,
+                       const Point<2>& point) {
+    const double g = std::sin(point[0] + var) * std::exp(-0.5 * point[1]) + var;
+
+    switch (time_dependence) {
+        case Utilities::TimeDependence::independent:
+            return g;
+        case Utilities::TimeDependence::separable:
+            return std::cos(0.3 * t) * g;
+        case Utilities::TimeDependence::general:
+            return std::sin(point[0] * t + var) + point[1] * t;
+    }
+
+    return 0.0;
+}
+
+template <Utilities::TimeDependence TD>
+struct TestFunction {
+    static constexpr Utilities::TimeDependence time_dependence = TD;
+
+    static uint n_evaluations;
+
+    static double time_factor(const double t) { return std::cos(0.3 * t); }
+
+    template <typename ValuesType>
+    static void evaluate(const double t, const AlignedVector<Point<2>>& points, ValuesType& values) {
+        ++n_evaluations;
+
+        // separable functions return g(x), which is their value at t = 0
+        const double t_evaluate = (TD == Utilities::TimeDependence::general) ? t : 0.0;
+
+        for (uint pt = 0; pt < points.size(); ++pt) {
+            for (uint var = 0; var < n_variables; ++var) {
+                values(var, pt) = pointwise_value(TD, t_evaluate, var, points[pt]);
+            }
+        }
+    }
+};
+
+template <Utilities::TimeDependence TD>
+constexpr Utilities::TimeDependence TestFunction<TD>::time_dependence;
+
+template <Utilities::TimeDependence TD>
+uint TestFunction<TD>::n_evaluations = 0;
+
+template <Utilities::TimeDependence TD>
+bool check_function(const std::string& name, const AlignedVector<Point<2>>& points) {
+    using FunctionType = TestFunction<TD>;
+
+    bool error_found = false;
+
+    HybMatrix<double, n_variables> table;
+    Utilities::tabulate_function<FunctionType>(points, n_variables, table);
+
+    const uint expected_columns = (TD == Utilities::TimeDependence::general) ? 0 : points.size();
+    if (columns(table) != expected_columns) {
+        std::cerr << "Error in table size of " << name << " function" << std::endl;
+        error_found = true;
+    }
+
+    HybMatrix<double, n_variables> values(n_variables, points.size());
+
+    const uint n_times = 50;
+    for (uint step = 0; step < n_times; ++step) {
+        const double t = 0.37 * step;
+
+        Utilities::evaluate_function<FunctionType>(t, points, table, values);
+
+        for (uint pt = 0; pt < points.size(); ++pt) {
+            for (uint var = 0; var < n_variables; ++var) {
+                if (!Utilities::almost_equal(values(var, pt), pointwise_value(TD, t, var, points[pt]))) {
+                    std::cerr << "Error in " << name << " function at t = " << t << ", variable " << var
+                              << ", point " << pt << ": " << values(var, pt)
+                              << " != " << pointwise_value(TD, t, var, points[pt]) << std::endl;
+                    error_found = true;
+                }
+            }
+        }
+    }
+
+    const uint expected_evaluations = (TD == Utilities::TimeDependence::general) ? n_times : 1;
+    if (FunctionType::n_evaluations != expected_evaluations) {
+        std::cerr << "Error in number of evaluations of " << name << " function: " << FunctionType::n_evaluations
+                  << std::endl;
+        error_found = true;
+    }
+
+    return error_found;
+}
+
+int main() {
+    bool error_found = false;
+
+    AlignedVector<Point<2>> points;
+    for (uint pt = 0; pt < 7; ++pt) {
+        points.push_back(Point<2>{0.5 * pt - 1.0, 0.25 * pt * pt});
+    }
+
+    error_found |= check_function<Utilities::TimeDependence::independent>("independent", points);
+    error_found |= check_function<Utilities::TimeDependence::separable>("separable", points);
+    error_found |= check_function<Utilities::TimeDependence::general>("general", points);
+
+    if (error_found) {
+        return 1;
+    }
+
+    return 0;
+}
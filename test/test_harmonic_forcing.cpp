@@ -0,0 +1,178 @@
+#include "general_definitions.hpp"
+#include "problem/SWE/problem_input/swe_inputs.hpp"
+#include "problem/SWE/problem_boundary_conditions/swe_harmonic_forcing.hpp"
+#include "simulation/stepper/explicit_ssp_rk_stepper.hpp"
+
+// This test checks the phasor evaluation of harmonic forcings against summing the cosines of the constituents directly
+// at the stage times of a Runge-Kutta stepper, across phasor resynchronizations, evictions of cached rotations, and a
+// restart from a checkpoint.
+
+// two node boundary with its nodal values linearly interpolated to the gauss points, all that a forcing uses of it
+struct LinearBoundary {
+    static constexpr uint ngp = 3;
+
+    struct Data {
+        uint get_ngp_boundary(const uint) const { return LinearBoundary::ngp; }
+    } data;
+
+    uint bound_id = 0;
+
+    DynRowVector<double> ComputeBoundaryNodalUgp(const DynRowVector<double>& u_nodal) const {
+        DynRowVector<double> u_gp;
+        u_gp.resize(ngp);
+
+        for (uint gp = 0; gp < ngp; ++gp) {
+            const double xi = (gp + 0.5) / ngp;
+
+            u_gp[gp] = (1.0 - xi) * u_nodal[0] + xi * u_nodal[1];
+        }
+
+        return u_gp;
+    }
+};
+
+constexpr uint LinearBoundary::ngp;
+
+// M2, K1 and S2 tides
+std::vector<SWE::TideNode> make_tide_input(const double amplitude_scale) {
+    std::vector<SWE::TideNode> tide_input(2);
+
+    for (uint node = 0; node < 2; ++node) {
+        tide_input[node].frequency    = {1.405189e-4, 7.292117e-5, 1.454441e-4};
+        tide_input[node].forcing_fact = {1.0, 0.9, 1.1};
+        tide_input[node].equilib_arg  = {10.0, 200.0, 345.0};
+
+        tide_input[node].amplitude = {amplitude_scale * (0.5 + 0.25 * node), amplitude_scale * (0.2 - 0.1 * node), 0.3};
+        tide_input[node].phase     = {30.0 + 90.0 * node, 120.0 - 45.0 * node, 270.0};
+    }
+
+    return tide_input;
+}
+
+// sum of the constituents at the gauss points of LinearBoundary
+std::vector<double> direct_forcing(const std::vector<SWE::TideNode>& tide_input, const double time) {
+    std::vector<double> forcing(LinearBoundary::ngp, 0.0);
+
+    for (uint gp = 0; gp < LinearBoundary::ngp; ++gp) {
+        const double xi = (gp + 0.5) / LinearBoundary::ngp;
+
+        for (uint con = 0; con < tide_input[0].frequency.size(); ++con) {
+            const double amplitude = (1.0 - xi) * tide_input[0].amplitude[con] + xi * tide_input[1].amplitude[con];
+            const double phase     = (1.0 - xi) * tide_input[0].phase[con] + xi * tide_input[1].phase[con];
+
+            const double arg = (tide_input[0].equilib_arg[con] - phase) * PI / 180;
+
+            forcing[gp] += tide_input[0].forcing_fact[con] * amplitude * cos(tide_input[0].frequency[con] * time + arg);
+        }
+    }
+
+    return forcing;
+}
+
+struct ForcedBoundaries {
+    std::vector<std::vector<SWE::TideNode>> tide_inputs;
+    std::vector<SWE::HarmonicForcing> forcings;
+
+    // boundaries of a submesh forced by the same constituents share their phasors
+    ForcedBoundaries() : tide_inputs{make_tide_input(1.0), make_tide_input(2.5)} {
+        auto phasors = std::make_shared<SWE::HarmonicPhasors>(this->tide_inputs[0][0].frequency);
+
+        LinearBoundary bound;
+
+        for (const auto& tide_input : this->tide_inputs) {
+            this->forcings.emplace_back(tide_input, phasors);
+            this->forcings.back().Initialize(bound);
+        }
+    }
+
+    // largest deviation from the direct sum, relative to the forcing magnitude of about 3
+    double ComputeError(const double time) {
+        double error = 0.0;
+
+        for (uint bound = 0; bound < this->forcings.size(); ++bound) {
+            const DynRowVector<double> forcing   = this->forcings[bound].ComputeForcing(time);
+            const std::vector<double> forcing_ex = direct_forcing(this->tide_inputs[bound], time);
+
+            for (uint gp = 0; gp < LinearBoundary::ngp; ++gp) {
+                error = std::max(error, std::abs(forcing[gp] - forcing_ex[gp]) / 3.0);
+            }
+        }
+
+        return error;
+    }
+};
+
+int main() {
+    bool error_found = false;
+
+    StepperInput stepper_input;
+
+    stepper_input.nstages       = 3;
+    stepper_input.order         = 3;
+    stepper_input.dt            = 30.0;
+    stepper_input.ramp_duration = 0.0;
+
+    ESSPRKStepper stepper(stepper_input);
+    ForcedBoundaries boundaries;
+
+    // 3 stages per step give 3 distinct increments, 1000 steps pass the resynchronization after 1024 rotations twice
+    const uint n_steps = 1000;
+
+    std::stringstream checkpoint;
+
+    double max_error = 0.0;
+    for (uint step = 0; step < n_steps; ++step) {
+        if (step == n_steps / 2) {
+            stepper.WriteCheckpoint(checkpoint);
+        }
+
+        for (uint stage = 0; stage < stepper.GetNumStages(); ++stage, ++stepper) {
+            max_error = std::max(max_error, boundaries.ComputeError(stepper.GetTimeAtCurrentStage()));
+        }
+    }
+
+    if (max_error > 1.0e-12) {
+        std::cerr << "Error in forcing at stage times: " << max_error << std::endl;
+        error_found = true;
+    }
+
+    // time steps changing every step produce more increments than rotations are cached
+    max_error = 0.0;
+    for (uint step = 0; step < 100; ++step) {
+        stepper.SetDT(stepper_input.dt * (1.0 + 0.01 * (step % 13)));
+
+        for (uint stage = 0; stage < stepper.GetNumStages(); ++stage, ++stepper) {
+            max_error = std::max(max_error, boundaries.ComputeError(stepper.GetTimeAtCurrentStage()));
+        }
+    }
+
+    if (max_error > 1.0e-12) {
+        std::cerr << "Error in forcing at varying time steps: " << max_error << std::endl;
+        error_found = true;
+    }
+
+    // a restarted simulation sets up its forcings at t = 0 and first evaluates them at the restart time
+    ESSPRKStepper restarted_stepper(stepper_input);
+    restarted_stepper.ReadCheckpoint(checkpoint);
+
+    ForcedBoundaries restarted_boundaries;
+
+    max_error = 0.0;
+    for (uint step = n_steps / 2; step < n_steps; ++step) {
+        for (uint stage = 0; stage < restarted_stepper.GetNumStages(); ++stage, ++restarted_stepper) {
+            max_error =
+                std::max(max_error, restarted_boundaries.ComputeError(restarted_stepper.GetTimeAtCurrentStage()));
+        }
+    }
+
+    if (restarted_stepper.GetTimeAtCurrentStage() == 0.0 || max_error > 1.0e-12) {
+        std::cerr << "Error in forcing after restart: " << max_error << std::endl;
+        error_found = true;
+    }
+
+    if (error_found) {
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,88 @@
+#include "utilities/kernel_timers.hpp"
+#include "test_output_reader.hpp"
+
+#include <thread>
+
+int main() {
+    bool error_found = false;
+
+    Utilities::KernelTimers timers;
+
+    for (uint call = 0; call < 3; ++call) {
+        START_KERNEL_PHASE(timers, volume);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        STOP_KERNEL_PHASE(timers, volume);
+    }
+
+    START_KERNEL_PHASE(timers, halo_wait);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    STOP_KERNEL_PHASE(timers, halo_wait);
+
+    if (timers.GetCalls(Utilities::KernelPhase::volume) != 3 ||
+        timers.GetCalls(Utilities::KernelPhase::halo_wait) != 1 ||
+        timers.GetCalls(Utilities::KernelPhase::source) != 0) {
+        std::cerr << "Error in number of calls" << std::endl;
+        error_found = true;
+    }
+
+    if (timers.GetSeconds(Utilities::KernelPhase::volume) < 0.03 ||
+        timers.GetSeconds(Utilities::KernelPhase::halo_wait) < 0.02 ||
+        timers.GetSeconds(Utilities::KernelPhase::source) != 0.0) {
+        std::cerr << "Error in timed seconds" << std::endl;
+        error_found = true;
+    }
+
+    Utilities::KernelTimers sum;
+    sum += timers;
+    sum += timers;
+
+    if (sum.GetCalls(Utilities::KernelPhase::volume) != 6 ||
+        sum.GetTotalSeconds() != timers.GetTotalSeconds() + timers.GetTotalSeconds()) {
+        std::cerr << "Error in summing timers" << std::endl;
+        error_found = true;
+    }
+
+    std::vector<Utilities::KernelTimersRecord> records{Utilities::KernelTimersRecord{0, 0, timers},
+                                                       Utilities::KernelTimersRecord{1, 0, timers},
+                                                       Utilities::KernelTimersRecord{1, 1, timers}};
+
+    std::stringstream summary;
+    Utilities::write_kernel_timers_summary(summary, records);
+
+    // phase rows hold calls, total seconds, share, rank min and max seconds, and imbalance
+    const std::vector<std::vector<std::string>> rows = read_rows(summary.str());
+    const std::vector<double> volume_row             = find_row_values(rows, {"volume"});
+    const std::vector<double> halo_wait_row          = find_row_values(rows, {"halo_wait"});
+
+    if (find_row_values(rows, {"Kernel", "timers", "of"}) != std::vector<double>{3, 2} || volume_row.size() != 6 ||
+        volume_row[0] != 9 || std::abs(volume_row[1] - 3 * timers.GetSeconds(Utilities::KernelPhase::volume)) > 1e-4 ||
+        halo_wait_row.size() != 6 || halo_wait_row[0] != 3) {
+        std::cerr << "Error in summary:\n" << summary.str() << std::endl;
+        error_found = true;
+    }
+
+    Utilities::write_kernel_timers_json("kernel_timers_test.json", records);
+
+    const YAML::Node json = read_json("kernel_timers_test.json");
+    const YAML::Node unit = json["units"][2];
+
+    const double volume_seconds = timers.GetSeconds(Utilities::KernelPhase::volume);
+
+    if (json["units"].size() != 3 || unit["rank"].as<uint>() != 1 || unit["submesh"].as<uint>() != 1 ||
+        unit["timers"]["volume"]["calls"].as<uint>() != 3 ||
+        std::abs(unit["timers"]["volume"]["seconds"].as<double>() - volume_seconds) > 1e-5 * volume_seconds ||
+        unit["timers"]["halo_wait"]["calls"].as<uint>() != 1 || json["ranks"].size() != 2 ||
+        json["ranks"][1]["timers"]["volume"]["calls"].as<uint>() != 6 ||
+        json["total"]["volume"]["calls"].as<uint>() != 9) {
+        std::cerr << "Error in JSON output:\n" << json << std::endl;
+        error_found = true;
+    }
+
+    std::remove("kernel_timers_test.json");
+
+    if (error_found) {
+        return 1;
+    }
+
+    return 0;
+}
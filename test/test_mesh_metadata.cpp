@@ -39,6 +39,91 @@ int main(int argc, char** argv) {
             error_found = true;
             std::cerr << "Error: in reading a writing mesh: " << out_name << '\n' << "       for MeshMeta format.\n";
         }
+
+        std::string binary_out_name = argv[1];
+        binary_out_name             = binary_out_name + ".dgm.out";
+
+        // two rank boundaries of submesh 1 on locality 2, built from the first elements of the mesh
+        DistributedBoundaryMetaData dbmd_dataA;
+        uint n_dbound = 0;
+        for (uint rb = 0; rb < 2; ++rb) {
+            RankBoundaryMetaData rank_boundary;
+
+            rank_boundary.locality_in = 2;
+            rank_boundary.locality_ex = rb;
+            rank_boundary.submesh_in  = 1;
+            rank_boundary.submesh_ex  = 3 + rb;
+
+            for (auto& elt : meshA.elements) {
+                if (rank_boundary.elements_in.size() == 5 + rb) {
+                    break;
+                }
+
+                rank_boundary.elements_in.push_back(elt.first);
+                rank_boundary.elements_ex.push_back(elt.first + 1);
+                rank_boundary.bound_ids_in.push_back(n_dbound % 3);
+                rank_boundary.bound_ids_ex.push_back((n_dbound + 1) % 3);
+                rank_boundary.p.push_back(n_dbound % 4);
+
+                ++n_dbound;
+            }
+
+            dbmd_dataA.rank_boundary_data.push_back(std::move(rank_boundary));
+        }
+
+        BinaryMeshData::write_to(binary_out_name, meshA, dbmd_dataA);
+
+        BinaryMeshData binary_mesh(binary_out_name);
+
+        MeshMetaData meshC;
+        meshC.mesh_name = binary_mesh.GetMeshName();
+
+        for (uint elt_index = 0; elt_index < binary_mesh.GetNumberElements(); ++elt_index) {
+            ElementMetaData& elt = meshC.elements[binary_mesh.GetElementID(elt_index)];
+
+            elt.node_ID       = binary_mesh.GetElementNodeIDs(elt_index);
+            elt.neighbor_ID   = binary_mesh.GetElementNeighborIDs(elt_index);
+            elt.boundary_type = binary_mesh.GetElementBoundaryTypes(elt_index);
+
+            AlignedVector<Point<3>> nodal_coordinates = binary_mesh.get_nodal_coordinates(elt_index);
+            for (uint node = 0; node < elt.node_ID.size(); ++node) {
+                meshC.nodes[elt.node_ID[node]].coordinates = nodal_coordinates[node];
+            }
+        }
+
+        if (!is_equal(meshA, meshC)) {
+            error_found = true;
+            std::cerr << "Error: in reading a writing mesh: " << binary_out_name << '\n'
+                      << "       for binary mesh format.\n";
+        }
+
+        DistributedBoundaryMetaData dbmd_dataC = binary_mesh.get_dbmd_data(2, 1);
+
+        bool dbmd_equal = dbmd_dataC.rank_boundary_data.size() == dbmd_dataA.rank_boundary_data.size();
+        for (uint rb = 0; dbmd_equal && rb < dbmd_dataA.rank_boundary_data.size(); ++rb) {
+            const RankBoundaryMetaData& rbA = dbmd_dataA.rank_boundary_data[rb];
+            const RankBoundaryMetaData& rbC = dbmd_dataC.rank_boundary_data[rb];
+
+            dbmd_equal = rbA.locality_in == rbC.locality_in && rbA.locality_ex == rbC.locality_ex &&
+                         rbA.submesh_in == rbC.submesh_in && rbA.submesh_ex == rbC.submesh_ex &&
+                         rbA.elements_in == rbC.elements_in && rbA.elements_ex == rbC.elements_ex &&
+                         rbA.bound_ids_in == rbC.bound_ids_in && rbA.bound_ids_ex == rbC.bound_ids_ex &&
+                         rbA.p == rbC.p;
+        }
+
+        if (!dbmd_equal) {
+            error_found = true;
+            std::cerr << "Error: in reading a writing distributed boundaries: " << binary_out_name << '\n'
+                      << "       for binary mesh format.\n";
+        }
+
+        try {
+            binary_mesh.get_dbmd_data(0, 1);
+
+            error_found = true;
+            std::cerr << "Error: distributed boundaries of another submesh were accepted: " << binary_out_name << '\n';
+        } catch (const std::logic_error&) {
+        }
     }
 
     return error_found;
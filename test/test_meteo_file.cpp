@@ -0,0 +1,190 @@
+#include "general_definitions.hpp"
+#include "problem/SWE/problem_parser/swe_meteo_file.hpp"
+
+// This test checks that the values read from binary meteo data files match the values written to them, for selections
+// of nodes whose gaps in the file lie on both sides of the gap read through, and that files written by
+// scripts/meteo/convert_meteo_data.py follow the layout MeteoFile reads.
+
+constexpr uint n_nodes   = 1000;
+constexpr uint n_records = 3;
+
+// node IDs are not in file order
+uint node_ID(const uint position) {
+    return (7 * position + 3) % n_nodes + 1;
+}
+
+// integers below 2^24 are exact in float32
+float value(const uint record, const uint field, const uint position) {
+    return 10000.0f * record + 2000.0f * field + position;
+}
+
+// the layout of the file documented in swe_meteo_file.hpp, written field by field
+void write_meteo_file(const std::string& file_name) {
+    std::ofstream file(file_name, std::ios_base::binary);
+
+    const std::uint32_t n_file_nodes   = n_nodes;
+    const std::uint32_t n_file_records = n_records;
+    const double interval              = 3600.0;
+
+    file.write("DGSWEMET", 8);
+    file.write(reinterpret_cast<const char*>(&n_file_nodes), sizeof(std::uint32_t));
+    file.write(reinterpret_cast<const char*>(&n_file_records), sizeof(std::uint32_t));
+    file.write(reinterpret_cast<const char*>(&interval), sizeof(double));
+
+    for (uint position = 0; position < n_nodes; ++position) {
+        const std::uint32_t ID = node_ID(position);
+        file.write(reinterpret_cast<const char*>(&ID), sizeof(std::uint32_t));
+    }
+
+    for (uint record = 0; record < n_records; ++record) {
+        for (uint field = 0; field < 3; ++field) {
+            for (uint position = 0; position < n_nodes; ++position) {
+                const float field_value = value(record, field, position);
+                file.write(reinterpret_cast<const char*>(&field_value), sizeof(float));
+            }
+        }
+    }
+}
+
+// values read for the nodes at positions by local node index
+bool check_records(const std::string& name, const SWE::MeteoReader& meteo, const std::vector<uint>& positions) {
+    bool error_found = false;
+
+    for (uint record = 0; record < meteo.GetNumberRecords(); ++record) {
+        const SWE::MeteoRecord meteo_record = meteo.ReadRecord(record);
+
+        if (meteo_record.size() != positions.size()) {
+            std::cerr << "Error in number of nodes of " << name << " at record " << record << std::endl;
+            error_found = true;
+
+            continue;
+        }
+
+        for (uint node = 0; node < positions.size(); ++node) {
+            const std::array<double, 3> node_values{
+                meteo_record.tau_x[node], meteo_record.tau_y[node], meteo_record.p_atm[node]};
+
+            for (uint field = 0; field < 3; ++field) {
+                if (node_values[field] != value(record, field, positions[node])) {
+                    std::cerr << "Error in " << name << " at record " << record << ", field " << field << ", node "
+                              << node << ": " << node_values[field] << " != " << value(record, field, positions[node])
+                              << std::endl;
+                    error_found = true;
+                }
+            }
+        }
+    }
+
+    return error_found;
+}
+
+// nodes in the order of the positions given
+bool check_selection(const std::string& name, SWE::MeteoFile& meteo, const std::vector<uint>& positions) {
+    std::vector<uint> node_IDs;
+    for (const uint position : positions) {
+        node_IDs.push_back(node_ID(position));
+    }
+
+    meteo.SelectNodes(node_IDs);
+
+    return check_records(name, meteo, positions);
+}
+
+// per step text files converted by the python script into output_file
+bool check_converted_file(const std::string& python, const std::string& script, const std::string& output_file) {
+    bool error_found = false;
+
+    // steps of records 3600 s apart at time steps of 600 s
+    for (uint record = 0; record < n_records; ++record) {
+        std::ofstream step_file("meteo_text_" + std::to_string(6 * record) + ".22");
+
+        for (uint position = 0; position < n_nodes; ++position) {
+            step_file << node_ID(position) << ' ' << value(record, 0, position) << ' ' << value(record, 1, position)
+                      << ' ' << value(record, 2, position) << '\n';
+        }
+    }
+
+    const std::string command = python + " " + script + " meteo_text.22 3600 600 " + output_file + " > /dev/null";
+
+    if (std::system(command.c_str()) != 0) {
+        std::cerr << "Error in running " << command << std::endl;
+
+        return true;
+    }
+
+    SWE::MeteoFile meteo(output_file);
+
+    if (meteo.GetNumberRecords() != n_records || meteo.GetInterval() != 3600.0) {
+        std::cerr << "Error in header of converted file: " << meteo.GetNumberRecords() << " records, interval "
+                  << meteo.GetInterval() << std::endl;
+        error_found = true;
+    }
+
+    // the script sorts the nodes by ID, ReadRecord returns values in the order of the selection regardless
+    std::vector<uint> positions(n_nodes);
+    std::iota(positions.begin(), positions.end(), 0);
+    std::reverse(positions.begin(), positions.end());
+
+    error_found |= check_selection("converted file", meteo, positions);
+
+    return error_found;
+}
+
+int main(int argc, char* argv[]) {
+    bool error_found = false;
+
+    write_meteo_file("meteo_test.bin");
+
+    if (!SWE::MeteoFile::IsMeteoFile("meteo_test.bin")) {
+        std::cerr << "Error in recognizing meteo data file" << std::endl;
+        error_found = true;
+    }
+
+    SWE::MeteoFile meteo("meteo_test.bin");
+
+    if (meteo.GetNumberRecords() != n_records || meteo.GetInterval() != 3600.0) {
+        std::cerr << "Error in header: " << meteo.GetNumberRecords() << " records, interval " << meteo.GetInterval()
+                  << std::endl;
+        error_found = true;
+    }
+
+    // gaps between the positions of 63, 64 (read through) and 65 (new run), and both ends of the file
+    error_found |= check_selection("gaps at the limit", meteo, {0, 64, 129, 195, 999, 196});
+
+    // nodes in reverse file order, far apart
+    error_found |= check_selection("distant nodes", meteo, {900, 500, 499, 3});
+
+    error_found |= check_selection("all nodes", meteo, [] {
+        std::vector<uint> positions(n_nodes);
+        std::iota(positions.begin(), positions.end(), 0);
+        return positions;
+    }());
+
+    error_found |= check_selection("no nodes", meteo, {});
+
+    try {
+        meteo.ReadRecord(n_records);
+
+        std::cerr << "Error: reading a record past the end did not throw" << std::endl;
+        error_found = true;
+    } catch (const std::logic_error&) {
+    }
+
+    try {
+        meteo.SelectNodes({n_nodes + 1});
+
+        std::cerr << "Error: selecting a node missing in the file did not throw" << std::endl;
+        error_found = true;
+    } catch (const std::logic_error&) {
+    }
+
+    if (argc == 3) {
+        error_found |= check_converted_file(argv[1], argv[2], "meteo_converted.bin");
+    }
+
+    if (error_found) {
+        return 1;
+    }
+
+    return 0;
+}
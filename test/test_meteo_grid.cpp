@@ -0,0 +1,175 @@
+#include "general_definitions.hpp"
+#include "problem/SWE/problem_input/swe_inputs.hpp"
+#include "problem/SWE/problem_parser/swe_meteo_grid.hpp"
+
+// This test checks the interpolation of gridded meteo fields to nodes inside the grid, on its edges and corners, and
+// outside of it, for windows of the grid starting at its origin and inside of it. The fields are bilinear, so that
+// interpolating them is exact.
+
+constexpr uint nx        = 6;
+constexpr uint ny        = 5;
+constexpr uint n_records = 2;
+
+constexpr double grid_x0 = -2.0;
+constexpr double grid_y0 = 1.0;
+constexpr double grid_dx = 0.5;
+constexpr double grid_dy = 0.25;
+
+// exact in float32 at the grid points
+double field_value(const uint record, const uint field, const double x, const double y) {
+    return record + 0.5 * field + 0.25 * x - 0.5 * y + 0.125 * (field + 1) * x * y;
+}
+
+// the layout of the file documented in swe_meteo_grid.hpp, written field by field
+void write_meteo_grid(const std::string& file_name, const uint n_x, const uint n_y) {
+    std::ofstream file(file_name, std::ios_base::binary);
+
+    const std::array<std::uint32_t, 4> sizes{n_x, n_y, n_records, 0};
+    const std::array<double, 5> geometry{grid_x0, grid_y0, grid_dx, grid_dy, 3600.0};
+
+    file.write("DGSWEGRD", 8);
+    file.write(reinterpret_cast<const char*>(sizes.data()), sizes.size() * sizeof(std::uint32_t));
+    file.write(reinterpret_cast<const char*>(geometry.data()), geometry.size() * sizeof(double));
+
+    for (uint record = 0; record < n_records; ++record) {
+        for (uint field = 0; field < 3; ++field) {
+            for (uint j = 0; j < n_y; ++j) {
+                for (uint i = 0; i < n_x; ++i) {
+                    const float value = field_value(record, field, grid_x0 + i * grid_dx, grid_y0 + j * grid_dy);
+                    file.write(reinterpret_cast<const char*>(&value), sizeof(float));
+                }
+            }
+        }
+    }
+}
+
+// nodes outside of the grid take the values at the closest point of it
+bool check_selection(const std::string& name,
+                     SWE::MeteoGrid& meteo,
+                     const std::vector<std::array<double, 2>>& coordinates,
+                     const std::vector<std::array<double, 2>>& grid_coordinates,
+                     const double tolerance) {
+    bool error_found = false;
+
+    meteo.SelectNodes(coordinates);
+
+    for (uint record = 0; record < meteo.GetNumberRecords(); ++record) {
+        const SWE::MeteoRecord meteo_record = meteo.ReadRecord(record);
+
+        if (meteo_record.size() != coordinates.size()) {
+            std::cerr << "Error in number of nodes of " << name << " at record " << record << std::endl;
+            error_found = true;
+
+            continue;
+        }
+
+        for (uint node = 0; node < coordinates.size(); ++node) {
+            const double x = std::min(std::max(grid_coordinates[node][0], grid_x0), grid_x0 + (nx - 1) * grid_dx);
+            const double y = std::min(std::max(grid_coordinates[node][1], grid_y0), grid_y0 + (ny - 1) * grid_dy);
+
+            const std::array<double, 3> node_values{
+                meteo_record.tau_x[node], meteo_record.tau_y[node], meteo_record.p_atm[node]};
+
+            for (uint field = 0; field < 3; ++field) {
+                if (std::abs(node_values[field] - field_value(record, field, x, y)) > tolerance) {
+                    std::cerr << "Error in " << name << " at record " << record << ", field " << field << ", node "
+                              << node << ": " << node_values[field] << " != " << field_value(record, field, x, y)
+                              << std::endl;
+                    error_found = true;
+                }
+            }
+        }
+    }
+
+    return error_found;
+}
+
+bool check_selection(const std::string& name,
+                     SWE::MeteoGrid& meteo,
+                     const std::vector<std::array<double, 2>>& coordinates) {
+    return check_selection(name, meteo, coordinates, coordinates, 1.0e-12);
+}
+
+int main() {
+    bool error_found = false;
+
+    write_meteo_grid("meteo_grid_test.bin", nx, ny);
+
+    if (!SWE::MeteoGrid::IsMeteoGrid("meteo_grid_test.bin") || SWE::MeteoFile::IsMeteoFile("meteo_grid_test.bin")) {
+        std::cerr << "Error in recognizing meteo grid file" << std::endl;
+        error_found = true;
+    }
+
+    SWE::MeteoGrid meteo("meteo_grid_test.bin");
+
+    if (meteo.GetNumberRecords() != n_records || meteo.GetInterval() != 3600.0) {
+        std::cerr << "Error in header: " << meteo.GetNumberRecords() << " records, interval " << meteo.GetInterval()
+                  << std::endl;
+        error_found = true;
+    }
+
+    // the grid spans [-2, 0.5] x [1, 2]
+    error_found |= check_selection("nodes in and around the grid",
+                                   meteo,
+                                   {{-1.3, 1.37},
+                                    {-1.0, 1.5},
+                                    {0.5, 1.6},
+                                    {-0.8, 2.0},
+                                    {0.5, 2.0},
+                                    {-2.0, 1.0},
+                                    {-5.0, 1.3},
+                                    {3.0, 7.0},
+                                    {-0.7, -10.0},
+                                    {-9.0, 2.2}});
+
+    // window starting inside of the grid, ending at its upper right corner
+    error_found |= check_selection("window inside the grid", meteo, {{-0.3, 1.8}, {0.1, 1.55}, {0.5, 2.0}, {4.0, 1.6}});
+
+    error_found |= check_selection("single node", meteo, {{-0.6, 1.3}});
+
+    error_found |= check_selection("no nodes", meteo, {});
+
+    // grid in degrees, nodes in the coordinates of the projected mesh
+    SWE::SphericalProjection projection;
+    projection.longitude_o = -1.0;
+    projection.latitude_o  = 1.5;
+
+    const double R_o = projection.R * cos(projection.latitude_o * PI / 180.0);
+
+    std::vector<std::array<double, 2>> lon_lat{{-1.3, 1.37}, {0.5, 1.6}, {-5.0, 1.3}, {-0.7, 2.4}};
+    std::vector<std::array<double, 2>> projected;
+    for (const auto& point : lon_lat) {
+        projected.push_back({R_o * (point[0] - projection.longitude_o) * PI / 180.0,
+                             projection.R * point[1] * PI / 180.0});
+    }
+
+    SWE::MeteoGrid projected_meteo("meteo_grid_test.bin");
+    projected_meteo.ProjectGrid(projection);
+
+    error_found |= check_selection("projected grid", projected_meteo, projected, lon_lat, 1.0e-9);
+
+    try {
+        meteo.ReadRecord(n_records);
+
+        std::cerr << "Error: reading a record past the end did not throw" << std::endl;
+        error_found = true;
+    } catch (const std::logic_error&) {
+    }
+
+    // a single row of grid points has no cells
+    write_meteo_grid("meteo_grid_invalid.bin", nx, 1);
+
+    try {
+        SWE::MeteoGrid invalid_meteo("meteo_grid_invalid.bin");
+
+        std::cerr << "Error: reading a grid without cells did not throw" << std::endl;
+        error_found = true;
+    } catch (const std::logic_error&) {
+    }
+
+    if (error_found) {
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,65 @@
+#ifndef TEST_OUTPUT_READER_HPP
+#define TEST_OUTPUT_READER_HPP
+
+#include <yaml-cpp/yaml.h>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Readers for the profiling outputs, so that tests check values instead of the exact formatting.
+
+// JSON is a subset of the YAML flow style
+inline YAML::Node read_json(const std::string& file_name) {
+    return YAML::LoadFile(file_name);
+}
+
+// rows of white space separated fields of a text summary
+inline std::vector<std::vector<std::string>> read_rows(const std::string& text) {
+    std::vector<std::vector<std::string>> rows;
+
+    std::stringstream text_stream(text);
+    std::string line;
+    while (std::getline(text_stream, line)) {
+        std::stringstream line_stream(line);
+
+        std::vector<std::string> row;
+        std::string field;
+        while (line_stream >> field) {
+            row.push_back(field);
+        }
+
+        if (!row.empty()) {
+            rows.push_back(std::move(row));
+        }
+    }
+
+    return rows;
+}
+
+// numbers of the first row starting with the fields of label, empty if there is no such row
+inline std::vector<double> find_row_values(const std::vector<std::vector<std::string>>& rows,
+                                           const std::vector<std::string>& label) {
+    for (const auto& row : rows) {
+        if (row.size() < label.size() || !std::equal(label.begin(), label.end(), row.begin())) {
+            continue;
+        }
+
+        std::vector<double> values;
+        for (auto field = row.begin() + label.size(); field != row.end(); ++field) {
+            std::stringstream field_stream(*field);
+
+            double value;
+            if (field_stream >> value) {
+                values.push_back(value);
+            }
+        }
+
+        return values;
+    }
+
+    return std::vector<double>();
+}
+
+#endif
@@ -12,6 +12,11 @@ std::vector<std::vector<MeshMetaData>> partition(const MeshMetaData& mesh_meta,
                                                  const int ranks_per_locality,
                                                  const bool rank_balanced);
 
+void write_ghost_layer_metadata(const std::string& file_name,
+                                const MeshMetaData& mesh_meta,
+                                std::vector<std::vector<MeshMetaData>>& submeshes,
+                                const uint n_ghost_layers);
+
 bool check_partition(const MeshMetaData& mesh, std::vector<std::vector<MeshMetaData>>& submeshes) {
     bool error_found{false};
     // 2 checks are performed in this unit test
@@ -62,6 +67,102 @@ bool check_partition(const MeshMetaData& mesh, std::vector<std::vector<MeshMetaD
     return error_found;
 }
 
+bool check_ghost_layers(const MeshMetaData& mesh,
+                        std::vector<std::vector<MeshMetaData>>& submeshes,
+                        const uint n_ghost_layers) {
+    bool error_found{false};
+
+    const std::vector<std::vector<MeshMetaData>> owned_submeshes = submeshes;
+
+    write_ghost_layer_metadata("ghost_test.14", mesh, submeshes, n_ghost_layers);
+
+    std::map<std::pair<uint, uint>, GhostLayerMetaData> ghost_data;
+    for (uint loc = 0; loc < submeshes.size(); ++loc) {
+        for (uint sm = 0; sm < submeshes[loc].size(); ++sm) {
+            ghost_data.insert(std::make_pair(
+                std::make_pair(loc, sm),
+                GhostLayerMetaData("ghost_test_" + std::to_string(loc) + '_' + std::to_string(sm) + ".ghmd", loc, sm)));
+        }
+    }
+
+    // Check that ghosts are owned by the neighbor and that send/receive lists match across the rank boundary
+    for (auto& gd : ghost_data) {
+        if (gd.second.GetNumberOfLayers() > n_ghost_layers) {
+            error_found = true;
+            std::cerr << "Error: submesh has more ghost layers than requested\n";
+        }
+
+        for (auto& rank_ghosts : gd.second.rank_ghost_data) {
+            const MeshMetaData& submesh_ex = owned_submeshes[rank_ghosts.locality_ex][rank_ghosts.submesh_ex];
+            const MeshMetaData& submesh    = submeshes[rank_ghosts.locality_in][rank_ghosts.submesh_in];
+            for (uint elt_id : rank_ghosts.elements_receive) {
+                if (!submesh_ex.elements.count(elt_id)) {
+                    error_found = true;
+                    std::cerr << "Error: ghost element " << elt_id << " is not owned by the sending submesh\n";
+                }
+
+                if (!submesh.elements.count(elt_id)) {
+                    error_found = true;
+                    std::cerr << "Error: ghost element " << elt_id << " is missing from the receiving submesh\n";
+                }
+            }
+
+            bool found{false};
+            for (auto& rank_ghosts_ex :
+                 ghost_data.at(std::make_pair(rank_ghosts.locality_ex, rank_ghosts.submesh_ex)).rank_ghost_data) {
+                if (rank_ghosts_ex.locality_ex == rank_ghosts.locality_in &&
+                    rank_ghosts_ex.submesh_ex == rank_ghosts.submesh_in) {
+                    found = true;
+                    if (rank_ghosts_ex.elements_send != rank_ghosts.elements_receive ||
+                        rank_ghosts_ex.layers_send != rank_ghosts.layers_receive) {
+                        error_found = true;
+                        std::cerr << "Error: ghost send and receive lists do not match\n";
+                    }
+                }
+            }
+
+            if (!found) {
+                error_found = true;
+                std::cerr << "Error: unable to find matching ghost layer data on neighboring submesh\n";
+            }
+        }
+    }
+
+    // Check that the submeshes extended by their ghosts are closed and share no distributed boundaries
+    for (uint loc = 0; loc < submeshes.size(); ++loc) {
+        for (uint sm = 0; sm < submeshes[loc].size(); ++sm) {
+            const MeshMetaData& submesh = submeshes[loc][sm];
+
+            uint n_ghosts = 0;
+            for (auto& rank_ghosts : ghost_data.at(std::make_pair(loc, sm)).rank_ghost_data) {
+                n_ghosts += rank_ghosts.elements_receive.size();
+            }
+
+            if (submesh.elements.size() != owned_submeshes[loc][sm].elements.size() + n_ghosts) {
+                error_found = true;
+                std::cerr << "Error: submesh does not consist of its owned and ghost elements\n";
+            }
+
+            for (auto& e : submesh.elements) {
+                for (uint k = 0; k < e.second.neighbor_ID.size(); ++k) {
+                    if (is_distributed(e.second.boundary_type[k])) {
+                        error_found = true;
+                        std::cerr << "Error: element " << e.first << " has a distributed boundary\n";
+                    }
+
+                    if (e.second.neighbor_ID[k] != DEFAULT_ID && !submesh.elements.count(e.second.neighbor_ID[k])) {
+                        error_found = true;
+                        std::cerr << "Error: element " << e.first << " cannot find neighbor of id "
+                                  << e.second.neighbor_ID[k] << '\n';
+                    }
+                }
+            }
+        }
+    }
+
+    return error_found;
+}
+
 // This unit test partitions a mesh and then stitches it back together again
 int main(int argc, char** argv) {
     bool error_found{false};
@@ -98,6 +199,12 @@ int main(int argc, char** argv) {
         error_found                                      = error_found || check_partition(meshA, submeshes);
     }
     std::cout << "...done checking for rank balancing turned on\n\n";
+    std::cout << "Checking ghost layers...\n";
+    {
+        std::vector<std::vector<MeshMetaData>> submeshes = partition(meshA, weights, 8, 2, 2, false);
+        error_found                                      = error_found || check_ghost_layers(meshA, submeshes, 3);
+    }
+    std::cout << "...done checking ghost layers\n\n";
 
     if (error_found) {
         return 1;
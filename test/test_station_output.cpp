@@ -0,0 +1,191 @@
+#include "general_definitions.hpp"
+#include "utilities/almost_equal.hpp"
+#include "simulation/writer.hpp"
+
+// This test checks the location of stations in a small non-convex mesh, and the merge of the station output of two
+// submeshes sharing a station, one of which was restarted into the same output directory.
+
+// L-shaped mesh of the unit squares at (0, 0), (1, 0) and (0, 1), each split into two triangles
+MeshMetaData make_L_mesh() {
+    MeshMetaData mesh;
+    mesh.mesh_name = "L_mesh";
+
+    const std::vector<std::array<double, 2>> nodes{{0, 0}, {1, 0}, {2, 0}, {0, 1}, {1, 1}, {2, 1}, {0, 2}, {1, 2}};
+
+    for (uint node = 0; node < nodes.size(); ++node) {
+        mesh.nodes[node].coordinates = Point<3>{nodes[node][0], nodes[node][1], 0.0};
+    }
+
+    const std::vector<std::array<uint, 3>> triangles{{0, 1, 4}, {0, 4, 3}, {1, 2, 5}, {1, 5, 4}, {3, 4, 7}, {3, 7, 6}};
+
+    for (uint elt = 0; elt < triangles.size(); ++elt) {
+        mesh.elements[elt] = ElementMetaData(3);
+
+        for (uint node = 0; node < 3; ++node) {
+            mesh.elements[elt].node_ID[node] = triangles[elt][node];
+        }
+    }
+
+    return mesh;
+}
+
+bool check_location() {
+    bool error_found = false;
+
+    const Geometry::ElementIndex element_index(make_L_mesh());
+
+    // in element 3, in element 4, in the notch of the L inside the bounding box of the mesh, outside of the mesh
+    AlignedVector<Point<2>> stations{{1.2, 0.5}, {0.5, 1.2}, {1.5, 1.5}, {-3.0, 0.5}};
+    const std::vector<uint> expected_IDs{3, 4, DEFAULT_ID, DEFAULT_ID};
+
+    const std::vector<uint> located_IDs = element_index.LocatePoints(stations);
+
+    for (uint station = 0; station < stations.size(); ++station) {
+        if (located_IDs[station] != expected_IDs[station] ||
+            element_index.LocatePoint(stations[station]) != expected_IDs[station]) {
+            std::cerr << "Error: station (" << stations[station][0] << ", " << stations[station][1]
+                      << ") located in element " << located_IDs[station] << " instead of "
+                      << expected_IDs[station] << std::endl;
+            error_found = true;
+        }
+    }
+
+    return error_found;
+}
+
+// ze of a station at a time, distinct per file and per run writing it; u and v follow from ze
+double station_ze(const uint file, const uint run, const uint station, const double time) {
+    return 1000.0 * file + 100.0 * run + 10.0 * station + time / 10.0;
+}
+
+// station file of a submesh as written by Writer::InitializeStations and Writer::WriteStationOutput
+void write_station_file(const std::string& file_name,
+                        const uint file,
+                        const std::vector<std::uint32_t>& station_IDs,
+                        const uint run,
+                        const std::vector<double>& times,
+                        const bool append) {
+    std::ofstream station_file(file_name, append ? std::ios::binary | std::ios::app : std::ios::binary);
+
+    if (!append) {
+        const std::uint32_t n_stations = station_IDs.size();
+
+        station_file.write("DGSWESTA", 8);
+        station_file.write((const char*)&n_stations, sizeof(std::uint32_t));
+        station_file.write((const char*)station_IDs.data(), n_stations * sizeof(std::uint32_t));
+    }
+
+    for (const double time : times) {
+        std::vector<double> record{time};
+
+        for (const std::uint32_t station : station_IDs) {
+            const double ze = station_ze(file, run, station, time);
+
+            record.insert(record.end(), {ze, ze + 0.25, ze + 0.5});
+        }
+
+        station_file.write((const char*)record.data(), record.size() * sizeof(double));
+    }
+}
+
+bool check_merge() {
+    bool error_found = false;
+
+    WriterInput writer_input;
+    writer_input.output_path   = "station_test/";
+    writer_input.station_names = {"s0", "s1", "s2", "s3"};
+
+    mkdir("station_test", 0755);
+    mkdir("station_test/a", 0755);
+    mkdir("station_test/b", 0755);
+
+    // submesh a holds stations 1 and 0, it was checkpointed at t = 10 and restarted, so that the records of t = 20
+    // and t = 30 are written again by the restarted run
+    write_station_file("station_test/a/L_mesh_0_0_stations.bin", 0, {1, 0}, 0, {0, 10, 20, 30}, false);
+    write_station_file("station_test/a/L_mesh_0_0_stations.bin", 0, {1, 0}, 1, {20, 30, 40}, true);
+
+    // submesh b shares station 1 with submesh a, its last record was cut short by an aborted run
+    write_station_file("station_test/b/L_mesh_0_1_stations.bin", 1, {2, 1}, 0, {0, 10, 20, 30, 40}, false);
+    {
+        std::ofstream station_file("station_test/b/L_mesh_0_1_stations.bin", std::ios::binary | std::ios::app);
+
+        const std::array<double, 2> partial_record{50, 0};
+        station_file.write((const char*)partial_record.data(), sizeof(partial_record));
+    }
+
+    merge_station_output(writer_input);
+
+    // station, time, file, run of the merged series, station 3 is not located in any submesh
+    std::vector<std::tuple<uint, double, uint, uint>> expected_rows;
+    for (const uint station : {0, 1}) {
+        for (const double time : {0, 10, 20, 30, 40}) {
+            expected_rows.emplace_back(station, time, 0, time > 10 ? 1 : 0);
+        }
+    }
+    for (const double time : {0, 10, 20, 30, 40}) {
+        expected_rows.emplace_back(2, time, 1, 0);
+    }
+
+    std::ifstream merged_file("station_test/stations.csv");
+
+    std::string line;
+    std::getline(merged_file, line);
+
+    if (line != "station,time,ze,u,v") {
+        std::cerr << "Error in header of merged station output: " << line << std::endl;
+        error_found = true;
+    }
+
+    uint n_rows = 0;
+    while (std::getline(merged_file, line)) {
+        if (n_rows >= expected_rows.size()) {
+            std::cerr << "Error: unexpected row in merged station output: " << line << std::endl;
+            error_found = true;
+            continue;
+        }
+
+        uint station, file, run;
+        double time;
+        std::tie(station, time, file, run) = expected_rows[n_rows];
+
+        const double ze = station_ze(file, run, station, time);
+
+        std::stringstream row(line);
+        std::string name;
+        std::getline(row, name, ',');
+
+        std::array<double, 4> values;
+        char separator;
+        row >> values[0] >> separator >> values[1] >> separator >> values[2] >> separator >> values[3];
+
+        if (name != writer_input.station_names[station] || values[0] != time ||
+            !Utilities::almost_equal(values[1], ze) || !Utilities::almost_equal(values[2], ze + 0.25) ||
+            !Utilities::almost_equal(values[3], ze + 0.5)) {
+            std::cerr << "Error in row " << n_rows << " of merged station output: " << line << std::endl;
+            error_found = true;
+        }
+
+        ++n_rows;
+    }
+
+    if (n_rows != expected_rows.size()) {
+        std::cerr << "Error: merged station output holds " << n_rows << " rows instead of " << expected_rows.size()
+                  << std::endl;
+        error_found = true;
+    }
+
+    return error_found;
+}
+
+int main() {
+    bool error_found = false;
+
+    error_found |= check_location();
+    error_found |= check_merge();
+
+    if (error_found) {
+        return 1;
+    }
+
+    return 0;
+}
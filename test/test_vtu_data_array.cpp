@@ -0,0 +1,168 @@
+#include "utilities/vtu_data_array.hpp"
+
+#ifdef HAS_ZLIB
+std::vector<unsigned char> base64_decode(const std::string& encoded) {
+    static const std::string table = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    std::vector<unsigned char> decoded;
+
+    uint bits   = 0;
+    uint n_bits = 0;
+    for (const char c : encoded) {
+        if (c == '=') {
+            break;
+        }
+
+        bits = (bits << 6) | (uint)table.find(c);
+        n_bits += 6;
+
+        if (n_bits >= 8) {
+            n_bits -= 8;
+            decoded.push_back((unsigned char)(bits >> n_bits));
+            bits &= (1u << n_bits) - 1;
+        }
+    }
+
+    return decoded;
+}
+
+// the header of the blocks and the blocks are encoded separately, see write_VTU_data_array
+template <typename T>
+bool check_compressed_data_array(const std::string& name, const std::vector<T>& data) {
+    std::ostringstream compressed;
+    Utilities::write_VTU_data_array(compressed, name, 1, data, Utilities::VTUFormat::compressed);
+
+    std::string content = compressed.str();
+    content             = content.substr(content.find(">\n") + 2);
+    content             = content.substr(content.find_first_not_of('\t'));
+    content             = content.substr(0, content.find('\n'));
+
+    std::uint32_t n_blocks;
+    std::memcpy(&n_blocks, base64_decode(content.substr(0, 8)).data(), sizeof(std::uint32_t));
+
+    const std::size_t header_bytes = (n_blocks + 3) * sizeof(std::uint32_t);
+    const std::size_t header_chars = 4 * ((header_bytes + 2) / 3);
+
+    const std::vector<unsigned char> header_data = base64_decode(content.substr(0, header_chars));
+    const std::vector<unsigned char> blocks      = base64_decode(content.substr(header_chars));
+
+    if (header_data.size() != header_bytes) {
+        std::cerr << "Error in compressed " << name << " header size: " << header_data.size() << std::endl;
+        return true;
+    }
+
+    std::vector<std::uint32_t> header(n_blocks + 3);
+    std::memcpy(header.data(), header_data.data(), header_bytes);
+
+    const std::size_t n_bytes = data.size() * sizeof(T);
+
+    const uint expected_blocks = n_bytes == 0 ? 0 : 1;
+    if (header[0] != expected_blocks || header[1] != n_bytes || header[2] != n_bytes) {
+        std::cerr << "Error in compressed " << name << " header: " << header[0] << " blocks of " << header[1]
+                  << " bytes, last block " << header[2] << " bytes" << std::endl;
+        return true;
+    }
+
+    std::vector<unsigned char> uncompressed;
+
+    std::size_t block_begin = 0;
+    for (uint block = 0; block < n_blocks; ++block) {
+        const std::size_t block_size = (block + 1 == n_blocks) ? header[2] : header[1];
+
+        if (block_begin + header[3 + block] > blocks.size()) {
+            std::cerr << "Error in compressed " << name << ": block " << block << " is truncated" << std::endl;
+            return true;
+        }
+
+        std::vector<unsigned char> block_data(block_size);
+        uLongf n_block_bytes = block_size;
+
+        if (uncompress(block_data.data(), &n_block_bytes, &blocks[block_begin], header[3 + block]) != Z_OK ||
+            n_block_bytes != block_size) {
+            std::cerr << "Error in compressed " << name << ": block " << block << " does not uncompress" << std::endl;
+            return true;
+        }
+
+        uncompressed.insert(uncompressed.end(), block_data.begin(), block_data.end());
+        block_begin += header[3 + block];
+    }
+
+    if (block_begin != blocks.size() || uncompressed.size() != n_bytes ||
+        std::memcmp(uncompressed.data(), data.data(), n_bytes) != 0) {
+        std::cerr << "Error in compressed " << name << ": uncompressed data differs from the input" << std::endl;
+        return true;
+    }
+
+    return false;
+}
+#endif
+
+int main() {
+    bool error_found = false;
+
+    // RFC 4648 test vectors
+    const std::vector<std::pair<std::string, std::string>> base64_vectors{{"", ""},
+                                                                          {"f", "Zg=="},
+                                                                          {"fo", "Zm8="},
+                                                                          {"foo", "Zm9v"},
+                                                                          {"foob", "Zm9vYg=="},
+                                                                          {"fooba", "Zm9vYmE="},
+                                                                          {"foobar", "Zm9vYmFy"}};
+
+    for (auto& vec : base64_vectors) {
+        std::string encoded = Utilities::base64_encode((const unsigned char*)vec.first.data(), vec.first.size());
+        if (encoded != vec.second) {
+            std::cerr << "Error in base64 encoding of \"" << vec.first << "\": got " << encoded << ", expected "
+                      << vec.second << '\n';
+            error_found = true;
+        }
+    }
+
+    // UInt32 byte count header (4 bytes) followed by the values, encoded as a single base64 stream
+    std::vector<std::uint8_t> data{1, 2, 3};
+    std::ostringstream binary;
+    Utilities::write_VTU_data_array(binary, "types", 1, data, Utilities::VTUFormat::binary);
+
+    const std::string binary_expected =
+        "\t\t\t\t<DataArray type=\"UInt8\" Name=\"types\" format=\"binary\">\n"
+        "\t\t\t\t\tAwAAAAECAw==\n"
+        "\t\t\t\t</DataArray>\n";
+    if (binary.str() != binary_expected) {
+        std::cerr << "Error in binary data array:\n" << binary.str();
+        error_found = true;
+    }
+
+    std::vector<std::int8_t> flags{0, 1};
+    std::ostringstream ascii;
+    Utilities::write_VTU_data_array(ascii, "wet_dry", 1, flags, Utilities::VTUFormat::ascii);
+
+    const std::string ascii_expected =
+        "\t\t\t\t<DataArray type=\"Int8\" Name=\"wet_dry\" format=\"ascii\">\n\t\t\t\t\t0 1 \n\t\t\t\t</DataArray>\n";
+    if (ascii.str() != ascii_expected) {
+        std::cerr << "Error in ascii data array:\n" << ascii.str();
+        error_found = true;
+    }
+
+#ifdef HAS_ZLIB
+    std::vector<double> coordinates;
+    for (uint i = 0; i < 3000; ++i) {
+        coordinates.push_back(i % 3 == 2 ? 0.0 : std::sin(0.01 * i));
+    }
+
+    std::vector<std::int32_t> connectivity;
+    for (std::int32_t i = 0; i < 1000; ++i) {
+        connectivity.push_back(i / 3 + i % 3);
+    }
+
+    error_found |= check_compressed_data_array("coordinates", coordinates);
+    error_found |= check_compressed_data_array("connectivity", connectivity);
+    error_found |= check_compressed_data_array("types", data);
+    error_found |= check_compressed_data_array("empty", std::vector<float>());
+#endif
+
+    if (error_found) {
+        return 1;
+    }
+
+    return 0;
+}